@@ -0,0 +1,7 @@
+-- pgbench script: crf_full_address_normalized() (C implementation).
+--
+--   pgbench -n -T 60 -f bench/crf_full_address_normalized.sql
+\set lo random(1, 99000)
+SELECT count(crf_full_address_normalized(address))
+FROM bench_addresses
+WHERE id BETWEEN :lo AND :lo + 999;
@@ -0,0 +1,8 @@
+-- pgbench script: SQL reference implementation of
+-- crf_full_address_normalized(). Requires bench/full_address_sql_reference.sql.
+--
+--   pgbench -n -T 60 -f bench/crf_full_address_normalized_sql.sql
+\set lo random(1, 99000)
+SELECT count(crf_full_address_normalized_sql(address))
+FROM bench_addresses
+WHERE id BETWEEN :lo AND :lo + 999;
@@ -0,0 +1,82 @@
+/*
+ * Micro-benchmark for tokenizing and feature extraction, without PostgreSQL
+ * or the model. Reads one address per line and reports the time per address
+ * and per token over several passes. Build and run with:
+ *
+ *   make bench/feature_extraction
+ *   psql -Atc 'SELECT address FROM bench_addresses' > /tmp/addresses.txt
+ *   bench/feature_extraction /tmp/addresses.txt 20
+ */
+#include "feature_extractor.h"
+#include "timing.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LINE 4096
+#define MAX_TOKENS 1024
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s ADDRESS_FILE [PASSES]\n", argv[0]);
+    return 1;
+  }
+  int passes = argc > 2 ? atoi(argv[2]) : 10;
+
+  FILE *f = fopen(argv[1], "r");
+  if (!f) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  /* Load every address up front so that I/O is not timed */
+  size_t cap = 1024, count = 0;
+  char **lines = malloc(cap * sizeof(char *));
+  char buf[MAX_LINE];
+  while (fgets(buf, sizeof(buf), f)) {
+    buf[strcspn(buf, "\n")] = '\0';
+    if (count == cap) {
+      cap *= 2;
+      lines = realloc(lines, cap * sizeof(char *));
+    }
+    lines[count++] = strdup(buf);
+  }
+  fclose(f);
+  if (count == 0) {
+    fprintf(stderr, "%s: no addresses\n", argv[1]);
+    return 1;
+  }
+
+  TokenSpan spans[MAX_TOKENS];
+  CrfSuiteItem items[MAX_TOKENS];
+  size_t text_cap = 0;
+  char *text = NULL;
+  unsigned long tokens = 0, features = 0;
+
+  uint64_t start = usaddr_now_ns();
+  for (int pass = 0; pass < passes; pass++) {
+    for (size_t i = 0; i < count; i++) {
+      int len = strlen(lines[i]);
+      int n = tokenize_spans(lines[i], len, 1, spans, MAX_TOKENS);
+      if (n > MAX_TOKENS)
+        n = MAX_TOKENS;
+      size_t need = span_features_size(spans, n);
+      if (need > text_cap) {
+        text_cap = need;
+        text = realloc(text, text_cap);
+      }
+      extract_span_features(lines[i], spans, n, 1, NULL, NULL, items, text);
+      tokens += n;
+      for (int t = 0; t < n; t++)
+        features += items[t].num_features;
+    }
+  }
+  uint64_t elapsed = usaddr_now_ns() - start;
+
+  printf("%zu addresses x %d passes: %lu tokens, %lu features\n", count,
+         passes, tokens, features);
+  printf("%.1f ns/address, %.1f ns/token\n",
+         (double)elapsed / ((double)count * passes),
+         tokens ? (double)elapsed / tokens : 0.0);
+  return 0;
+}
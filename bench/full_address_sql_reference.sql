@@ -0,0 +1,45 @@
+-- SQL implementation of crf_full_address_normalized() as it shipped before
+-- the function moved to C. Installed only for benchmarking the two against
+-- each other:
+--
+--   psql -f bench/full_address_sql_reference.sql
+
+CREATE OR REPLACE FUNCTION crf_full_address_normalized_sql(input_text text)
+RETURNS text
+LANGUAGE SQL IMMUTABLE STRICT
+AS $$
+  WITH parsed AS (
+    SELECT token, label FROM parse_address_crf_normalized(input_text)
+  ),
+  aggregated AS (
+    SELECT 
+      string_agg(token, ' ') FILTER (WHERE label = 'AddressNumber') AS address_number,
+      string_agg(token, ' ') FILTER (WHERE label = 'StreetNamePreDirectional') AS street_pre_dir,
+      string_agg(token, ' ') FILTER (WHERE label = 'StreetName') AS street_name,
+      string_agg(token, ' ') FILTER (WHERE label = 'StreetNamePostType') AS street_post_type,
+      string_agg(token, ' ') FILTER (WHERE label = 'StreetNamePostDirectional') AS street_post_dir,
+      string_agg(token, ' ') FILTER (WHERE label = 'OccupancyType') AS occupancy_type,
+      string_agg(token, ' ') FILTER (WHERE label = 'OccupancyIdentifier') AS occupancy_id,
+      string_agg(token, ' ') FILTER (WHERE label = 'PlaceName') AS place_name,
+      string_agg(token, ' ') FILTER (WHERE label = 'StateName') AS state_name,
+      string_agg(token, ' ') FILTER (WHERE label = 'ZipCode') AS zip_code
+    FROM parsed
+  )
+  SELECT 
+    concat_ws(' ',
+      address_number,
+      street_pre_dir,
+      street_name,
+      street_post_type,
+      street_post_dir,
+      occupancy_type,
+      occupancy_id,
+      CASE 
+        WHEN place_name IS NOT NULL AND state_name IS NOT NULL THEN place_name || ','
+        ELSE place_name
+      END,
+      state_name,
+      zip_code
+    )
+  FROM aggregated;
+$$;
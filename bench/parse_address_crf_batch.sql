@@ -0,0 +1,9 @@
+-- pgbench script: the addresses of the lateral join script, parsed in a
+-- single batch call.
+--
+--   pgbench -n -T 60 -f bench/parse_address_crf_batch.sql
+\set lo random(1, 99000)
+SELECT count(*)
+FROM parse_address_crf_batch(ARRAY(
+       SELECT address FROM bench_addresses
+       WHERE id BETWEEN :lo AND :lo + 999 ORDER BY id));
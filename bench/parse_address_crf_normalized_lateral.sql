@@ -0,0 +1,8 @@
+-- pgbench script: normalized set-returning parse over a lateral join.
+--
+--   pgbench -n -T 60 -f bench/parse_address_crf_normalized_lateral.sql
+\set lo random(1, 99000)
+SELECT count(*)
+FROM bench_addresses a,
+     LATERAL parse_address_crf_normalized(a.address) p
+WHERE a.id BETWEEN :lo AND :lo + 999;
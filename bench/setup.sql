@@ -0,0 +1,35 @@
+-- Benchmark fixture for pg_usaddress.
+--
+-- Builds bench_addresses, a table of synthetic but realistic US addresses
+-- (street number, optional directional, street name and type, and a
+-- city/state/ZIP tail). Usage:
+--
+--   psql -f bench/setup.sql
+--
+-- The row count can be overridden with: psql -v rows=1000000 -f bench/setup.sql
+
+\if :{?rows}
+\else
+\set rows 100000
+\endif
+
+CREATE EXTENSION IF NOT EXISTS pg_usaddress;
+
+DROP TABLE IF EXISTS bench_addresses;
+CREATE TABLE bench_addresses AS
+SELECT g AS id,
+       concat_ws(' ',
+         (g % 9900 + 100)::text,
+         (ARRAY['North', 'S', 'East', 'W', NULL, NULL])[1 + g % 6],
+         (ARRAY['Main', 'Oak', 'Elm', 'Michigan', 'Washington', 'Lake',
+                'Park', 'Maple', 'Martin Luther King Jr', '42nd'])[1 + g % 10],
+         (ARRAY['Street', 'Avenue', 'Blvd', 'Dr', 'Road', 'Ln', 'Ct'])[1 + g % 7])
+       || (ARRAY['', '', '', ', Apt ' || (g % 40 + 1)::text,
+                 ', Suite ' || (g % 900 + 100)::text])[1 + g % 5]
+       || (ARRAY[', Chicago, IL 60601', ', Springfield, IL 62701',
+                 ', New York, NY 10001', ', Seattle, WA 98102',
+                 ', Austin, TX 78701', ', Los Angeles, CA 90001'])[1 + g % 6]
+         AS address
+FROM generate_series(1, :rows) AS g;
+
+ANALYZE bench_addresses;
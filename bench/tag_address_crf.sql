@@ -0,0 +1,7 @@
+-- pgbench script: jsonb output of tag_address_crf().
+--
+--   pgbench -n -T 60 -f bench/tag_address_crf.sql
+\set lo random(1, 99000)
+SELECT count(tag_address_crf(address))
+FROM bench_addresses
+WHERE id BETWEEN :lo AND :lo + 999;
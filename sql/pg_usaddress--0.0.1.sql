@@ -6,6 +6,12 @@ AS '$libdir/pg_usaddress', 'parse_address_crf'
 LANGUAGE C IMMUTABLE STRICT;
 COMMENT ON FUNCTION parse_address_crf(text) IS 'Parse an address into its components using a CRF model';
 
+CREATE OR REPLACE FUNCTION parse_address_crf_batch(input_texts text[])
+RETURNS TABLE(address_index integer, token text, label text)
+AS '$libdir/pg_usaddress', 'parse_address_crf_batch'
+LANGUAGE C IMMUTABLE STRICT;
+COMMENT ON FUNCTION parse_address_crf_batch(text[]) IS 'Parse an array of addresses, tagging the common endings of addresses (city, state, ZIP code) once per batch';
+
 CREATE OR REPLACE FUNCTION parse_address_crf_normalized(input_text text)
 RETURNS TABLE(token text, label text)
 AS '$libdir/pg_usaddress', 'parse_address_crf_normalized'
@@ -52,41 +58,91 @@ COMMENT ON FUNCTION parse_address_crf_cols(text) IS 'Parse an address into stand
 -- Function to get a fully normalized, concatenated address string
 CREATE OR REPLACE FUNCTION crf_full_address_normalized(input_text text)
 RETURNS text
-LANGUAGE SQL IMMUTABLE STRICT
-AS $$
-  WITH parsed AS (
-    SELECT token, label FROM parse_address_crf_normalized(input_text)
-  ),
-  aggregated AS (
-    SELECT 
-      string_agg(token, ' ') FILTER (WHERE label = 'AddressNumber') AS address_number,
-      string_agg(token, ' ') FILTER (WHERE label = 'StreetNamePreDirectional') AS street_pre_dir,
-      string_agg(token, ' ') FILTER (WHERE label = 'StreetName') AS street_name,
-      string_agg(token, ' ') FILTER (WHERE label = 'StreetNamePostType') AS street_post_type,
-      string_agg(token, ' ') FILTER (WHERE label = 'StreetNamePostDirectional') AS street_post_dir,
-      string_agg(token, ' ') FILTER (WHERE label = 'OccupancyType') AS occupancy_type,
-      string_agg(token, ' ') FILTER (WHERE label = 'OccupancyIdentifier') AS occupancy_id,
-      string_agg(token, ' ') FILTER (WHERE label = 'PlaceName') AS place_name,
-      string_agg(token, ' ') FILTER (WHERE label = 'StateName') AS state_name,
-      string_agg(token, ' ') FILTER (WHERE label = 'ZipCode') AS zip_code
-    FROM parsed
-  )
-  SELECT 
-    concat_ws(' ',
-      address_number,
-      street_pre_dir,
-      street_name,
-      street_post_type,
-      street_post_dir,
-      occupancy_type,
-      occupancy_id,
-      CASE 
-        WHEN place_name IS NOT NULL AND state_name IS NOT NULL THEN place_name || ','
-        ELSE place_name
-      END,
-      state_name,
-      zip_code
-    )
-  FROM aggregated;
-$$;
+AS '$libdir/pg_usaddress', 'crf_full_address_normalized'
+LANGUAGE C IMMUTABLE STRICT;
 COMMENT ON FUNCTION crf_full_address_normalized(text) IS 'Parse, normalize, and concatenate an address with comma between city and state';
+
+CREATE OR REPLACE FUNCTION pg_usaddress_tag_calls()
+RETURNS bigint
+AS '$libdir/pg_usaddress', 'pg_usaddress_tag_calls'
+LANGUAGE C VOLATILE STRICT;
+COMMENT ON FUNCTION pg_usaddress_tag_calls() IS 'Number of times the current backend has run the CRF tagger';
+
+CREATE OR REPLACE FUNCTION pg_usaddress_cache_stats(
+    OUT hits bigint,
+    OUT misses bigint,
+    OUT evictions bigint,
+    OUT entries integer)
+RETURNS record
+AS '$libdir/pg_usaddress', 'pg_usaddress_cache_stats'
+LANGUAGE C VOLATILE STRICT;
+COMMENT ON FUNCTION pg_usaddress_cache_stats() IS 'Parse cache counters for the current backend (see pg_usaddress.cache_size)';
+
+CREATE OR REPLACE FUNCTION pg_usaddress_shared_cache_stats(
+    OUT slots bigint,
+    OUT hits bigint,
+    OUT misses bigint,
+    OUT evictions bigint)
+RETURNS record
+AS '$libdir/pg_usaddress', 'pg_usaddress_shared_cache_stats'
+LANGUAGE C VOLATILE STRICT;
+COMMENT ON FUNCTION pg_usaddress_shared_cache_stats() IS 'Counters of the parse cache shared by all backends (see pg_usaddress.shared_cache_size)';
+
+CREATE OR REPLACE FUNCTION pg_usaddress_stats(
+    OUT parse_address_crf_calls bigint,
+    OUT parse_address_crf_normalized_calls bigint,
+    OUT parse_address_crf_cols_calls bigint,
+    OUT tag_address_crf_calls bigint,
+    OUT crf_full_address_normalized_calls bigint,
+    OUT parse_address_crf_batch_calls bigint,
+    OUT tokens_tagged bigint,
+    OUT tokenize_ns bigint,
+    OUT fast_path_ns bigint,
+    OUT feature_ns bigint,
+    OUT attr_lookup_ns bigint,
+    OUT state_score_ns bigint,
+    OUT viterbi_ns bigint,
+    OUT normalize_ns bigint,
+    OUT output_ns bigint,
+    OUT cache_hits bigint,
+    OUT shared_cache_hits bigint,
+    OUT model_loads bigint,
+    OUT token_cache_hits bigint,
+    OUT token_cache_misses bigint,
+    OUT state_cache_hits bigint,
+    OUT state_cache_misses bigint,
+    OUT fast_path_matches bigint,
+    OUT fast_path_mismatches bigint,
+    OUT stats_reset timestamptz)
+RETURNS record
+AS '$libdir/pg_usaddress', 'pg_usaddress_stats'
+LANGUAGE C VOLATILE STRICT;
+
+CREATE VIEW pg_usaddress_stats AS
+  SELECT * FROM pg_usaddress_stats();
+COMMENT ON VIEW pg_usaddress_stats IS 'Call counts and cumulative per-phase time of the address parser (cluster-wide when preloaded, else per backend)';
+
+CREATE OR REPLACE FUNCTION pg_usaddress_stats_reset()
+RETURNS void
+AS '$libdir/pg_usaddress', 'pg_usaddress_stats_reset'
+LANGUAGE C VOLATILE STRICT;
+COMMENT ON FUNCTION pg_usaddress_stats_reset() IS 'Zero the counters shown by pg_usaddress_stats';
+REVOKE ALL ON FUNCTION pg_usaddress_stats_reset() FROM PUBLIC;
+
+CREATE OR REPLACE FUNCTION pg_usaddress_latency_histogram(
+    OUT function_name text,
+    OUT min_tokens integer,
+    OUT max_tokens integer,
+    OUT lower_ns bigint,
+    OUT upper_ns bigint,
+    OUT count bigint)
+RETURNS SETOF record
+AS '$libdir/pg_usaddress', 'pg_usaddress_latency_histogram'
+LANGUAGE C VOLATILE STRICT;
+COMMENT ON FUNCTION pg_usaddress_latency_histogram() IS 'Non-empty buckets of the per-function call latency histograms, by input token count (max_tokens is NULL for the open-ended class)';
+
+CREATE OR REPLACE FUNCTION pg_usaddress_explain(address text)
+RETURNS jsonb
+AS '$libdir/pg_usaddress', 'pg_usaddress_explain'
+LANGUAGE C VOLATILE STRICT;
+COMMENT ON FUNCTION pg_usaddress_explain(text) IS 'Diagnostic trace of one parse: tokens, feature strings, features known to the model, per-label state scores, Viterbi score and ns per phase (bypasses the caches)';
@@ -488,6 +488,62 @@ struct tag_crfsuite_tagger {
      *  @return int         The status code.
      */
     int (*marginal_path)(crfsuite_tagger_t *tagger, const int *path, int begin, int end, floatval_t *ptr_prob);
+
+    /**
+     * Obtain the state scores of an item of the current instance.
+     *  @param  tagger      The pointer to this tagger instance.
+     *  @param  t           The position.
+     *  @param  ptr_scores  The pointer that receives the state scores of the
+     *                      item, one per label. The array is owned by the
+     *                      tagger and valid until the next set() call.
+     *  @return int         The status code.
+     */
+    int (*state_scores)(crfsuite_tagger_t *tagger, int t, const floatval_t **ptr_scores);
+
+    /**
+     * Set an instance to the tagger, taking the state scores of some items
+     * from the caller instead of computing them from their attributes.
+     *  @param  tagger      The pointer to this tagger instance.
+     *  @param  inst        The item sequence to be tagged.
+     *  @param  rows        rows[t] points to the state scores of item #t, one
+     *                      per label, or is NULL for the tagger to compute
+     *                      them. The scores are copied.
+     *  @return int         The status code.
+     */
+    int (*set_with_states)(crfsuite_tagger_t* tagger, crfsuite_instance_t *inst, const floatval_t *const *rows);
+
+    /**
+     * Set a batch of instances to the tagger for viterbi_batch(). Instances
+     * that end with the same items share the state scores of those items.
+     * The instances are not needed after this call.
+     *  @param  tagger      The pointer to this tagger instance.
+     *  @param  insts       The instances.
+     *  @param  n           The number of instances.
+     *  @param  ptr_num_scored  The pointer that receives the number of
+     *                      distinct items whose state scores were computed,
+     *                      or NULL.
+     *  @return int         The status code.
+     */
+    int (*set_batch)(crfsuite_tagger_t* tagger, const crfsuite_instance_t *insts, int n, int *ptr_num_scored);
+
+    /**
+     * Find the Viterbi label sequences of the batch set by set_batch(),
+     * decoding backward so that instances sharing their last items share
+     * that work too.
+     *  @param  tagger      The pointer to this tagger instance.
+     *  @param  labels      labels[k] receives the label sequence of instance
+     *                      #k, as long as the instance.
+     *  @return int         The status code.
+     */
+    int (*viterbi_batch)(crfsuite_tagger_t* tagger, int *const *labels);
+
+    /**
+     * Release the batch set by set_batch(). A batch holds the state scores
+     * of all its items, so callers should not keep it past viterbi_batch().
+     *  @param  tagger      The pointer to this tagger instance.
+     *  @return int         The status code.
+     */
+    int (*clear_batch)(crfsuite_tagger_t* tagger);
 };
 
 /**
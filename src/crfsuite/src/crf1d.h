@@ -212,6 +212,7 @@ floatval_t crf1dc_marginal_path(crf1d_context_t *ctx, const int *path, int begin
 floatval_t crf1dc_score(crf1d_context_t* ctx, const int *labels);
 floatval_t crf1dc_lognorm(crf1d_context_t* ctx);
 floatval_t crf1dc_viterbi(crf1d_context_t* ctx, int *labels);
+void crf1dc_viterbi_backward_step(const crf1d_context_t* ctx, const floatval_t *next_state, const floatval_t *next_best, floatval_t *best, int *next_labels);
 void crf1dc_debug_context(FILE *fp);
 
 /** @} */
@@ -536,6 +536,46 @@ floatval_t crf1dc_viterbi(crf1d_context_t* ctx, int *labels)
     return max_score;
 }
 
+/*
+    One step of Viterbi decoding run backward, from the end of the sequence
+    towards its start. Given the state scores of the item #(t+1) and, for
+    each of its labels, the best score of the items after it (next_best),
+    this computes for each label #i at #t the best score of the items after
+    #t (best[i]), and the label at #(t+1) that attains it (next_labels[i]).
+    Only the transition scores are taken from the context, so sequences that
+    end with the same items can share these quantities.
+ */
+void crf1dc_viterbi_backward_step(
+    const crf1d_context_t* ctx,
+    const floatval_t *next_state,
+    const floatval_t *next_best,
+    floatval_t *best,
+    int *next_labels
+    )
+{
+    int i, j;
+    floatval_t max_score, score;
+    int argmax_score;
+    const floatval_t *trans = NULL;
+    const int L = ctx->num_labels;
+
+    for (i = 0;i < L;++i) {
+        trans = TRANS_SCORE(ctx, i);
+        max_score = -FLOAT_MAX;
+        argmax_score = 0;
+        for (j = 0;j < L;++j) {
+            /* Transit from (t, i) to (t+1, j) and continue from there. */
+            score = trans[j] + next_state[j] + next_best[j];
+            if (max_score < score) {
+                max_score = score;
+                argmax_score = j;
+            }
+        }
+        best[i] = max_score;
+        next_labels[i] = argmax_score;
+    }
+}
+
 static void check_values(FILE *fp, floatval_t cv, floatval_t tv)
 {
     if (fabs(cv - tv) < 1e-9) {
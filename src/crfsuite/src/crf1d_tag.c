@@ -36,6 +36,7 @@
 
 #include <os.h>
 
+#include <float.h>
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -51,49 +52,87 @@ enum {
     LEVEL_ALPHABETA,
 };
 
+/*
+    A batch of instances in a suffix trie. Each node stands for an item;
+    its parent is the node of the item that follows it, so instances ending
+    with the same items (e.g., the same city, state, and ZIP code) share the
+    nodes of those items. State scores and backward Viterbi quantities are
+    computed once per node.
+ */
+typedef struct {
+    int parent;                 /**< Node of the next item, or -1. */
+    unsigned int hash;          /**< Hash of the parent and the item. */
+    const crfsuite_item_t *item;
+} suffix_node_t;
+
+typedef struct {
+    int num_nodes;
+    suffix_node_t *nodes;
+    int *table;                 /**< Open-addressing index of the nodes. */
+    int table_mask;
+    floatval_t *state;          /**< [num_nodes][L] state scores. */
+    floatval_t *best;           /**< [num_nodes][L] best scores after each node. */
+    int *next_labels;           /**< [num_nodes][L] labels attaining them. */
+    int num_insts;
+    int *lengths;               /**< Number of items of each instance. */
+    int *heads;                 /**< Node of the first item of each instance. */
+} suffix_batch_t;
+
 typedef struct {
     crf1dm_t *model;        /**< CRF model. */
     crf1d_context_t *ctx;   /**< CRF context. */
     int num_labels;         /**< Number of distinct output labels (L). */
     int num_attributes;     /**< Number of distinct attributes (A). */
     int level;
+    suffix_batch_t *batch;  /**< The batch set by set_batch(), or NULL. */
 } crf1dt_t;
 
-static void crf1dt_state_score(crf1dt_t *crf1dt, const crfsuite_instance_t *inst)
+static void crf1dt_item_state_score(crf1dt_t *crf1dt, const crfsuite_item_t *item, floatval_t *state)
 {
-    int a, i, l, t, r, fid;
+    int a, i, l, r, fid;
     crf1dm_feature_t f;
     feature_refs_t attr;
-    floatval_t value, *state = NULL;
+    floatval_t value;
     crf1dm_t* model = crf1dt->model;
+
+    /* Loop over the contents (attributes) attached to the item. */
+    for (i = 0;i < item->num_contents;++i) {
+        /* Access the list of state features associated with the attribute. */
+        a = item->contents[i].aid;
+        crf1dm_get_attrref(model, a, &attr);
+        /* A scale usually represents the atrribute frequency in the item. */
+        value = item->contents[i].value;
+
+        /* Loop over the state features associated with the attribute. */
+        for (r = 0;r < attr.num_features;++r) {
+            /* The state feature #(attr->fids[r]), which is represented by
+               the attribute #a, outputs the label #(f->dst). */
+            fid = crf1dm_get_featureid(&attr, r);
+            crf1dm_get_feature(model, fid, &f);
+            l = f.dst;
+            state[l] += f.weight * value;
+        }
+    }
+}
+
+static void crf1dt_state_score(crf1dt_t *crf1dt, const crfsuite_instance_t *inst, const floatval_t *const *rows)
+{
+    int t;
+    floatval_t *state = NULL;
     crf1d_context_t* ctx = crf1dt->ctx;
-    const crfsuite_item_t* item = NULL;
     const int T = inst->num_items;
     const int L = crf1dt->num_labels;
 
     /* Loop over the items in the sequence. */
     for (t = 0;t < T;++t) {
-        item = &inst->items[t];
         state = STATE_SCORE(ctx, t);
 
-        /* Loop over the contents (attributes) attached to the item. */
-        for (i = 0;i < item->num_contents;++i) {
-            /* Access the list of state features associated with the attribute. */
-            a = item->contents[i].aid;
-            crf1dm_get_attrref(model, a, &attr);
-            /* A scale usually represents the atrribute frequency in the item. */
-            value = item->contents[i].value;
-
-            /* Loop over the state features associated with the attribute. */
-            for (r = 0;r < attr.num_features;++r) {
-                /* The state feature #(attr->fids[r]), which is represented by
-                   the attribute #a, outputs the label #(f->dst). */
-                fid = crf1dm_get_featureid(&attr, r);
-                crf1dm_get_feature(model, fid, &f);
-                l = f.dst;
-                state[l] += f.weight * value;
-            }
+        /* Take the scores given by the caller, if any. */
+        if (rows != NULL && rows[t] != NULL) {
+            memcpy(state, rows[t], sizeof(floatval_t) * L);
+            continue;
         }
+        crf1dt_item_state_score(crf1dt, &inst->items[t], state);
     }
 }
 
@@ -134,9 +173,129 @@ static void crf1dt_set_level(crf1dt_t *crf1dt, int level)
     crf1dt->level = level;
 }
 
+static void suffix_batch_delete(suffix_batch_t *batch)
+{
+    if (batch != NULL) {
+        free(batch->nodes);
+        free(batch->table);
+        free(batch->state);
+        free(batch->best);
+        free(batch->next_labels);
+        free(batch->lengths);
+        free(batch->heads);
+        free(batch);
+    }
+}
+
+static int items_equal(const crfsuite_item_t *x, const crfsuite_item_t *y)
+{
+    int i;
+    if (x->num_contents != y->num_contents) {
+        return 0;
+    }
+    for (i = 0;i < x->num_contents;++i) {
+        if (x->contents[i].aid != y->contents[i].aid ||
+            x->contents[i].value != y->contents[i].value) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Returns the node of the item preceding the node #parent, adding it if new. */
+static int suffix_batch_node(suffix_batch_t *batch, int parent, const crfsuite_item_t *item)
+{
+    int i, n;
+    unsigned int h = 2166136261u ^ (unsigned int)parent;
+    suffix_node_t *node = NULL;
+
+    for (i = 0;i < item->num_contents;++i) {
+        h = (h * 16777619u) ^ (unsigned int)item->contents[i].aid;
+    }
+    h ^= h >> 15;
+
+    for (i = h & batch->table_mask;;i = (i + 1) & batch->table_mask) {
+        n = batch->table[i];
+        if (n < 0) {
+            break;
+        }
+        node = &batch->nodes[n];
+        if (node->hash == h && node->parent == parent && items_equal(node->item, item)) {
+            return n;
+        }
+    }
+
+    n = batch->num_nodes++;
+    batch->table[i] = n;
+    node = &batch->nodes[n];
+    node->parent = parent;
+    node->hash = h;
+    node->item = item;
+    return n;
+}
+
+static suffix_batch_t *suffix_batch_new(crf1dt_t *crf1dt, const crfsuite_instance_t *insts, int n)
+{
+    int i, k, t, size = 1, total = 0;
+    const int L = crf1dt->num_labels;
+    suffix_batch_t *batch = (suffix_batch_t*)calloc(1, sizeof(suffix_batch_t));
+
+    if (batch == NULL) {
+        return NULL;
+    }
+    for (k = 0;k < n;++k) {
+        total += insts[k].num_items;
+    }
+    /* The index is at most half full. */
+    while (size < 2 * total) {
+        size *= 2;
+    }
+
+    batch->num_insts = n;
+    batch->nodes = (suffix_node_t*)malloc(sizeof(suffix_node_t) * (total + 1));
+    batch->table = (int*)malloc(sizeof(int) * size);
+    batch->lengths = (int*)malloc(sizeof(int) * (n + 1));
+    batch->heads = (int*)malloc(sizeof(int) * (n + 1));
+    if (batch->nodes == NULL || batch->table == NULL ||
+        batch->lengths == NULL || batch->heads == NULL) {
+        suffix_batch_delete(batch);
+        return NULL;
+    }
+    batch->table_mask = size - 1;
+    for (i = 0;i < size;++i) {
+        batch->table[i] = -1;
+    }
+
+    /* Insert the items of each instance from the last one. */
+    for (k = 0;k < n;++k) {
+        int node = -1;
+        for (t = insts[k].num_items - 1;0 <= t;--t) {
+            node = suffix_batch_node(batch, node, &insts[k].items[t]);
+        }
+        batch->lengths[k] = insts[k].num_items;
+        batch->heads[k] = node;
+    }
+
+    batch->state = (floatval_t*)calloc((size_t)batch->num_nodes * L + 1, sizeof(floatval_t));
+    batch->best = (floatval_t*)malloc(sizeof(floatval_t) * ((size_t)batch->num_nodes * L + 1));
+    batch->next_labels = (int*)malloc(sizeof(int) * ((size_t)batch->num_nodes * L + 1));
+    if (batch->state == NULL || batch->best == NULL || batch->next_labels == NULL) {
+        suffix_batch_delete(batch);
+        return NULL;
+    }
+
+    /* The items are no longer needed once their state scores are known. */
+    for (i = 0;i < batch->num_nodes;++i) {
+        crf1dt_item_state_score(crf1dt, batch->nodes[i].item, &batch->state[(size_t)i * L]);
+        batch->nodes[i].item = NULL;
+    }
+    return batch;
+}
+
 static void crf1dt_delete(crf1dt_t* crf1dt)
 {
     /* Note: we don't own the model object (crf1t->model). */
+    suffix_batch_delete(crf1dt->batch);
     if (crf1dt->ctx != NULL) {
         crf1dc_delete(crf1dt->ctx);
         crf1dt->ctx = NULL;
@@ -198,11 +357,100 @@ static int tagger_set(crfsuite_tagger_t* tagger, crfsuite_instance_t *inst)
     crf1d_context_t* ctx = crf1dt->ctx;
     crf1dc_set_num_items(ctx, inst->num_items);
     crf1dc_reset(crf1dt->ctx, RF_STATE);
-    crf1dt_state_score(crf1dt, inst);
+    crf1dt_state_score(crf1dt, inst, NULL);
     crf1dt->level = LEVEL_SET;
     return 0;
 }
 
+static int tagger_set_with_states(crfsuite_tagger_t* tagger, crfsuite_instance_t *inst, const floatval_t *const *rows)
+{
+    crf1dt_t* crf1dt = (crf1dt_t*)tagger->internal;
+    crf1d_context_t* ctx = crf1dt->ctx;
+    crf1dc_set_num_items(ctx, inst->num_items);
+    crf1dc_reset(crf1dt->ctx, RF_STATE);
+    crf1dt_state_score(crf1dt, inst, rows);
+    crf1dt->level = LEVEL_SET;
+    return 0;
+}
+
+static int tagger_set_batch(crfsuite_tagger_t* tagger, const crfsuite_instance_t *insts, int n, int *ptr_num_scored)
+{
+    crf1dt_t* crf1dt = (crf1dt_t*)tagger->internal;
+
+    suffix_batch_delete(crf1dt->batch);
+    crf1dt->batch = suffix_batch_new(crf1dt, insts, n);
+    if (crf1dt->batch == NULL) {
+        return CRFSUITEERR_OUTOFMEMORY;
+    }
+    if (ptr_num_scored != NULL) {
+        *ptr_num_scored = crf1dt->batch->num_nodes;
+    }
+    return 0;
+}
+
+static int tagger_viterbi_batch(crfsuite_tagger_t* tagger, int *const *labels)
+{
+    int i, k, t, node, label;
+    floatval_t max_score, score;
+    crf1dt_t* crf1dt = (crf1dt_t*)tagger->internal;
+    suffix_batch_t *batch = crf1dt->batch;
+    const int L = crf1dt->num_labels;
+
+    if (batch == NULL) {
+        return CRFSUITEERR_INCOMPATIBLE;
+    }
+
+    /* Parents come before their children, so each step finds its inputs. */
+    for (i = 0;i < batch->num_nodes;++i) {
+        const int p = batch->nodes[i].parent;
+        floatval_t *best = &batch->best[(size_t)i * L];
+        int *next_labels = &batch->next_labels[(size_t)i * L];
+        if (p < 0) {
+            for (label = 0;label < L;++label) {
+                best[label] = 0.;
+                next_labels[label] = -1;
+            }
+        } else {
+            crf1dc_viterbi_backward_step(
+                crf1dt->ctx, &batch->state[(size_t)p * L],
+                &batch->best[(size_t)p * L], best, next_labels);
+        }
+    }
+
+    /* Start each instance at its best first label and follow the links. */
+    for (k = 0;k < batch->num_insts;++k) {
+        node = batch->heads[k];
+        if (node < 0) {
+            continue;
+        }
+        max_score = -FLOAT_MAX;
+        label = 0;
+        for (i = 0;i < L;++i) {
+            score = batch->state[(size_t)node * L + i] + batch->best[(size_t)node * L + i];
+            if (max_score < score) {
+                max_score = score;
+                label = i;
+            }
+        }
+        labels[k][0] = label;
+        for (t = 1;t < batch->lengths[k];++t) {
+            label = batch->next_labels[(size_t)node * L + label];
+            node = batch->nodes[node].parent;
+            labels[k][t] = label;
+        }
+    }
+    return 0;
+}
+
+static int tagger_clear_batch(crfsuite_tagger_t* tagger)
+{
+    crf1dt_t* crf1dt = (crf1dt_t*)tagger->internal;
+
+    suffix_batch_delete(crf1dt->batch);
+    crf1dt->batch = NULL;
+    return 0;
+}
+
 static int tagger_length(crfsuite_tagger_t* tagger)
 {
     crf1dt_t* crf1dt = (crf1dt_t*)tagger->internal;
@@ -260,6 +508,17 @@ static int tagger_marginal_path(crfsuite_tagger_t *tagger, const int *path, int
     return 0;
 }
 
+static int tagger_state_scores(crfsuite_tagger_t *tagger, int t, const floatval_t **ptr_scores)
+{
+    crf1dt_t* crf1dt = (crf1dt_t*)tagger->internal;
+    crf1d_context_t* ctx = crf1dt->ctx;
+    if (t < 0 || ctx->num_items <= t) {
+        return CRFSUITEERR_INCOMPATIBLE;
+    }
+    *ptr_scores = STATE_SCORE(ctx, t);
+    return 0;
+}
+
 
 
 /*
@@ -424,6 +683,11 @@ static int model_get_tagger(crfsuite_model_t* model, crfsuite_tagger_t** ptr_tag
     tagger->lognorm = tagger_lognorm;
     tagger->marginal_point = tagger_marginal_point;
     tagger->marginal_path = tagger_marginal_path;
+    tagger->state_scores = tagger_state_scores;
+    tagger->set_with_states = tagger_set_with_states;
+    tagger->set_batch = tagger_set_batch;
+    tagger->viterbi_batch = tagger_viterbi_batch;
+    tagger->clear_batch = tagger_clear_batch;
 
     *ptr_tagger = tagger;
     return 0;
@@ -1,14 +1,47 @@
 #include "crfsuite_wrapper.h"
+#include "timing.h"
 #include <crfsuite.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+/*
+ * Cache of state-score rows. An item's row depends only on its attributes,
+ * which the feature extractor derives from the token and its neighbours'
+ * words, so the rows of recurring (previous, token, next) trigrams are kept,
+ * keyed by the item's attribute ids in order. The cache is open-addressed
+ * with probing bounded to STATE_CACHE_WAYS slots; when all of them are
+ * taken, a new row replaces one of them.
+ */
+#define STATE_CACHE_WAYS 4
+
+/* Items with more attributes are not cached */
+#define STATE_CACHE_MAX_ATTRS (2 * MAX_ITEM_FEATURES)
+
+typedef struct {
+  uint32_t hash;
+  int used;
+  int num_attrs;
+  int attrs[STATE_CACHE_MAX_ATTRS];
+  floatval_t row[]; /* one score per label */
+} StateCacheEntry;
+
+typedef struct {
+  char *entries;     /* entry_size bytes apart */
+  size_t entry_size; /* with the row of a model's labels */
+  uint32_t mask;     /* number of entries - 1 */
+  uint32_t clock;    /* picks the slot a new row replaces */
+  uint64_t hits;
+  uint64_t misses;
+} StateCache;
+
 struct CrfSuiteModel {
   crfsuite_model_t *model;
   crfsuite_tagger_t *tagger;
   crfsuite_dictionary_t *attrs;
   crfsuite_dictionary_t *labels;
+  StateCache *state_cache; /* NULL if disabled */
 };
 
 CrfSuiteModel *crfsuite_model_create(const char *filename) {
@@ -20,6 +53,7 @@ CrfSuiteModel *crfsuite_model_create(const char *filename) {
   wrapper->tagger = NULL;
   wrapper->attrs = NULL;
   wrapper->labels = NULL;
+  wrapper->state_cache = NULL;
 
   int ret =
       crfsuite_create_instance_from_file(filename, (void **)&wrapper->model);
@@ -41,8 +75,61 @@ CrfSuiteModel *crfsuite_model_create(const char *filename) {
   return wrapper;
 }
 
+static void state_cache_free(StateCache *cache) {
+  if (cache) {
+    free(cache->entries);
+    free(cache);
+  }
+}
+
+static StateCacheEntry *state_cache_slot(StateCache *cache, uint32_t i) {
+  return (StateCacheEntry *)(cache->entries +
+                             (size_t)(i & cache->mask) * cache->entry_size);
+}
+
+static uint32_t state_cache_hash(const crfsuite_item_t *item) {
+  uint32_t h = 2166136261u;
+
+  for (int j = 0; j < item->num_contents; j++)
+    h = (h ^ (uint32_t)item->contents[j].aid) * 16777619u;
+  return h ^ (h >> 16);
+}
+
+/*
+ * Returns the entry holding the row of item, setting *found, or else the
+ * slot to store it in. Returns NULL if the item cannot be cached.
+ */
+static StateCacheEntry *state_cache_find(StateCache *cache,
+                                         const crfsuite_item_t *item,
+                                         uint32_t hash, int *found) {
+  StateCacheEntry *entry = NULL;
+
+  *found = 0;
+  if (item->num_contents > STATE_CACHE_MAX_ATTRS)
+    return NULL;
+  for (uint32_t i = 0; i < STATE_CACHE_WAYS; i++) {
+    int j;
+
+    entry = state_cache_slot(cache, hash + i);
+    if (!entry->used)
+      return entry;
+    if (entry->hash != hash || entry->num_attrs != item->num_contents)
+      continue;
+    for (j = 0; j < item->num_contents; j++) {
+      if (entry->attrs[j] != item->contents[j].aid)
+        break;
+    }
+    if (j == item->num_contents) {
+      *found = 1;
+      return entry;
+    }
+  }
+  return state_cache_slot(cache, hash + cache->clock++ % STATE_CACHE_WAYS);
+}
+
 void crfsuite_model_destroy(CrfSuiteModel *wrapper) {
   if (wrapper) {
+    state_cache_free(wrapper->state_cache);
     if (wrapper->labels)
       wrapper->labels->release(wrapper->labels);
     if (wrapper->attrs)
@@ -55,34 +142,99 @@ void crfsuite_model_destroy(CrfSuiteModel *wrapper) {
   }
 }
 
-int crfsuite_model_tag(CrfSuiteModel *wrapper, CrfSuiteItem *items,
-                       int num_items, char ***labels_out) {
-  if (!wrapper || !wrapper->tagger || !items || num_items <= 0) {
-    return -1;
+/*
+ * Sets inst to the tagger, taking the state-score rows of items seen before
+ * from the state cache and adding those of the others.
+ */
+static int set_with_cached_states(CrfSuiteModel *wrapper,
+                                  crfsuite_instance_t *inst) {
+  StateCache *cache = wrapper->state_cache;
+  crfsuite_tagger_t *tagger = wrapper->tagger;
+  int num_labels = crfsuite_model_num_labels(wrapper);
+  const floatval_t **rows = calloc(inst->num_items, sizeof(floatval_t *));
+  StateCacheEntry **stores = calloc(inst->num_items, sizeof(StateCacheEntry *));
+  uint32_t *hashes = malloc(inst->num_items * sizeof(uint32_t));
+  int ret;
+
+  if (!rows || !stores || !hashes) {
+    free(rows);
+    free(stores);
+    free(hashes);
+    return tagger->set(tagger, inst);
   }
 
-  crfsuite_tagger_t *tagger = wrapper->tagger;
-  crfsuite_dictionary_t *attrs = wrapper->attrs;
-  crfsuite_dictionary_t *labels = wrapper->labels;
+  for (int i = 0; i < inst->num_items; i++) {
+    int found;
+    StateCacheEntry *entry;
 
-  crfsuite_instance_t inst;
+    hashes[i] = state_cache_hash(&inst->items[i]);
+    entry = state_cache_find(cache, &inst->items[i], hashes[i], &found);
+    if (found) {
+      rows[i] = entry->row;
+      cache->hits++;
+    } else {
+      stores[i] = entry;
+      cache->misses++;
+    }
+  }
+
+  /*
+   * Rows are stored only once the tagger has copied the cached ones, since
+   * a store may replace an entry that an earlier item hit
+   */
+  ret = tagger->set_with_states(tagger, inst, rows);
+  for (int i = 0; i < inst->num_items && ret == 0; i++) {
+    const crfsuite_item_t *item = &inst->items[i];
+    const floatval_t *state;
+
+    if (!stores[i] || tagger->state_scores(tagger, i, &state) != 0)
+      continue;
+    stores[i]->used = 1;
+    stores[i]->hash = hashes[i];
+    stores[i]->num_attrs = item->num_contents;
+    for (int j = 0; j < item->num_contents; j++)
+      stores[i]->attrs[j] = item->contents[j].aid;
+    memcpy(stores[i]->row, state, num_labels * sizeof(floatval_t));
+  }
 
-  crfsuite_instance_init(&inst);
-  inst.num_items = num_items;
-  inst.items = calloc(num_items, sizeof(crfsuite_item_t));
+  free(rows);
+  free(stores);
+  free(hashes);
+  return ret;
+}
+
+/*
+ * Builds the CRFsuite instance of items, resolving feature strings to
+ * attribute ids. If resolved is not NULL, it receives the number of features
+ * of each item that the model knows. Returns 0 on success; on failure the
+ * instance is left empty.
+ */
+static int build_instance(CrfSuiteModel *wrapper, const CrfSuiteItem *items,
+                          int num_items, crfsuite_instance_t *inst,
+                          int *resolved) {
+  crfsuite_dictionary_t *attrs = wrapper->attrs;
 
-  if (!inst.items) {
+  crfsuite_instance_init(inst);
+  inst->num_items = num_items;
+  inst->items = calloc(num_items, sizeof(crfsuite_item_t));
+
+  if (!inst->items) {
+    crfsuite_instance_init(inst);
     return -1;
   }
 
   for (int i = 0; i < num_items; i++) {
-    crfsuite_item_init(&inst.items[i]);
-    inst.items[i].num_contents = 0;
-    inst.items[i].contents =
-        calloc(items[i].num_features, sizeof(crfsuite_attribute_t));
+    int num_contents = items[i].num_features + items[i].num_attr_ids;
+
+    crfsuite_item_init(&inst->items[i]);
+    inst->items[i].num_contents = 0;
+    /* An item may have no features left once unknown ones are pruned */
+    inst->items[i].contents =
+        calloc(num_contents > 0 ? num_contents : 1,
+               sizeof(crfsuite_attribute_t));
 
-    if (!inst.items[i].contents) {
-      crfsuite_instance_finish(&inst);
+    if (!inst->items[i].contents) {
+      crfsuite_instance_finish(inst);
       return -1;
     }
 
@@ -93,43 +245,183 @@ int crfsuite_model_tag(CrfSuiteModel *wrapper, CrfSuiteItem *items,
         continue;
       }
       crfsuite_attribute_set(
-          &inst.items[i].contents[inst.items[i].num_contents], aid, 1.0);
-      inst.items[i].num_contents++;
+          &inst->items[i].contents[inst->items[i].num_contents], aid, 1.0);
+      inst->items[i].num_contents++;
     }
+    for (int j = 0; j < items[i].num_attr_ids; j++) {
+      crfsuite_attribute_set(
+          &inst->items[i].contents[inst->items[i].num_contents],
+          items[i].attr_ids[j], 1.0);
+      inst->items[i].num_contents++;
+    }
+    if (resolved)
+      resolved[i] = inst->items[i].num_contents;
+  }
+  return 0;
+}
+
+/*
+ * Shared by crfsuite_model_tag_ids() and crfsuite_model_explain(); details
+ * may be NULL.
+ */
+static int tag_items(CrfSuiteModel *wrapper, CrfSuiteItem *items,
+                     int num_items, int *label_ids_out,
+                     CrfSuiteTagTimings *timings,
+                     CrfSuiteTagDetails *details) {
+  if (!wrapper || !wrapper->tagger || !items || num_items <= 0 ||
+      !label_ids_out) {
+    return -1;
+  }
+
+  crfsuite_tagger_t *tagger = wrapper->tagger;
+
+  crfsuite_instance_t inst;
+  uint64_t t0 = timings ? usaddr_now_ns() : 0;
+  uint64_t t1;
+
+  if (build_instance(wrapper, items, num_items, &inst,
+                     details ? details->resolved_features : NULL) != 0)
+    return -1;
+
+  if (timings) {
+    t1 = usaddr_now_ns();
+    timings->attr_lookup_ns += t1 - t0;
+    t0 = t1;
   }
 
-  int ret = tagger->set(tagger, &inst);
+  int ret;
+
+  /* The explain path always computes the scores it reports */
+  if (wrapper->state_cache && !details)
+    ret = set_with_cached_states(wrapper, &inst);
+  else
+    ret = tagger->set(tagger, &inst);
 
   if (ret != 0) {
     crfsuite_instance_finish(&inst);
     return -1;
   }
 
-  *labels_out = malloc(num_items * sizeof(char *));
-  if (!*labels_out) {
-    crfsuite_instance_finish(&inst);
+  if (timings) {
+    t1 = usaddr_now_ns();
+    timings->state_score_ns += t1 - t0;
+    t0 = t1;
+  }
+
+  floatval_t score = 0.0;
+  ret = tagger->viterbi(tagger, label_ids_out, &score);
+
+  if (timings)
+    timings->viterbi_ns += usaddr_now_ns() - t0;
+
+  if (details && ret == 0) {
+    int num_labels = crfsuite_model_num_labels(wrapper);
+
+    details->viterbi_score = score;
+    for (int i = 0; i < num_items && ret == 0; i++) {
+      const floatval_t *state;
+
+      ret = tagger->state_scores(tagger, i, &state);
+      for (int l = 0; l < num_labels && ret == 0; l++)
+        details->state_scores[i * num_labels + l] = state[l];
+    }
+  }
+
+  crfsuite_instance_finish(&inst);
+  return ret != 0 ? -1 : 0;
+}
+
+int crfsuite_model_tag_ids(CrfSuiteModel *wrapper, CrfSuiteItem *items,
+                           int num_items, int *label_ids_out,
+                           CrfSuiteTagTimings *timings) {
+  return tag_items(wrapper, items, num_items, label_ids_out, timings, NULL);
+}
+
+int crfsuite_model_tag_batch(CrfSuiteModel *wrapper, CrfSuiteItem *const *items,
+                             const int *num_items, int num_seqs,
+                             int *const *label_ids_out,
+                             CrfSuiteTagTimings *timings, int *num_scored) {
+  crfsuite_instance_t *insts;
+  crfsuite_tagger_t *tagger;
+  uint64_t t0 = timings ? usaddr_now_ns() : 0;
+  uint64_t t1;
+  int ret = 0;
+  int k;
+
+  if (!wrapper || !wrapper->tagger || num_seqs < 0)
+    return -1;
+  tagger = wrapper->tagger;
+  insts = calloc(num_seqs > 0 ? num_seqs : 1, sizeof(crfsuite_instance_t));
+  if (!insts)
+    return -1;
+
+  for (k = 0; k < num_seqs && ret == 0; k++) {
+    if (num_items[k] > 0)
+      ret = build_instance(wrapper, items[k], num_items[k], &insts[k], NULL);
+    else
+      crfsuite_instance_init(&insts[k]);
+  }
+
+  if (timings) {
+    t1 = usaddr_now_ns();
+    timings->attr_lookup_ns += t1 - t0;
+    t0 = t1;
+  }
+
+  if (ret == 0)
+    ret = tagger->set_batch(tagger, insts, num_seqs, num_scored);
+  for (k = 0; k < num_seqs; k++)
+    crfsuite_instance_finish(&insts[k]);
+  free(insts);
+
+  if (timings) {
+    t1 = usaddr_now_ns();
+    timings->state_score_ns += t1 - t0;
+    t0 = t1;
+  }
+
+  if (ret == 0)
+    ret = tagger->viterbi_batch(tagger, label_ids_out);
+  tagger->clear_batch(tagger);
+
+  if (timings)
+    timings->viterbi_ns += usaddr_now_ns() - t0;
+  return ret != 0 ? -1 : 0;
+}
+
+int crfsuite_model_explain(CrfSuiteModel *wrapper, CrfSuiteItem *items,
+                           int num_items, int *label_ids_out,
+                           CrfSuiteTagTimings *timings,
+                           CrfSuiteTagDetails *details) {
+  if (!details || !details->resolved_features || !details->state_scores)
+    return -1;
+  return tag_items(wrapper, items, num_items, label_ids_out, timings, details);
+}
+
+int crfsuite_model_tag(CrfSuiteModel *wrapper, CrfSuiteItem *items,
+                       int num_items, char ***labels_out) {
+  if (!wrapper || num_items <= 0) {
     return -1;
   }
 
   int *path = calloc(num_items, sizeof(int));
   if (!path) {
-    free(*labels_out);
-    crfsuite_instance_finish(&inst);
     return -1;
   }
-  floatval_t score = 0.0;
-  ret = tagger->viterbi(tagger, path, &score);
 
-  if (ret != 0) {
+  if (crfsuite_model_tag_ids(wrapper, items, num_items, path, NULL) != 0) {
+    free(path);
+    return -1;
+  }
+
+  *labels_out = malloc(num_items * sizeof(char *));
+  if (!*labels_out) {
     free(path);
-    free(*labels_out);
-    crfsuite_instance_finish(&inst);
     return -1;
   }
 
   for (int i = 0; i < num_items; i++) {
-    const char *label_str = NULL;
-    labels->to_string(labels, path[i], &label_str);
+    const char *label_str = crfsuite_model_label(wrapper, path[i]);
 
     if (label_str) {
       (*labels_out)[i] = strdup(label_str);
@@ -139,6 +431,92 @@ int crfsuite_model_tag(CrfSuiteModel *wrapper, CrfSuiteItem *items,
   }
 
   free(path);
-  crfsuite_instance_finish(&inst);
   return 0;
 }
+
+int crfsuite_model_num_labels(CrfSuiteModel *wrapper) {
+  if (!wrapper || !wrapper->labels)
+    return 0;
+  return wrapper->labels->num(wrapper->labels);
+}
+
+const char *crfsuite_model_label(CrfSuiteModel *wrapper, int label_id) {
+  const char *label_str = NULL;
+
+  if (!wrapper || !wrapper->labels)
+    return NULL;
+  wrapper->labels->to_string(wrapper->labels, label_id, &label_str);
+  return label_str;
+}
+
+int crfsuite_model_num_attrs(CrfSuiteModel *wrapper) {
+  if (!wrapper || !wrapper->attrs)
+    return 0;
+  return wrapper->attrs->num(wrapper->attrs);
+}
+
+const char *crfsuite_model_attr(CrfSuiteModel *wrapper, int attr_id) {
+  const char *attr_str = NULL;
+
+  if (!wrapper || !wrapper->attrs)
+    return NULL;
+  wrapper->attrs->to_string(wrapper->attrs, attr_id, &attr_str);
+  return attr_str;
+}
+
+int crfsuite_model_attr_id(CrfSuiteModel *wrapper, const char *attr) {
+  int aid;
+
+  if (!wrapper || !wrapper->attrs)
+    return -1;
+  aid = wrapper->attrs->to_id(wrapper->attrs, attr);
+  return aid < 0 ? -1 : aid;
+}
+
+int crfsuite_model_set_state_cache(CrfSuiteModel *wrapper, size_t max_bytes) {
+  StateCache *cache;
+  uint32_t num_entries = STATE_CACHE_WAYS;
+  size_t entry_size;
+
+  if (!wrapper)
+    return -1;
+  state_cache_free(wrapper->state_cache);
+  wrapper->state_cache = NULL;
+
+  /* A multiple of the row's alignment, so every entry's row is aligned */
+  entry_size = offsetof(StateCacheEntry, row) +
+               crfsuite_model_num_labels(wrapper) * sizeof(floatval_t);
+  if (max_bytes / entry_size < STATE_CACHE_WAYS)
+    return 0;
+  while ((size_t)num_entries * 2 <= max_bytes / entry_size &&
+         num_entries < (1u << 30))
+    num_entries *= 2;
+
+  cache = malloc(sizeof(StateCache));
+  if (!cache)
+    return -1;
+  cache->entries = calloc(num_entries, entry_size);
+  if (!cache->entries) {
+    free(cache);
+    return -1;
+  }
+  cache->entry_size = entry_size;
+  cache->mask = num_entries - 1;
+  cache->clock = 0;
+  cache->hits = 0;
+  cache->misses = 0;
+  wrapper->state_cache = cache;
+  return 0;
+}
+
+void crfsuite_model_state_cache_take_counts(CrfSuiteModel *wrapper,
+                                            uint64_t *hits, uint64_t *misses) {
+  StateCache *cache = wrapper ? wrapper->state_cache : NULL;
+
+  *hits = cache ? cache->hits : 0;
+  *misses = cache ? cache->misses : 0;
+  if (cache) {
+    cache->hits = 0;
+    cache->misses = 0;
+  }
+}
@@ -2,17 +2,28 @@
 #define CRFSUITE_WRAPPER_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 /* Opaque struct to hide crfsuite details from consumers */
 typedef struct CrfSuiteModel CrfSuiteModel;
 
+/*
+ * Most features an item can have; the feature extractor emits at most eight
+ * per token.
+ */
+#define MAX_ITEM_FEATURES 8
+
 /*
  * Represents a single item in a sequence to be tagged.
- * Contains an array of features (strings).
+ * Contains an array of features (strings), which the item does not own, and
+ * features already resolved to the model's attribute ids, which skip the
+ * attribute dictionary lookup. An item may have both.
  */
 typedef struct {
-  char **features;
+  const char *features[MAX_ITEM_FEATURES];
   int num_features;
+  int attr_ids[MAX_ITEM_FEATURES];
+  int num_attr_ids;
 } CrfSuiteItem;
 
 /*
@@ -36,6 +47,99 @@ CrfSuiteModel *crfsuite_model_create(const char *filename);
 int crfsuite_model_tag(CrfSuiteModel *model, CrfSuiteItem *items, int num_items,
                        char ***labels_out);
 
+/*
+ * Nanoseconds spent in each step of crfsuite_model_tag_ids().
+ */
+typedef struct {
+  uint64_t attr_lookup_ns; /* feature strings to attribute ids */
+  uint64_t state_score_ns; /* tagger->set(): per-token state scores */
+  uint64_t viterbi_ns;
+} CrfSuiteTagTimings;
+
+/*
+ * Tags a sequence of items, writing the label id of each item into
+ * label_ids_out (caller-allocated, num_items long). Returns 0 on success.
+ * Label ids index the model's label dictionary; see crfsuite_model_label().
+ * If timings is not NULL, the time spent in each step is added to it.
+ */
+int crfsuite_model_tag_ids(CrfSuiteModel *model, CrfSuiteItem *items,
+                           int num_items, int *label_ids_out,
+                           CrfSuiteTagTimings *timings);
+
+/*
+ * Tags num_seqs sequences at once; sequence k has num_items[k] items and its
+ * label ids are written to label_ids_out[k]. Sequences that end with the same
+ * items (a common city, state and ZIP code, say) share the state scores and
+ * decoding work of those items, which is done once for the batch. If
+ * num_scored is not NULL, it receives the number of distinct items whose
+ * state scores were computed. Returns 0 on success.
+ */
+int crfsuite_model_tag_batch(CrfSuiteModel *model, CrfSuiteItem *const *items,
+                             const int *num_items, int num_seqs,
+                             int *const *label_ids_out,
+                             CrfSuiteTagTimings *timings, int *num_scored);
+
+/*
+ * Intermediate results of a tagging run, for diagnostics. The arrays are
+ * allocated by the caller.
+ */
+typedef struct {
+  int *resolved_features; /* per item: features known to the model */
+  double *state_scores;   /* num_items x num_labels, row-major */
+  double viterbi_score;   /* score of the best label sequence */
+} CrfSuiteTagDetails;
+
+/*
+ * Like crfsuite_model_tag_ids(), and also fills in details.
+ */
+int crfsuite_model_explain(CrfSuiteModel *model, CrfSuiteItem *items,
+                           int num_items, int *label_ids_out,
+                           CrfSuiteTagTimings *timings,
+                           CrfSuiteTagDetails *details);
+
+/*
+ * Number of distinct labels in the model.
+ */
+int crfsuite_model_num_labels(CrfSuiteModel *model);
+
+/*
+ * Returns the label string for a label id. The string is owned by the model
+ * and must not be freed.
+ */
+const char *crfsuite_model_label(CrfSuiteModel *model, int label_id);
+
+/*
+ * Number of distinct attributes (feature strings) in the model.
+ */
+int crfsuite_model_num_attrs(CrfSuiteModel *model);
+
+/*
+ * Returns the attribute string for an attribute id, owned by the model like
+ * label strings.
+ */
+const char *crfsuite_model_attr(CrfSuiteModel *model, int attr_id);
+
+/*
+ * Returns the attribute id of a feature string, or -1 if the model does not
+ * know it.
+ */
+int crfsuite_model_attr_id(CrfSuiteModel *model, const char *attr);
+
+/*
+ * Gives the model a cache of up to max_bytes of state-score rows, replacing
+ * the one it had; 0 removes it. Items whose attribute ids the cache has seen,
+ * in the same order, take their row from it instead of summing feature
+ * weights. crfsuite_model_explain() does not use it. Returns -1 if out of
+ * memory, leaving the model without a cache.
+ */
+int crfsuite_model_set_state_cache(CrfSuiteModel *model, size_t max_bytes);
+
+/*
+ * Returns the numbers of state cache hits and misses since the last call.
+ */
+void crfsuite_model_state_cache_take_counts(CrfSuiteModel *model,
+                                            uint64_t *hits, uint64_t *misses);
+
 /*
  * Frees the model.
  */
@@ -0,0 +1,201 @@
+#include "fast_path.h"
+#include "usps_tables.h"
+#include <string.h>
+
+/* Model labels of the components, indexed by FastPathComponent */
+static const char *const component_labels[NUM_FAST_PATH_COMPONENTS] = {
+    "AddressNumber",
+    "StreetNamePreDirectional",
+    "StreetName",
+    "StreetNamePostType",
+    "StreetNamePostDirectional",
+    "PlaceName",
+    "StateName",
+    "ZipCode",
+};
+
+/*
+ * Shapes of a token, as bits: a token has every shape it fits. A street name
+ * word is a word that is neither a directional nor a street type, or an
+ * ordinal such as 42nd, so that where a street name ends is never in doubt.
+ */
+enum {
+  SHAPE_NUMBER = 1 << 0,
+  SHAPE_ZIP = 1 << 1,
+  SHAPE_COMMA = 1 << 2,
+  SHAPE_WORD = 1 << 3,
+  SHAPE_NAME = 1 << 4,
+  SHAPE_DIRECTIONAL = 1 << 5,
+  SHAPE_STREET_TYPE = 1 << 6,
+  SHAPE_STATE = 1 << 7,
+};
+
+/* Longest run of digits taken for an address number */
+#define MAX_NUMBER_LEN 6
+
+static int token_shape(const char *tok, int len) {
+  int digits = 0;
+  int letters = 0;
+  int shape = 0;
+  int i;
+
+  if (len == 1 && tok[0] == ',')
+    return SHAPE_COMMA;
+  for (i = 0; i < len; i++) {
+    char c = tok[i];
+
+    if (c >= '0' && c <= '9' && letters == 0)
+      digits++;
+    else if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
+      letters++;
+    else
+      return 0;
+  }
+
+  if (letters == 0) {
+    if (digits <= MAX_NUMBER_LEN)
+      shape |= SHAPE_NUMBER;
+    if (digits == 5)
+      shape |= SHAPE_ZIP;
+    return shape;
+  }
+  if (digits > 0) {
+    /* Ordinals only: 1st, 22nd, 103rd, 42th */
+    char a = tok[digits] | 0x20; /* ASCII lowercase */
+    char b = letters == 2 ? tok[digits + 1] | 0x20 : 0;
+
+    if ((a == 's' && b == 't') || (a == 'n' && b == 'd') ||
+        (a == 'r' && b == 'd') || (a == 't' && b == 'h'))
+      return SHAPE_NAME;
+    return 0;
+  }
+
+  shape = SHAPE_WORD;
+  if (perfect_hash_lookup(&usps_directionals, tok, len))
+    shape |= SHAPE_DIRECTIONAL;
+  if (perfect_hash_lookup(&usps_street_suffixes, tok, len))
+    shape |= SHAPE_STREET_TYPE;
+  if (len == 2 && perfect_hash_lookup(&usps_state_codes, tok, len))
+    shape |= SHAPE_STATE;
+  if (!(shape & (SHAPE_DIRECTIONAL | SHAPE_STREET_TYPE)))
+    shape |= SHAPE_NAME;
+  return shape;
+}
+
+/*
+ * The automaton. Each state lists the token shapes it accepts next, in
+ * order of preference, with the state and component they lead to. An
+ * address is canonical if its tokens lead from START to ZIP_CODE.
+ */
+typedef enum {
+  STATE_START,
+  STATE_ADDRESS_NUMBER,
+  STATE_PRE_DIRECTIONAL,
+  STATE_STREET_NAME,
+  STATE_POST_TYPE,
+  STATE_POST_DIRECTIONAL,
+  STATE_STREET_COMMA,
+  STATE_PLACE_NAME,
+  STATE_PLACE_COMMA,
+  STATE_STATE_NAME,
+  STATE_ZIP_CODE,
+  NUM_STATES
+} FastPathState;
+
+/* Component of a comma: that of the token before it */
+#define COMPONENT_PREVIOUS (-1)
+
+typedef struct {
+  int shape;
+  FastPathState next;
+  int component;
+} Transition;
+
+#define MAX_TRANSITIONS 2
+
+static const Transition transitions[NUM_STATES][MAX_TRANSITIONS] = {
+    [STATE_START] = {{SHAPE_NUMBER, STATE_ADDRESS_NUMBER,
+                      FAST_PATH_ADDRESS_NUMBER}},
+    [STATE_ADDRESS_NUMBER] = {{SHAPE_DIRECTIONAL, STATE_PRE_DIRECTIONAL,
+                               FAST_PATH_PRE_DIRECTIONAL},
+                              {SHAPE_NAME, STATE_STREET_NAME,
+                               FAST_PATH_STREET_NAME}},
+    [STATE_PRE_DIRECTIONAL] = {{SHAPE_NAME, STATE_STREET_NAME,
+                                FAST_PATH_STREET_NAME}},
+    [STATE_STREET_NAME] = {{SHAPE_NAME, STATE_STREET_NAME,
+                            FAST_PATH_STREET_NAME},
+                           {SHAPE_STREET_TYPE, STATE_POST_TYPE,
+                            FAST_PATH_POST_TYPE}},
+    [STATE_POST_TYPE] = {{SHAPE_DIRECTIONAL, STATE_POST_DIRECTIONAL,
+                          FAST_PATH_POST_DIRECTIONAL},
+                         {SHAPE_COMMA, STATE_STREET_COMMA,
+                          COMPONENT_PREVIOUS}},
+    [STATE_POST_DIRECTIONAL] = {{SHAPE_COMMA, STATE_STREET_COMMA,
+                                 COMPONENT_PREVIOUS}},
+    [STATE_STREET_COMMA] = {{SHAPE_WORD, STATE_PLACE_NAME,
+                             FAST_PATH_PLACE_NAME}},
+    [STATE_PLACE_NAME] = {{SHAPE_WORD, STATE_PLACE_NAME,
+                           FAST_PATH_PLACE_NAME},
+                          {SHAPE_COMMA, STATE_PLACE_COMMA,
+                           COMPONENT_PREVIOUS}},
+    [STATE_PLACE_COMMA] = {{SHAPE_STATE, STATE_STATE_NAME,
+                            FAST_PATH_STATE_NAME}},
+    [STATE_STATE_NAME] = {{SHAPE_ZIP, STATE_ZIP_CODE, FAST_PATH_ZIP_CODE}},
+};
+
+/* Most tokens a state may take in a row; longer runs are left to the CRF */
+static const int max_run[NUM_STATES] = {
+    [STATE_STREET_NAME] = 4,
+    [STATE_PLACE_NAME] = 3,
+};
+
+int fast_path_init(FastPath *fp, CrfSuiteModel *model) {
+  int num_labels = crfsuite_model_num_labels(model);
+  int c, i;
+
+  for (c = 0; c < NUM_FAST_PATH_COMPONENTS; c++) {
+    fp->label_ids[c] = -1;
+    for (i = 0; i < num_labels; i++) {
+      const char *lbl = crfsuite_model_label(model, i);
+
+      if (lbl && strcmp(lbl, component_labels[c]) == 0) {
+        fp->label_ids[c] = i;
+        break;
+      }
+    }
+    if (fp->label_ids[c] < 0)
+      return -1;
+  }
+  return 0;
+}
+
+int fast_path_tag(const FastPath *fp, const char *input,
+                  const TokenSpan *spans, int num_tokens, int *label_ids) {
+  FastPathState state = STATE_START;
+  int run = 0;
+  int i;
+
+  for (i = 0; i < num_tokens; i++) {
+    int shape = token_shape(input + spans[i].offset, spans[i].length);
+    const Transition *t = NULL;
+    int k;
+
+    for (k = 0; k < MAX_TRANSITIONS; k++) {
+      if (transitions[state][k].shape & shape) {
+        t = &transitions[state][k];
+        break;
+      }
+    }
+    if (t == NULL)
+      return 0;
+
+    run = t->next == state ? run + 1 : 1;
+    if (max_run[t->next] > 0 && run > max_run[t->next])
+      return 0;
+    state = t->next;
+    label_ids[i] = t->component == COMPONENT_PREVIOUS
+                       ? label_ids[i - 1]
+                       : fp->label_ids[t->component];
+  }
+  return state == STATE_ZIP_CODE;
+}
@@ -0,0 +1,54 @@
+/*
+ * fast_path.h - labels canonical addresses by rule
+ *
+ * Most addresses in bulk data have the same few shapes: "123 N Main St,
+ * Springfield, IL 62701". The fast path recognizes these with a small
+ * automaton over token shapes (numbers, words, USPS directionals, street
+ * types and state codes) and labels them as the usaddress training data
+ * would. The bundled model does not always agree, so the labels are only
+ * checked against the CRF's (pg_usaddress.fast_path = verify), never
+ * returned in their place.
+ *
+ * Plain C, shared by the PostgreSQL glue and the test harnesses.
+ */
+
+#ifndef FAST_PATH_H
+#define FAST_PATH_H
+
+#include "crfsuite_wrapper.h"
+#include "feature_extractor.h"
+
+/* The address components the fast path assigns */
+typedef enum {
+  FAST_PATH_ADDRESS_NUMBER,
+  FAST_PATH_PRE_DIRECTIONAL,
+  FAST_PATH_STREET_NAME,
+  FAST_PATH_POST_TYPE,
+  FAST_PATH_POST_DIRECTIONAL,
+  FAST_PATH_PLACE_NAME,
+  FAST_PATH_STATE_NAME,
+  FAST_PATH_ZIP_CODE,
+  NUM_FAST_PATH_COMPONENTS
+} FastPathComponent;
+
+/* A model's label ids for the components */
+typedef struct {
+  int label_ids[NUM_FAST_PATH_COMPONENTS];
+} FastPath;
+
+/*
+ * Looks up the components' labels in model. Returns 0 on success, or -1 if
+ * the model lacks one of them, in which case the fast path cannot be used.
+ */
+int fast_path_init(FastPath *fp, CrfSuiteModel *model);
+
+/*
+ * If the tokens of input form a canonical address, writes the label id of
+ * each token (a comma takes the label of the token before it) to label_ids,
+ * which is num_tokens long, and returns 1. Otherwise returns 0, leaving
+ * label_ids undefined.
+ */
+int fast_path_tag(const FastPath *fp, const char *input,
+                  const TokenSpan *spans, int num_tokens, int *label_ids);
+
+#endif
@@ -1,346 +1,853 @@
 #include "feature_extractor.h"
+#include "unicode_classes.h"
+#include "usps_tables.h"
 #include <ctype.h>
 #include <regex.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 // Regex for tokenization: split by spaces and punctuation, keeping punctuation?
 // Python usaddress uses: re.findall(r'\w+|[^\w\s]+', text, re.UNICODE)
 // In C, we can use simple parsing logic.
 
-static char *strdup_range(const char *start, const char *end) {
-  long len = end - start;
-  char *dest = malloc(len + 1);
-  if (dest) {
-    memcpy(dest, start, len);
-    dest[len] = '\0';
+/* Longest feature string, including the NUL */
+#define MAX_FEATURE_LEN 256
+
+// Adds a feature whose string is a constant
+static void add_feature(CrfSuiteItem *item, const char *name) {
+  if (item->num_features < MAX_ITEM_FEATURES)
+    item->features[item->num_features++] = name;
+}
+
+// Adds a feature already resolved to a model attribute id
+static void add_attr_id(CrfSuiteItem *item, int attr_id) {
+  if (item->num_attr_ids < MAX_ITEM_FEATURES)
+    item->attr_ids[item->num_attr_ids++] = attr_id;
+}
+
+// Adds prefix followed by val, written to the feature text at *text
+static void add_value_feature(CrfSuiteItem *item, char **text,
+                              const char *prefix, const char *val,
+                              size_t val_len) {
+  char *dst = *text;
+  size_t prefix_len = strlen(prefix);
+  size_t len = prefix_len + val_len;
+
+  if (len > MAX_FEATURE_LEN - 1)
+    len = MAX_FEATURE_LEN - 1;
+  memcpy(dst, prefix, prefix_len);
+  memcpy(dst + prefix_len, val, len - prefix_len);
+  dst[len] = '\0';
+  *text = dst + len + 1;
+  add_feature(item, dst);
+}
+
+/*
+ * Characters.
+ *
+ * Input is read as UTF-8, and each character is classified as Python sees it
+ * (see unicode_classes.h), unless the caller says it is in another encoding.
+ * Then every byte from 0x80 up is taken for an uncased letter of its own:
+ * PostgreSQL server encodings never use ASCII bytes inside a multibyte
+ * character, so tokens still end at character boundaries.
+ */
+
+// Longest UTF-8 lowercase form of a character, in bytes
+#define MAX_LOWER_LEN 4
+
+static CharClass unicode_char_class(uint32_t cp) {
+  int lo = 0;
+  int hi = sizeof(unicode_char_ranges) / sizeof(unicode_char_ranges[0]) - 1;
+
+  // Find the last range starting at or before cp; cp is at least 0x80
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (unicode_char_ranges[mid].first <= cp)
+      lo = mid;
+    else
+      hi = mid - 1;
   }
-  return dest;
+  return unicode_char_ranges[lo].cls;
 }
 
-// Simple list of directions/suffixes for features
-static int is_direction(const char *w) {
-  const char *dirs[] = {"N",  "S",     "E",     "W",    "NE",   "NW", "SE",
-                        "SW", "NORTH", "SOUTH", "EAST", "WEST", NULL};
-  for (int i = 0; dirs[i]; i++) {
-    if (strcasecmp(w, dirs[i]) == 0)
-      return 1;
+// Properties of cp, which is at least 0x80, and the offset to its lowercase
+static int unicode_char_props(uint32_t cp, int32_t *lower_delta) {
+  int lo = 0;
+  int hi = sizeof(unicode_case_ranges) / sizeof(unicode_case_ranges[0]) - 1;
+
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (unicode_case_ranges[mid].first <= cp)
+      lo = mid;
+    else
+      hi = mid - 1;
   }
-  return 0;
+  *lower_delta = unicode_case_ranges[lo].lower_delta;
+  return unicode_case_ranges[lo].props;
 }
 
-// Add more robust logic as needed
-static int is_digit_str(const char *w) {
-  for (; *w; w++) {
-    if (!isdigit(*w))
+/*
+ * Decodes the UTF-8 character at s[i] into *cp. Returns its length in bytes,
+ * or 0 if s[i] does not start a valid sequence.
+ */
+static int utf8_decode(const unsigned char *s, int i, int input_len,
+                       uint32_t *cp) {
+  unsigned char c = s[i];
+  int n;
+
+  if (c < 0x80) {
+    *cp = c;
+    return 1;
+  }
+  if (c >= 0xC2 && c <= 0xDF) {
+    n = 2;
+    *cp = c & 0x1F;
+  } else if (c >= 0xE0 && c <= 0xEF) {
+    n = 3;
+    *cp = c & 0x0F;
+  } else if (c >= 0xF0 && c <= 0xF4) {
+    n = 4;
+    *cp = c & 0x07;
+  } else {
+    return 0;
+  }
+  if (i + n > input_len)
+    return 0;
+  for (int k = 1; k < n; k++) {
+    if ((s[i + k] & 0xC0) != 0x80)
       return 0;
+    *cp = (*cp << 6) | (s[i + k] & 0x3F);
   }
-  return 1;
+  return n;
 }
 
-static void add_feature(CrfSuiteItem *item, const char *fmt, const char *val) {
-  char **new_features =
-      realloc(item->features, (item->num_features + 1) * sizeof(char *));
-  if (!new_features) {
-    /* Memory allocation failed - we can't add this feature */
-    return;
+// Writes cp as UTF-8 to out and returns its length
+static int utf8_encode(uint32_t cp, char *out) {
+  if (cp < 0x80) {
+    out[0] = cp;
+    return 1;
   }
-  item->features = new_features;
-
-  char buf[256];
-  if (val)
-    snprintf(buf, sizeof(buf), fmt, val);
-  else
-    snprintf(buf, sizeof(buf), "%s", fmt);
-  item->features[item->num_features++] = strdup(buf);
+  if (cp < 0x800) {
+    out[0] = 0xC0 | (cp >> 6);
+    out[1] = 0x80 | (cp & 0x3F);
+    return 2;
+  }
+  if (cp < 0x10000) {
+    out[0] = 0xE0 | (cp >> 12);
+    out[1] = 0x80 | ((cp >> 6) & 0x3F);
+    out[2] = 0x80 | (cp & 0x3F);
+    return 3;
+  }
+  out[0] = 0xF0 | (cp >> 18);
+  out[1] = 0x80 | ((cp >> 12) & 0x3F);
+  out[2] = 0x80 | ((cp >> 6) & 0x3F);
+  out[3] = 0x80 | (cp & 0x3F);
+  return 4;
 }
 
-static void normalize_token(const char *input, char *output, size_t max_len) {
-  // Logic matches:
-  // 1. token_clean = re.sub(r'(^[\W]*|[\W]*$)', '', token)
-  // 2. token_abbrev = re.sub(r'[.]', '', token_clean.lower())
+// Class of the character at s[i], setting *len to its length in bytes
+static CharClass char_class_at(const unsigned char *s, int i, int input_len,
+                               int utf8, int *len) {
+  uint32_t cp;
+
+  *len = 1;
+  if (s[i] < 0x80)
+    return ascii_char_class[s[i]];
+  if (!utf8)
+    return CHAR_WORD;
+  *len = utf8_decode(s, i, input_len, &cp);
+  if (*len == 0) {
+    // A byte that does not start a valid sequence is punctuation of its own
+    *len = 1;
+    return CHAR_PUNCT;
+  }
+  return unicode_char_class(cp);
+}
 
-  // 1. Strip leading non-alphanumeric
-  const char *start = input;
-  while (*start && !isalnum((unsigned char)*start)) {
-    start++;
+/*
+ * Properties (CHAR_IS_*) of the character at s[i], setting *len to its length
+ * in bytes. Its lowercase form is written to lower, which has room for
+ * MAX_LOWER_LEN bytes, and its length to *lower_len.
+ */
+static int char_props_at(const unsigned char *s, int i, int input_len,
+                         int utf8, int *len, char *lower, int *lower_len) {
+  unsigned char c = s[i];
+  int32_t delta;
+  uint32_t cp;
+  int props;
+
+  *len = 1;
+  *lower_len = 1;
+  lower[0] = c;
+  if (c < 0x80) {
+    if (c >= 'A' && c <= 'Z')
+      lower[0] = c - 'A' + 'a';
+    return ascii_char_props[c];
+  }
+  if (!utf8)
+    return CHAR_IS_ALPHA;
+  *len = utf8_decode(s, i, input_len, &cp);
+  if (*len == 0) {
+    *len = 1;
+    return 0;
   }
 
-  // If all non-alnum, result is empty?
-  // Python: valid for '&', '#', '½' to be kept?
-  // "if token in ('&', '#', '½'): token_clean = token"
-  // For now, let's assume standard words.
-  // If *start is null, it means the token was all punctuation.
-  // In Python: re.sub(r'(^[\W]*|[\W]*$)', '', token) results in empty string if
-  // all punctuation (e.g. ","). But wait! tokenFeatures check: "if not is_digit
-  // and token_abbrev:" If empty, it doesn't add 'word='? Yes. "if not is_digit
-  // and token_abbrev:"
-
-  if (!*start) {
-    if (strchr("&@#", *input)) { // minimal exception list for now?
-      // Actually, let's stick to the stripping logic.
-      // If extracted token is ",", result is empty.
+  props = unicode_char_props(cp, &delta);
+  for (size_t k = 0; k < sizeof(unicode_long_lowercase) /
+                             sizeof(unicode_long_lowercase[0]);
+       k++) {
+    if (unicode_long_lowercase[k].cp == cp) {
+      *lower_len = strlen(unicode_long_lowercase[k].lower);
+      memcpy(lower, unicode_long_lowercase[k].lower, *lower_len);
+      return props;
     }
   }
+  *lower_len = utf8_encode(cp + delta, lower);
+  return props;
+}
+
+/*
+ * What the features of a token and of its neighbours need to know about it.
+ * Computed once per token.
+ */
+typedef struct {
+  // token_abbrev: the clean token, lowercased, periods removed
+  char norm[MAX_FEATURE_LEN];
+  int norm_len;
+  int is_upper;  // token_clean.isupper() and token_clean.isalpha()
+  int is_title;  // token_clean[0].isupper()
+  int has_digit; // any(c.isdigit() for c in token_clean)
+  int is_digit;  // token_abbrev.isdigit()
+  int is_direction;
+  int known; // VOCAB_* templates the model has norm under
+  // With a token cache: the attribute ids of norm's word=, prev_word= and
+  // next_word= features, -1 where the model lacks one
+  int resolved;
+  int attr_ids[3];
+} TokenInfo;
+
+/*
+ * The vocabulary is an open-addressing hash set of words, each with the
+ * templates it occurs under. The words are kept in one arena.
+ */
+#define VOCAB_WORD 1
+#define VOCAB_PREV_WORD 2
+#define VOCAB_NEXT_WORD 4
+#define VOCAB_ALL (VOCAB_WORD | VOCAB_PREV_WORD | VOCAB_NEXT_WORD)
+
+/*
+ * Longer words may be cut short in their features (see MAX_FEATURE_LEN), so
+ * they are never looked up and never left out.
+ */
+#define VOCAB_MAX_WORD_LEN 200
+
+typedef struct {
+  uint32_t hash;
+  uint32_t offset; // of the word in the arena
+  uint16_t len;    // 0 in an empty slot
+  uint8_t templates;
+} VocabSlot;
+
+struct FeatureVocab {
+  VocabSlot *slots;
+  uint32_t mask; // number of slots - 1
+  char *arena;
+  size_t arena_used;
+  size_t arena_size;
+  int incomplete; // a word could not be added, so nothing is left out
+};
+
+// In the order of TokenInfo.attr_ids
+static const struct {
+  const char *prefix;
+  size_t len;
+  int bit;
+} vocab_templates[] = {
+    {"word=", 5, VOCAB_WORD},
+    {"prev_word=", 10, VOCAB_PREV_WORD},
+    {"next_word=", 10, VOCAB_NEXT_WORD},
+};
+
+// FNV-1a, computed a byte at a time as describe_token() builds the word
+#define VOCAB_HASH_INIT 2166136261u
+#define VOCAB_HASH_STEP(h, c) (((h) ^ (unsigned char)(c)) * 16777619u)
+
+static uint32_t vocab_hash(const char *word, int len) {
+  uint32_t h = VOCAB_HASH_INIT;
+
+  for (int i = 0; i < len; i++)
+    h = VOCAB_HASH_STEP(h, word[i]);
+  return h;
+}
+
+// Slot holding word, or the empty slot where it would go
+static VocabSlot *vocab_slot(const FeatureVocab *vocab, const char *word,
+                             int len, uint32_t hash) {
+  for (uint32_t i = hash;; i++) {
+    VocabSlot *slot = &vocab->slots[i & vocab->mask];
+    if (slot->len == 0 ||
+        (slot->hash == hash && slot->len == len &&
+         memcmp(vocab->arena + slot->offset, word, len) == 0))
+      return slot;
+  }
+}
+
+FeatureVocab *feature_vocab_create(int max_attrs) {
+  FeatureVocab *vocab = malloc(sizeof(FeatureVocab));
+  uint32_t num_slots = 16;
 
-  // Find end
-  const char *end = start + strlen(start) - 1;
-  while (end >= start && !isalnum((unsigned char)*end)) {
-    end--;
+  if (!vocab)
+    return NULL;
+  // At most half full
+  while (num_slots < 2 * (uint32_t)max_attrs)
+    num_slots *= 2;
+  vocab->slots = calloc(num_slots, sizeof(VocabSlot));
+  vocab->mask = num_slots - 1;
+  vocab->arena_size = 4096;
+  vocab->arena = malloc(vocab->arena_size);
+  vocab->arena_used = 0;
+  vocab->incomplete = 0;
+  if (!vocab->slots || !vocab->arena) {
+    feature_vocab_free(vocab);
+    return NULL;
   }
+  return vocab;
+}
 
-  // 2. Lowercase and remove periods
-  size_t idx = 0;
-  for (const char *p = start; p <= end; p++) {
-    if (idx >= max_len - 1)
-      break;
-    if (*p == '.')
+void feature_vocab_add_attr(FeatureVocab *vocab, const char *attr) {
+  for (size_t t = 0; t < sizeof(vocab_templates) / sizeof(vocab_templates[0]);
+       t++) {
+    const char *word = attr + vocab_templates[t].len;
+    size_t len;
+    uint32_t hash;
+    VocabSlot *slot;
+
+    if (strncmp(attr, vocab_templates[t].prefix, vocab_templates[t].len) != 0)
       continue;
-    output[idx++] = tolower((unsigned char)*p);
+    len = strlen(word);
+    if (len == 0 || len > VOCAB_MAX_WORD_LEN)
+      return;
+    hash = vocab_hash(word, len);
+    slot = vocab_slot(vocab, word, len, hash);
+    if (slot->len == 0) {
+      if (vocab->arena_used + len > vocab->arena_size) {
+        char *arena = realloc(vocab->arena, 2 * vocab->arena_size);
+        if (!arena) {
+          vocab->incomplete = 1;
+          return;
+        }
+        vocab->arena = arena;
+        vocab->arena_size *= 2;
+      }
+      memcpy(vocab->arena + vocab->arena_used, word, len);
+      slot->hash = hash;
+      slot->offset = vocab->arena_used;
+      slot->len = len;
+      vocab->arena_used += len;
+    }
+    slot->templates |= vocab_templates[t].bit;
+    return;
   }
-  output[idx] = '\0';
 }
 
-static void generate_features(TokenFeatures *tf, TokenFeatures *prev,
-                              TokenFeatures *next) {
-  char *word = tf->token;
-  char norm[256];
-  char prev_norm[256];
-  char next_norm[256];
+void feature_vocab_free(FeatureVocab *vocab) {
+  if (vocab) {
+    free(vocab->slots);
+    free(vocab->arena);
+    free(vocab);
+  }
+}
 
-  normalize_token(word, norm, sizeof(norm));
+// Templates under which the model knows the word, whose hash is given
+static int vocab_templates_of(const FeatureVocab *vocab, const char *word,
+                              int len, uint32_t hash) {
+  if (!vocab || vocab->incomplete || len > VOCAB_MAX_WORD_LEN)
+    return VOCAB_ALL;
+  return vocab_slot(vocab, word, len, hash)->templates;
+}
 
-  CrfSuiteItem *item = &tf->features;
-  item->features = NULL;
-  item->num_features = 0;
+/*
+ * The token cache maps normalized words to what describe_token() would look
+ * up for them: the attribute ids of their word features and the flags that
+ * depend only on the normalized word. It is open-addressed with probing
+ * bounded to TOKEN_CACHE_WAYS slots; when all of them are taken, a new word
+ * replaces one of them, so slots are never emptied and a lookup can stop at
+ * the first empty one.
+ */
+#define TOKEN_CACHE_WAYS 4
+
+// Longer words are not cached
+#define TOKEN_CACHE_KEY_LEN 24
+
+typedef struct {
+  uint32_t hash;
+  int32_t attr_ids[3];
+  uint8_t len; // 0 in an empty slot
+  uint8_t is_direction;
+  char key[TOKEN_CACHE_KEY_LEN];
+} TokenCacheEntry;
+
+// Features whose string is a constant, resolved once per cache
+enum {
+  CONST_ISUPPER,
+  CONST_ISTITLE,
+  CONST_HASDIGIT,
+  CONST_ISDIGIT,
+  CONST_ISDIRECTION,
+  CONST_BOS,
+  CONST_EOS,
+  NUM_CONST_FEATURES
+};
+
+static const char *const const_features[NUM_CONST_FEATURES] = {
+    "word.isupper",     "word.istitle", "word.hasdigit", "word.isdigit",
+    "word.isdirection", "BOS",          "EOS",
+};
+
+struct TokenCache {
+  CrfSuiteModel *model;
+  TokenCacheEntry *entries;
+  uint32_t mask;  // number of entries - 1
+  uint32_t clock; // picks the slot a new word replaces
+  int const_ids[NUM_CONST_FEATURES];
+  uint64_t hits;
+  uint64_t misses;
+};
+
+TokenCache *token_cache_create(CrfSuiteModel *model, int max_entries) {
+  TokenCache *cache = malloc(sizeof(TokenCache));
+  uint32_t num_entries = TOKEN_CACHE_WAYS;
+
+  if (!cache)
+    return NULL;
+  while (num_entries < (uint32_t)max_entries && num_entries < (1u << 30))
+    num_entries *= 2;
+  cache->entries = calloc(num_entries, sizeof(TokenCacheEntry));
+  if (!cache->entries) {
+    free(cache);
+    return NULL;
+  }
+  cache->model = model;
+  cache->mask = num_entries - 1;
+  cache->clock = 0;
+  for (int f = 0; f < NUM_CONST_FEATURES; f++)
+    cache->const_ids[f] = crfsuite_model_attr_id(model, const_features[f]);
+  cache->hits = 0;
+  cache->misses = 0;
+  return cache;
+}
+
+void token_cache_free(TokenCache *cache) {
+  if (cache) {
+    free(cache->entries);
+    free(cache);
+  }
+}
 
-  // Basic features
-  // Python: if not is_digit and token_abbrev:
-  // features.append(f'word={token_abbrev}')
-  //         elif is_digit: features.append(f'word={token_abbrev}')
-
-  // Is digit check on the ABBREV (normalized) token
-  int is_digit = 1;
-  if (strlen(norm) == 0)
-    is_digit = 0;
-  for (char *p = norm; *p; p++) {
-    if (!isdigit((unsigned char)*p)) {
-      is_digit = 0;
+void token_cache_take_counts(TokenCache *cache, uint64_t *hits,
+                             uint64_t *misses) {
+  *hits = cache->hits;
+  *misses = cache->misses;
+  cache->hits = 0;
+  cache->misses = 0;
+}
+
+// Attribute id of prefix followed by word, a word short enough to cache
+static int resolve_word_attr(const TokenCache *cache, int template_index,
+                             const char *word, int len) {
+  char attr[sizeof("prev_word=") + TOKEN_CACHE_KEY_LEN];
+  size_t prefix_len = vocab_templates[template_index].len;
+
+  memcpy(attr, vocab_templates[template_index].prefix, prefix_len);
+  memcpy(attr + prefix_len, word, len);
+  attr[prefix_len + len] = '\0';
+  return crfsuite_model_attr_id(cache->model, attr);
+}
+
+/*
+ * Returns the cache entry of info->norm, whose hash is given, filling it in
+ * on a miss. The vocabulary, if any, saves looking up the attributes the
+ * model does not have.
+ */
+static const TokenCacheEntry *token_cache_get(TokenCache *cache,
+                                              const FeatureVocab *vocab,
+                                              const TokenInfo *info,
+                                              uint32_t hash) {
+  TokenCacheEntry *entry = NULL;
+  int known;
+
+  for (uint32_t i = 0; i < TOKEN_CACHE_WAYS; i++) {
+    entry = &cache->entries[(hash + i) & cache->mask];
+    if (entry->len == 0)
       break;
+    if (entry->hash == hash && entry->len == info->norm_len &&
+        memcmp(entry->key, info->norm, info->norm_len) == 0) {
+      cache->hits++;
+      return entry;
     }
   }
+  cache->misses++;
+  if (entry->len != 0)
+    entry = &cache->entries[(hash + cache->clock++ % TOKEN_CACHE_WAYS) &
+                            cache->mask];
+
+  known = vocab_templates_of(vocab, info->norm, info->norm_len, hash);
+  for (int t = 0; t < 3; t++)
+    entry->attr_ids[t] =
+        (known & vocab_templates[t].bit)
+            ? resolve_word_attr(cache, t, info->norm, info->norm_len)
+            : -1;
+  entry->is_direction =
+      perfect_hash_lookup(&direction_words, info->norm, info->norm_len) !=
+      NULL;
+  entry->hash = hash;
+  entry->len = info->norm_len;
+  memcpy(entry->key, info->norm, info->norm_len);
+  return entry;
+}
 
-  if (strlen(norm) > 0) {
-    add_feature(item, "word=%s", norm);
+// Whether the first character of s[i..end) that is not case-ignorable is cased
+static int cased_follows(const unsigned char *s, int i, int end) {
+  char lower[MAX_LOWER_LEN];
+  int n, lower_len, props;
+
+  for (; i < end; i += n) {
+    props = char_props_at(s, i, end, 1, &n, lower, &lower_len);
+    if (!(props & CHAR_IS_CASE_IGNORABLE))
+      return (props & CHAR_IS_CASED) != 0;
   }
+  return 0;
+}
 
-  // Casing
-  // Python:
-  // if token_clean.isupper() and token_clean.isalpha(): 'word.isupper'
-  // if token_clean and token_clean[0].isupper(): 'word.istitle'
-  // if any(c.isdigit() for c in token_clean): 'word.hasdigit'
-  // if is_digit: 'word.isdigit'
-
-  // Need token_clean (stripped but case preserved) for casing features?
-  // normalize_token does lowercasing. We need 'clean' version too.
-
-  // Let's replicate strict logic:
-
-  const char *clean_start = word;
-  while (*clean_start && !isalnum((unsigned char)*clean_start))
-    clean_start++;
-  const char *clean_end = clean_start + strlen(clean_start) - 1;
-  while (clean_end >= clean_start && !isalnum((unsigned char)*clean_end))
-    clean_end--;
-
-  // If clean is empty (e.g. ","), we skip casing?
-  // Python: re.sub(...) might return empty.
-
-  int clean_len =
-      (clean_end >= clean_start) ? (clean_end - clean_start + 1) : 0;
-
-  if (clean_len > 0) {
-    int all_upper = 1;
-    int has_digit_clean = 0; // naming to avoid conflict
-    int is_alpha = 1;
-
-    for (const char *p = clean_start; p <= clean_end; p++) {
-      if (!isupper((unsigned char)*p))
-        all_upper = 0;
-      if (isdigit((unsigned char)*p))
-        has_digit_clean = 1;
-      if (!isalpha((unsigned char)*p))
-        is_alpha = 0;
+static void describe_token(const char *word, int len, int utf8,
+                           const FeatureVocab *vocab, TokenCache *cache,
+                           TokenInfo *info) {
+  // Logic matches:
+  // 1. token_clean = re.sub(r'(^[\W]*|[\W]*$)', '', token)
+  // 2. token_abbrev = re.sub(r'[.]', '', token_clean.lower())
+  // with Python's character classes and case mappings. A token that is all
+  // punctuation (e.g. ",") has an empty token_clean and so gets no word= or
+  // casing features.
+  const unsigned char *s = (const unsigned char *)word;
+  char lower[MAX_LOWER_LEN];
+  int start = len;
+  int end = 0;
+  int is_alpha = 1;
+  int has_upper = 0;
+  int has_lower = 0; // a lowercase or titlecase character
+  int all_digit = 1;
+  int after_cased = 0; // the last character not case-ignorable was cased
+  int truncated = 0;
+  uint32_t hash = VOCAB_HASH_INIT;
+  int i, n, props, lower_len;
+
+  // token_clean is word[start..end)
+  for (i = 0; i < len; i += n) {
+    if (char_class_at(s, i, len, utf8, &n) == CHAR_WORD) {
+      if (start == len)
+        start = i;
+      end = i + n;
     }
-
-    if (all_upper && is_alpha)
-      add_feature(item, "word.isupper", NULL);
-    if (isupper((unsigned char)*clean_start))
-      add_feature(item, "word.istitle", NULL);
-    if (has_digit_clean)
-      add_feature(item, "word.hasdigit", NULL);
   }
 
-  if (is_digit)
-    add_feature(item, "word.isdigit", NULL);
-
-  // Direction (matches C: word.isdirection)
-  // Python uses normalized token for direction check
-  if (is_direction(norm))
-    add_feature(item, "word.isdirection", NULL);
-
-  // Ends with period (matches C: word.endswithperiod)
-  // Python: if token_clean and token_clean.endswith('.'):
-  // Wait, token_clean stripped trailing non-word chars! So it WON'T end with
-  // period unless regex kept it? Python regex: r'(^[\W]*|[\W]*$)'
-  // \W includes period. So periods are STRIPPED from clean.
-  // Wait.
-  // Python: token_clean = re.sub(r'(^[\W]*|[\W]*$)', '', token)
-  // If token is "St.", clean is "St". It does NOT end with period.
-  // So 'word.endswithperiod' is only added if token_clean ends with period?
-  // BUT token_clean STRIPS punctuation.
-  // Does \W match period? Yes.
-  // So `text.endswith('.')` logic in Python script:
-  // "if token_clean and token_clean.endswith('.'):"
-  // It seems this feature is effectively ALWAYS FALSE unless \W excludes
-  // period? In Python, \W matches [^a-zA-Z0-9_]. Period is \W. So token_clean
-  // strips periods. So `token_clean.endswith('.')` is impossible if stripped?
-  // UNLESS `re.sub` doesn't match the period?
-
-  // Wait, `re.sub(r'(^[\W]*|[\W]*$)', '', token)`
-  // If token is "St.", matches "." at end. Replaces with empty.
-  // Result "St".
-  // "St".endswith(".") is False.
-  // So `word.endswithperiod` is NEVER generated in Python script?
-  // Let me re-read Python script carefully.
-
-  // Line 136: if token_clean and token_clean.endswith('.'):
-
-  // Maybe I misunderstood regex.
-  // Anyway, I should match Python logic. If Python logic never generates it, I
-  // shouldn't either. Or maybe I should check the raw token? But Python script
-  // uses `token_clean`. I will check if raw token ends with period, just in
-  // case Python script intended that? No, strict adherence to script. If script
-  // has bug, I replicate bug to match model. But wait, what if `re` behaves
-  // differently? I'll skip endsWithPeriod unless I find evidence otherwise.
-  // Actually, wait. "St." -> "St".
-  // Maybe "St.." -> "St"?
-  // Yes.
-
-  // Wait, maybe \W does NOT include '.'? No, it does.
-
-  // Okay, maybe the user wants me to fix the Python script?
-  // But I am retraining with the Python script as is.
-  // So I must match it.
-
-  // Let's implement EXACT logic of Python script.
-  // If feature never fires, so be it.
-
-  // Wait, `word.endswithperiod` logic in C was checking `word`.
-  // I will skip it if clean logic implies it's gone.
-  // But actually, seeing `word.endswithperiod` in my C code suggests I thought
-  // it was important. I'll assume Python script "endswith" check is on `token`?
-  // "if token_clean and token_clean.endswith('.'):"
-
-  // Let's look at `is_direction`.
-
-  // Context features (prev/next word)
-  // Python: matches C: prev_word=%s or BOS
-  // Uses normalized abbrev.
-
-  if (prev) {
-    normalize_token(prev->token, prev_norm, sizeof(prev_norm));
-    if (strlen(prev_norm) > 0)
-      add_feature(item, "prev_word=%s", prev_norm);
-  } else {
-    add_feature(item, "BOS", NULL); // Beginning of String
+  info->norm_len = 0;
+  info->has_digit = 0;
+  info->is_title = 0;
+  for (i = start; i < end; i += n) {
+    props = char_props_at(s, i, end, utf8, &n, lower, &lower_len);
+    if (!(props & CHAR_IS_ALPHA))
+      is_alpha = 0;
+    if (props & CHAR_IS_UPPER)
+      has_upper = 1;
+    if (props & CHAR_IS_LOWER_OR_TITLE)
+      has_lower = 1;
+    if (props & CHAR_IS_DIGIT)
+      info->has_digit = 1;
+    if (i == start)
+      info->is_title = (props & CHAR_IS_UPPER) != 0;
+    // Python lowercases a capital sigma that ends a word to a final sigma
+    if (utf8 && n == 2 && s[i] == 0xCE && s[i + 1] == 0xA3 && after_cased &&
+        !cased_follows(s, i + n, end))
+      lower[1] = '\x82';
+    if (!(props & CHAR_IS_CASE_IGNORABLE))
+      after_cased = (props & CHAR_IS_CASED) != 0;
+    if (lower_len == 1 && lower[0] == '.')
+      continue;
+    if (!(props & CHAR_IS_DIGIT))
+      all_digit = 0;
+    // Characters are kept whole, so a long word is cut at one
+    if (truncated || info->norm_len + lower_len > MAX_FEATURE_LEN - 1) {
+      truncated = 1;
+      continue;
+    }
+    for (int k = 0; k < lower_len; k++) {
+      info->norm[info->norm_len++] = lower[k];
+      hash = VOCAB_HASH_STEP(hash, lower[k]);
+    }
   }
+  info->norm[info->norm_len] = '\0';
 
-  if (next) {
-    normalize_token(next->token, next_norm, sizeof(next_norm));
-    if (strlen(next_norm) > 0)
-      add_feature(item, "next_word=%s", next_norm);
-  } else {
-    add_feature(item, "EOS", NULL); // End of String
+  info->is_upper = start < end && has_upper && !has_lower && is_alpha;
+  info->is_digit = info->norm_len > 0 && all_digit;
+
+  info->resolved = 0;
+  if (cache && info->norm_len > 0 && info->norm_len <= TOKEN_CACHE_KEY_LEN) {
+    const TokenCacheEntry *entry = token_cache_get(cache, vocab, info, hash);
+
+    info->is_direction = entry->is_direction;
+    info->resolved = 1;
+    memcpy(info->attr_ids, entry->attr_ids, sizeof(info->attr_ids));
+    return;
   }
+
+  // Python uses the normalized token for the direction check
+  info->is_direction =
+      perfect_hash_lookup(&direction_words, info->norm, info->norm_len) !=
+      NULL;
+  info->known = vocab_templates_of(vocab, info->norm, info->norm_len, hash);
 }
 
-TokenFeatures *tokenize_and_extract_features(const char *input,
-                                             int *num_items) {
-  // 1. Tokenize
-  // Simple approach: Iterate string.
-  // If alphanumeric, consume until non-alphanumeric.
-  // If non-alphanumeric, consume one char? Or group punctuation?
-  // usaddress regex: \w+|[^\w\s]+
+// Adds a constant feature, by attribute id when there is a token cache
+static void add_const_feature(CrfSuiteItem *item, const TokenCache *cache,
+                              int feature) {
+  if (!cache)
+    add_feature(item, const_features[feature]);
+  else if (cache->const_ids[feature] >= 0)
+    add_attr_id(item, cache->const_ids[feature]);
+}
 
-  int cap = 16;
-  int count = 0;
-  TokenFeatures *result = malloc(cap * sizeof(TokenFeatures));
-  if (!result) {
-    *num_items = 0;
-    return NULL;
+// Adds the feature of template t (an index of vocab_templates) for a word
+static void add_word_feature(CrfSuiteItem *item, char **text,
+                             const TokenInfo *info, int t) {
+  if (info->norm_len == 0)
+    return;
+  if (info->resolved) {
+    if (info->attr_ids[t] >= 0)
+      add_attr_id(item, info->attr_ids[t]);
+  } else if (info->known & vocab_templates[t].bit) {
+    add_value_feature(item, text, vocab_templates[t].prefix, info->norm,
+                      info->norm_len);
   }
+}
 
-  const char *p = input;
-  while (*p) {
-    // Skip whitespace
-    if (isspace(*p)) {
-      p++;
-      continue;
+/*
+ * Features of a token, given the records of the token and its neighbours
+ * (NULL at either end of the sequence). The order matches the training
+ * script.
+ *
+ * The script also has a word.endswithperiod feature, but it tests
+ * token_clean, which never ends with a period, so it never fires and is not
+ * generated here either.
+ */
+static void generate_features(const TokenInfo *prev, const TokenInfo *cur,
+                              const TokenInfo *next, const TokenCache *cache,
+                              CrfSuiteItem *item, char **text) {
+  item->num_features = 0;
+  item->num_attr_ids = 0;
+
+  add_word_feature(item, text, cur, 0);
+  if (cur->is_upper)
+    add_const_feature(item, cache, CONST_ISUPPER);
+  if (cur->is_title)
+    add_const_feature(item, cache, CONST_ISTITLE);
+  if (cur->has_digit)
+    add_const_feature(item, cache, CONST_HASDIGIT);
+  if (cur->is_digit)
+    add_const_feature(item, cache, CONST_ISDIGIT);
+  if (cur->is_direction)
+    add_const_feature(item, cache, CONST_ISDIRECTION);
+
+  // Context features use the neighbours' normalized forms
+  if (!prev)
+    add_const_feature(item, cache, CONST_BOS); // Beginning of String
+  else
+    add_word_feature(item, text, prev, 1);
+
+  if (!next)
+    add_const_feature(item, cache, CONST_EOS); // End of String
+  else
+    add_word_feature(item, text, next, 2);
+}
+
+/*
+ * Tokenizing.
+ *
+ * Tokens are the matches of the usaddress regex \w+|[^\w\s]+: runs of word
+ * characters, and runs of characters that are neither word characters nor
+ * whitespace ("punctuation"). The classes follow Python's re module for the
+ * whole of Unicode, so "Peñasco" is one token, and '_' is a word character
+ * (see "Characters" above for other encodings).
+ *
+ * Token boundaries are where the class changes. The input is classified 16
+ * bytes at a time into word and whitespace bitmasks (with SSE2 where
+ * available), and a chunk with no change in it is skipped whole. Chunks
+ * holding non-ASCII bytes take the scalar path, which decodes UTF-8.
+ */
+#define CHUNK_SIZE 16
+
+typedef struct {
+  TokenSpan *spans;
+  int max_spans;
+  int count;
+  CharClass cls; // class of the current run; CHAR_SPACE outside tokens
+  int start;     // offset of the current run
+} Tokenizer;
+
+// Starts a run of class cls at offset pos, ending the current token if any
+static void tokenizer_switch(Tokenizer *tz, CharClass cls, int pos) {
+  if (tz->cls != CHAR_SPACE) {
+    if (tz->count < tz->max_spans) {
+      tz->spans[tz->count].offset = tz->start;
+      tz->spans[tz->count].length = pos - tz->start;
     }
+    tz->count++;
+  }
+  tz->cls = cls;
+  tz->start = pos;
+}
 
-    const char *start = p;
-    if (isalnum(*p)) {
-      while (*p && isalnum(*p))
-        p++;
-    } else {
-      // Punctuation/symbols: consume run of non-whitespace non-alnum?
-      // "Main St." -> "Main", "St", "."
-      // If regex is [^\w\s]+ then it groups punctuation.
-      while (*p && !isalnum(*p) && !isspace(*p))
-        p++;
+/*
+ * Classifies the 16 bytes at p. Returns the mask of non-ASCII bytes; when it
+ * is zero, sets the masks of word and whitespace bytes. Bit i is byte p[i].
+ */
+static uint32_t classify_chunk(const unsigned char *p, uint32_t *word,
+                               uint32_t *space) {
+#ifdef __SSE2__
+  __m128i v = _mm_loadu_si128((const __m128i *)p);
+  uint32_t high = _mm_movemask_epi8(v);
+  __m128i folded, w, sp;
+
+  if (high)
+    return high;
+
+  // All bytes are ASCII here, so signed comparisons order them correctly
+#define IN_RANGE(x, lo, hi)                                                    \
+  _mm_and_si128(_mm_cmpgt_epi8((x), _mm_set1_epi8((lo) - 1)),                  \
+                _mm_cmplt_epi8((x), _mm_set1_epi8((hi) + 1)))
+  folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+  w = _mm_or_si128(
+      _mm_or_si128(IN_RANGE(folded, 'a', 'z'), IN_RANGE(v, '0', '9')),
+      _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+  sp = _mm_or_si128(
+      _mm_or_si128(IN_RANGE(v, '\t', '\r'), IN_RANGE(v, 0x1C, 0x1F)),
+      _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+#undef IN_RANGE
+  *word = _mm_movemask_epi8(w);
+  *space = _mm_movemask_epi8(sp);
+  return 0;
+#else
+  uint32_t high = 0, w = 0, sp = 0;
+
+  for (int i = 0; i < CHUNK_SIZE; i++) {
+    if (p[i] >= 0x80)
+      high |= 1u << i;
+    else if (ascii_char_class[p[i]] == CHAR_WORD)
+      w |= 1u << i;
+    else if (ascii_char_class[p[i]] == CHAR_SPACE)
+      sp |= 1u << i;
+  }
+  *word = w;
+  *space = sp;
+  return high;
+#endif
+}
+
+int tokenize_spans(const char *input, int input_len, int utf8,
+                   TokenSpan *spans, int max_spans) {
+  const unsigned char *s = (const unsigned char *)input;
+  Tokenizer tz = {spans, max_spans, 0, CHAR_SPACE, 0};
+  unsigned char tail[CHUNK_SIZE];
+  int i = 0;
+
+  while (i < input_len) {
+    const unsigned char *chunk = s + i;
+    uint32_t word, space, punct, changes;
+
+    // Pad the last chunk with spaces, which end its last token where the
+    // input ends
+    if (input_len - i < CHUNK_SIZE) {
+      memset(tail, ' ', CHUNK_SIZE);
+      memcpy(tail, s + i, input_len - i);
+      chunk = tail;
     }
 
-    if (count >= cap) {
-      cap *= 2;
-      TokenFeatures *new_result = realloc(result, cap * sizeof(TokenFeatures));
-      if (!new_result) {
-        /* Memory allocation failed - clean up and return what we have */
-        *num_items = count;
-        return result;
+    if (classify_chunk(chunk, &word, &space) != 0) {
+      // Scalar path, to the end of the chunk or of the last character
+      // crossing it
+      int end = i + CHUNK_SIZE < input_len ? i + CHUNK_SIZE : input_len;
+      while (i < end) {
+        int len;
+        CharClass cls = char_class_at(s, i, input_len, utf8, &len);
+        if (cls != tz.cls)
+          tokenizer_switch(&tz, cls, i);
+        i += len;
       }
-      result = new_result;
+      continue;
     }
 
-    result[count].token = strdup_range(start, p);
-    result[count].features.features = NULL;
-    result[count].features.num_features = 0;
-    count++;
+    // Bit k of changes is set where byte k differs in class from the byte
+    // before it, carried in from the current run
+    punct = ~(word | space) & 0xFFFF;
+    changes = ((word ^ ((word << 1) | (tz.cls == CHAR_WORD))) |
+               (punct ^ ((punct << 1) | (tz.cls == CHAR_PUNCT)))) &
+              0xFFFF;
+    while (changes) {
+      int k = __builtin_ctz(changes);
+      uint32_t bit = 1u << k;
+      tokenizer_switch(&tz,
+                       (word & bit)    ? CHAR_WORD
+                       : (punct & bit) ? CHAR_PUNCT
+                                       : CHAR_SPACE,
+                       i + k);
+      changes &= changes - 1;
+    }
+    i += CHUNK_SIZE;
   }
+  if (tz.cls != CHAR_SPACE)
+    tokenizer_switch(&tz, CHAR_SPACE, input_len);
 
-  *num_items = count;
+  return tz.count;
+}
 
-  // 2. Extract features
-  for (int i = 0; i < count; i++) {
-    generate_features(&result[i], (i > 0) ? &result[i - 1] : NULL,
-                      (i < count - 1) ? &result[i + 1] : NULL);
+size_t span_features_size(const TokenSpan *spans, int num_items) {
+  // A token's normalized form appears in its own word= feature and in its
+  // neighbours' prev_word=/next_word=. Lowercasing makes it at most half as
+  // long again as the token: U+0130 and a few others take 3 bytes for 2.
+  size_t size = 0;
+  for (int i = 0; i < num_items; i++) {
+    size_t len = spans[i].length + spans[i].length / 2;
+    if (len > MAX_FEATURE_LEN)
+      len = MAX_FEATURE_LEN;
+    size += 3 * len + sizeof("word=") + sizeof("prev_word=") +
+            sizeof("next_word=");
   }
-
-  return result;
+  return size;
 }
 
-void free_token_features(TokenFeatures *items, int num_items) {
-  if (!items)
-    return;
+void extract_span_features(const char *input, const TokenSpan *spans,
+                           int num_items, int utf8, const FeatureVocab *vocab,
+                           TokenCache *cache, CrfSuiteItem *items,
+                           char *text) {
+  // Records of tokens i-1, i and i+1, in a ring indexed by position mod 3.
+  // Each token is described once, just before it is first needed as the
+  // next token.
+  TokenInfo window[3];
+
+  if (num_items > 0)
+    describe_token(input + spans[0].offset, spans[0].length, utf8, vocab,
+                   cache, &window[0]);
   for (int i = 0; i < num_items; i++) {
-    free(items[i].token);
-    for (int j = 0; j < items[i].features.num_features; j++) {
-      free(items[i].features.features[j]);
-    }
-    free(items[i].features.features);
+    if (i + 1 < num_items)
+      describe_token(input + spans[i + 1].offset, spans[i + 1].length, utf8,
+                     vocab, cache, &window[(i + 1) % 3]);
+    generate_features(i > 0 ? &window[(i + 2) % 3] : NULL, &window[i % 3],
+                      i + 1 < num_items ? &window[(i + 1) % 3] : NULL, cache,
+                      &items[i], &text);
   }
-  free(items);
 }
 
 // Wrapper for just features if needed, but tokenize_and_extract_features covers
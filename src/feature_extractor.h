@@ -19,21 +19,89 @@ CrfSuiteItem *extract_features(const char *input, int *num_items);
 void free_features(CrfSuiteItem *items, int num_items);
 
 /*
- * Standardizes a token (like to lower case, etc if needed for returns)
- * but primarily we just need tokens for the output.
- * We might need a function to get the raw tokens back if we construct the
- * result? Actually, the current design separates feature extraction (for model)
- * from tokenization (for result). We probably want `extract_features` to also
- * return the list of raw tokens so we can pair them with labels later.
+ * A token as a byte range of the tokenized input string.
  */
-
 typedef struct {
-  char *token;
-  CrfSuiteItem features;
-} TokenFeatures;
+  int offset;
+  int length;
+} TokenSpan;
+
+/*
+ * Splits input into tokens, writing up to max_spans of their spans into the
+ * caller's array. Returns the number of tokens in the input, which may be
+ * more than max_spans; the caller can then retry with a larger array. Token
+ * text is never copied.
+ *
+ * If utf8 is zero, input is in some other encoding whose multibyte
+ * characters are made of bytes from 0x80 up, as in every PostgreSQL server
+ * encoding; those bytes are then taken for uncased letters.
+ */
+int tokenize_spans(const char *input, int input_len, int utf8,
+                   TokenSpan *spans, int max_spans);
+
+/*
+ * Bytes of feature text that extract_span_features() may write for these
+ * tokens.
+ */
+size_t span_features_size(const TokenSpan *spans, int num_items);
+
+/*
+ * The words that occur in a model's word=, prev_word= and next_word=
+ * attributes. With it, extract_span_features() leaves out the features the
+ * model would ignore anyway, before formatting them.
+ */
+typedef struct FeatureVocab FeatureVocab;
+
+/*
+ * Creates an empty vocabulary with room for the words of up to max_attrs
+ * attributes. Returns NULL if out of memory.
+ */
+FeatureVocab *feature_vocab_create(int max_attrs);
+
+/*
+ * Adds the word of a model attribute, if it is one of the templates above.
+ * At most max_attrs attributes may be added.
+ */
+void feature_vocab_add_attr(FeatureVocab *vocab, const char *attr);
+
+void feature_vocab_free(FeatureVocab *vocab);
+
+/*
+ * A bounded cache from normalized token words to the model attribute ids of
+ * their word=, prev_word= and next_word= features. With it,
+ * extract_span_features() resolves the features of a recurring word with one
+ * probe instead of formatting three strings for the tagger to look up, and
+ * passes every feature to the tagger as an attribute id. The ids belong to
+ * one model.
+ */
+typedef struct TokenCache TokenCache;
+
+/*
+ * Creates an empty cache of at least max_entries words (rounded up to a
+ * power of two) for model. Returns NULL if out of memory.
+ */
+TokenCache *token_cache_create(CrfSuiteModel *model, int max_entries);
 
-TokenFeatures *tokenize_and_extract_features(const char *input, int *num_items);
+void token_cache_free(TokenCache *cache);
 
-void free_token_features(TokenFeatures *items, int num_items);
+/*
+ * Returns the numbers of cache hits and misses since the last call.
+ */
+void token_cache_take_counts(TokenCache *cache, uint64_t *hits,
+                             uint64_t *misses);
+
+/*
+ * Generates the model features of each token into items (num_items long).
+ * Feature strings are either constants or written to text, which must hold
+ * span_features_size() bytes. Nothing is allocated; both buffers belong to
+ * the caller. If vocab is not NULL, word features it does not list are not
+ * generated; if cache is not NULL, features are resolved to attribute ids
+ * through it. Either way the tagging result is the same. utf8 is as for
+ * tokenize_spans(); a cache must only see input of one kind.
+ */
+void extract_span_features(const char *input, const TokenSpan *spans,
+                           int num_items, int utf8, const FeatureVocab *vocab,
+                           TokenCache *cache, CrfSuiteItem *items,
+                           char *text);
 
 #endif
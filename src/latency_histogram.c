@@ -0,0 +1,150 @@
+#include "postgres.h"
+
+#include "port/atomics.h"
+#include "port/pg_bitutils.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+
+#include "latency_histogram.h"
+
+/*
+ * Buckets are log-linear, as in HdrHistogram: each power of two from
+ * 2^LATENCY_MIN_EXP ns up is split into LATENCY_SUB_BUCKETS equal buckets, so
+ * a bucket is at most 1/8 as wide as its lower bound. Bucket 0 holds
+ * everything faster than 2^LATENCY_MIN_EXP ns (about 1 us); the last bucket
+ * also takes everything slower than its upper bound (about 18 minutes).
+ */
+#define LATENCY_SUB_BITS 3
+#define LATENCY_SUB_BUCKETS (1 << LATENCY_SUB_BITS)
+#define LATENCY_MIN_EXP 10
+#define LATENCY_MAX_EXP 39
+
+#define LATENCY_EXPONENTS (LATENCY_MAX_EXP - LATENCY_MIN_EXP + 1)
+
+StaticAssertDecl(LATENCY_BUCKETS == 1 + LATENCY_EXPONENTS * LATENCY_SUB_BUCKETS,
+                 "LATENCY_BUCKETS does not match the bucket layout");
+
+typedef struct LatencyHistograms {
+  pg_atomic_uint64 counts[NUM_ENTRY_POINTS][LATENCY_TOKEN_CLASSES]
+                         [LATENCY_BUCKETS];
+} LatencyHistograms;
+
+/* Backend-local histograms, used when the library is not preloaded */
+static LatencyHistograms local_histograms;
+
+static LatencyHistograms *histograms = NULL;
+
+static void latency_histogram_init(LatencyHistograms *h) {
+  int e, c, b;
+
+  for (e = 0; e < NUM_ENTRY_POINTS; e++) {
+    for (c = 0; c < LATENCY_TOKEN_CLASSES; c++) {
+      for (b = 0; b < LATENCY_BUCKETS; b++)
+        pg_atomic_init_u64(&h->counts[e][c][b], 0);
+    }
+  }
+}
+
+void latency_histogram_shmem_request(void) {
+  RequestAddinShmemSpace(sizeof(LatencyHistograms));
+}
+
+void latency_histogram_shmem_startup(void) {
+  bool found;
+
+  LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
+  histograms = ShmemInitStruct("pg_usaddress latency histograms",
+                               sizeof(LatencyHistograms), &found);
+  if (!found)
+    latency_histogram_init(histograms);
+  LWLockRelease(AddinShmemInitLock);
+}
+
+static LatencyHistograms *get_histograms(void) {
+  if (histograms == NULL) {
+    latency_histogram_init(&local_histograms);
+    histograms = &local_histograms;
+  }
+  return histograms;
+}
+
+/*
+ * Token classes: 0 (calls that tag nothing, such as a batch of NULLs), 1-8,
+ * 9-16, 17-32, 33-64 and 65 or more tokens
+ */
+static int token_class_of(int num_tokens) {
+  int c;
+
+  if (num_tokens == 0)
+    return 0;
+  if (num_tokens <= 8)
+    return 1;
+  c = pg_leftmost_one_pos32((uint32)(num_tokens - 1)) - 1;
+  return Min(c, LATENCY_TOKEN_CLASSES - 1);
+}
+
+void latency_token_class_range(int token_class, int *min, int *max) {
+  if (token_class <= 1) {
+    *min = token_class;
+    *max = token_class == 0 ? 0 : 8;
+    return;
+  }
+  *min = (1 << (token_class + 1)) + 1;
+  *max = token_class == LATENCY_TOKEN_CLASSES - 1 ? -1 : 1 << (token_class + 2);
+}
+
+static int latency_bucket(uint64 elapsed_ns) {
+  int exp;
+  int sub;
+
+  if (elapsed_ns < (UINT64CONST(1) << LATENCY_MIN_EXP))
+    return 0;
+  exp = pg_leftmost_one_pos64(elapsed_ns);
+  if (exp > LATENCY_MAX_EXP)
+    return LATENCY_BUCKETS - 1;
+  sub = (elapsed_ns >> (exp - LATENCY_SUB_BITS)) & (LATENCY_SUB_BUCKETS - 1);
+  return 1 + (exp - LATENCY_MIN_EXP) * LATENCY_SUB_BUCKETS + sub;
+}
+
+void latency_bucket_bounds(int bucket, uint64 *lower, uint64 *upper) {
+  int exp;
+  int sub;
+
+  if (bucket == 0) {
+    *lower = 0;
+    *upper = UINT64CONST(1) << LATENCY_MIN_EXP;
+    return;
+  }
+  exp = LATENCY_MIN_EXP + (bucket - 1) / LATENCY_SUB_BUCKETS;
+  sub = (bucket - 1) % LATENCY_SUB_BUCKETS;
+  *lower = (uint64)(LATENCY_SUB_BUCKETS + sub) << (exp - LATENCY_SUB_BITS);
+  *upper = (uint64)(LATENCY_SUB_BUCKETS + sub + 1) << (exp - LATENCY_SUB_BITS);
+}
+
+void latency_histogram_record(UsaddressEntryPoint entry, int num_tokens,
+                              uint64 elapsed_ns) {
+  LatencyHistograms *h = get_histograms();
+
+  pg_atomic_fetch_add_u64(
+      &h->counts[entry][token_class_of(num_tokens)][latency_bucket(elapsed_ns)],
+      1);
+}
+
+uint64 latency_histogram_count(UsaddressEntryPoint entry, int token_class,
+                               int bucket) {
+  LatencyHistograms *h = get_histograms();
+
+  return pg_atomic_read_u64(&h->counts[entry][token_class][bucket]);
+}
+
+void latency_histogram_reset(void) {
+  LatencyHistograms *h = get_histograms();
+  int e, c, b;
+
+  for (e = 0; e < NUM_ENTRY_POINTS; e++) {
+    for (c = 0; c < LATENCY_TOKEN_CLASSES; c++) {
+      for (b = 0; b < LATENCY_BUCKETS; b++)
+        pg_atomic_write_u64(&h->counts[e][c][b], 0);
+    }
+  }
+}
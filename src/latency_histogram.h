@@ -0,0 +1,37 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include "stats.h"
+
+/*
+ * Log-linear latency histograms, one per SQL entry point and input size
+ * (token count) class. Like the counters in stats.h, they live in shared
+ * memory when the library is preloaded and are per backend otherwise.
+ */
+
+#define LATENCY_TOKEN_CLASSES 6
+
+/* Latency buckets per histogram */
+#define LATENCY_BUCKETS 241
+
+extern void latency_histogram_shmem_request(void);
+extern void latency_histogram_shmem_startup(void);
+
+extern void latency_histogram_record(UsaddressEntryPoint entry, int num_tokens,
+                                     uint64 elapsed_ns);
+
+/*
+ * Token count range [min, max] of a token class; max is -1 for the last,
+ * open-ended class.
+ */
+extern void latency_token_class_range(int token_class, int *min, int *max);
+
+/* Latency range [lower, upper) in ns of a bucket */
+extern void latency_bucket_bounds(int bucket, uint64 *lower, uint64 *upper);
+
+extern uint64 latency_histogram_count(UsaddressEntryPoint entry,
+                                      int token_class, int bucket);
+
+extern void latency_histogram_reset(void);
+
+#endif
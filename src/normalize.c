@@ -0,0 +1,170 @@
+#include "postgres.h"
+
+#include <ctype.h>
+
+#include "utils/memutils.h"
+
+#include "normalize.h"
+#include "usps_tables.h"
+
+/*
+ * The tables applied to the tokens of each label. A run of consecutive
+ * tokens with the label is first looked up whole in the component table, so
+ * that "New York" becomes "NY" and "P.O. Box" becomes "PO BOX". Failing
+ * that, each token is looked up in the token tables in turn and kept as is
+ * if it matches none.
+ */
+typedef struct NormalizeRule {
+  const char *label;
+  const PerfectHashTable *component;
+  const PerfectHashTable *tokens[2];
+} NormalizeRule;
+
+static const NormalizeRule normalize_rules[] = {
+    {"StreetNamePreDirectional", &usps_directionals, {&usps_directionals}},
+    {"StreetNamePostDirectional", &usps_directionals, {&usps_directionals}},
+    {"StreetNamePreType", &usps_street_suffixes, {&usps_street_suffixes}},
+    {"StreetNamePostType", &usps_street_suffixes, {&usps_street_suffixes}},
+    {"StreetName", &usps_ordinals, {&usps_ordinals, &usps_street_suffixes}},
+    {"OccupancyType", &usps_secondary_units, {&usps_secondary_units}},
+    {"SubaddressType", &usps_secondary_units, {&usps_secondary_units}},
+    {"StateName", &usps_states, {NULL}},
+    {"USPSBoxType", &usps_box_types, {NULL}},
+};
+
+/* Rule for each model label id, or NULL */
+static const NormalizeRule **label_rules = NULL;
+
+static const NormalizeRule **get_label_rules(CrfSuiteModel *model) {
+  int num_labels;
+  int i;
+
+  if (label_rules)
+    return label_rules;
+
+  num_labels = crfsuite_model_num_labels(model);
+  label_rules = MemoryContextAllocZero(
+      TopMemoryContext, Max(num_labels, 1) * sizeof(NormalizeRule *));
+  for (i = 0; i < num_labels; i++) {
+    const char *lbl = crfsuite_model_label(model, i);
+    int r;
+
+    for (r = 0; lbl && r < (int)lengthof(normalize_rules); r++) {
+      if (strcmp(lbl, normalize_rules[r].label) == 0) {
+        label_rules[i] = &normalize_rules[r];
+        break;
+      }
+    }
+  }
+
+  return label_rules;
+}
+
+/* Helper: uppercase len bytes in-place */
+static void str_to_upper(char *s, int len) {
+  for (; len > 0; s++, len--) {
+    *s = toupper((unsigned char)*s);
+  }
+}
+
+/*
+ * Writes the lookup key of tokens first..last to key: their text without
+ * periods, with a single space wherever the input has whitespace between
+ * them. Returns its length, or -1 if it is too long for any table.
+ */
+static int component_key(const ParsedAddress *parsed, int first, int last,
+                         char *key) {
+  int len = 0;
+  int i;
+
+  for (i = first; i <= last; i++) {
+    const char *tok = TOKEN_TEXT(parsed, i);
+    int k;
+
+    if (i > first && len > 0 && key[len - 1] != ' ' &&
+        parsed->spans[i].offset >
+            parsed->spans[i - 1].offset + parsed->spans[i - 1].length) {
+      if (len == PERFECT_HASH_MAX_KEY_LEN)
+        return -1;
+      key[len++] = ' ';
+    }
+    for (k = 0; k < parsed->spans[i].length; k++) {
+      if (tok[k] == '.')
+        continue;
+      if (len == PERFECT_HASH_MAX_KEY_LEN)
+        return -1;
+      key[len++] = tok[k];
+    }
+  }
+  if (len > 0 && key[len - 1] == ' ')
+    len--;
+  return len;
+}
+
+int normalize_address(CrfSuiteModel *model, ParsedAddress *parsed,
+                      NormalizedToken *out) {
+  const NormalizeRule **rules = get_label_rules(model);
+  int num_out = 0;
+  int first;
+
+  str_to_upper(parsed->input, parsed->input_len);
+
+  first = 0;
+  while (first < parsed->num_tokens) {
+    int label_id = parsed->label_ids[first];
+    const NormalizeRule *rule = rules[label_id];
+    int last = first;
+    int i;
+
+    /* Rule: Remove ALL commas. */
+    if (token_is_comma(parsed, first)) {
+      first++;
+      continue;
+    }
+
+    while (last + 1 < parsed->num_tokens &&
+           parsed->label_ids[last + 1] == label_id &&
+           !token_is_comma(parsed, last + 1))
+      last++;
+
+    if (rule) {
+      char key[PERFECT_HASH_MAX_KEY_LEN];
+      int key_len = component_key(parsed, first, last, key);
+      const PerfectHashEntry *entry =
+          key_len > 0 ? perfect_hash_lookup(rule->component, key, key_len)
+                      : NULL;
+
+      if (entry) {
+        out[num_out].text = entry->value;
+        out[num_out].len = strlen(entry->value);
+        out[num_out].label_id = label_id;
+        num_out++;
+        first = last + 1;
+        continue;
+      }
+    }
+
+    for (i = first; i <= last; i++) {
+      const char *tok = TOKEN_TEXT(parsed, i);
+      int len = parsed->spans[i].length;
+      const PerfectHashEntry *entry = NULL;
+      int t;
+
+      for (t = 0; rule && t < (int)lengthof(rule->tokens) && !entry; t++) {
+        /* A lone token was already looked up as the component */
+        if (rule->tokens[t] == NULL ||
+            (first == last && rule->tokens[t] == rule->component))
+          continue;
+        entry = perfect_hash_lookup(rule->tokens[t], tok, len);
+      }
+
+      out[num_out].text = entry ? entry->value : tok;
+      out[num_out].len = entry ? (int)strlen(entry->value) : len;
+      out[num_out].label_id = label_id;
+      num_out++;
+    }
+    first = last + 1;
+  }
+
+  return num_out;
+}
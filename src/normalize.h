@@ -0,0 +1,29 @@
+#ifndef NORMALIZE_H
+#define NORMALIZE_H
+
+#include "crfsuite_wrapper.h"
+#include "pg_usaddress.h"
+
+/*
+ * A component of a normalized address: a run of tokens with the same label
+ * replaced by its USPS form, or a single token.
+ */
+typedef struct NormalizedToken {
+  const char *text; /* USPS form, or the uppercased token in parsed->input */
+  int len;
+  int label_id;
+} NormalizedToken;
+
+/*
+ * Applies USPS Publication 28 standardization to a tagged address: state
+ * names, directionals, street types, secondary unit and PO box designators,
+ * and spelled-out ordinal street names. Uppercases parsed->input in place
+ * and writes the components to out, which has room for parsed->num_tokens,
+ * leaving out commas. Returns the number of components. Component text is
+ * either a static abbreviation or a span of parsed->input, so nothing is
+ * allocated.
+ */
+extern int normalize_address(CrfSuiteModel *model, ParsedAddress *parsed,
+                             NormalizedToken *out);
+
+#endif
@@ -0,0 +1,150 @@
+#include "postgres.h"
+
+#include "common/hashfn.h"
+#include "lib/ilist.h"
+#include "utils/hsearch.h"
+#include "utils/memutils.h"
+
+#include "parse_cache.h"
+
+int parse_cache_size = 1024;
+
+/*
+ * One cached address. The spans, label ids and input bytes share a single
+ * allocation in parse_cache_mcxt, starting at spans, so an entry is freed
+ * with one pfree.
+ */
+typedef struct ParseCacheEntry {
+  uint64 key; /* hash of the input under generation; must be first */
+  uint64 generation;
+  dlist_node lru_node; /* most recently used at the head */
+  int input_len;
+  int num_tokens;
+  char *input;
+  TokenSpan *spans;
+  int *label_ids;
+} ParseCacheEntry;
+
+static MemoryContext parse_cache_mcxt = NULL;
+static HTAB *parse_cache_htab = NULL;
+static dlist_head parse_cache_lru = DLIST_STATIC_INIT(parse_cache_lru);
+static ParseCacheStats parse_cache_stats;
+
+static void parse_cache_init(void) {
+  HASHCTL ctl;
+
+  parse_cache_mcxt = AllocSetContextCreate(
+      TopMemoryContext, "pg_usaddress parse cache", ALLOCSET_DEFAULT_SIZES);
+
+  memset(&ctl, 0, sizeof(ctl));
+  ctl.keysize = sizeof(uint64);
+  ctl.entrysize = sizeof(ParseCacheEntry);
+  ctl.hcxt = parse_cache_mcxt;
+  parse_cache_htab =
+      hash_create("pg_usaddress parse cache", Min(parse_cache_size, 1024),
+                  &ctl, HASH_ELEM | HASH_BLOBS | HASH_CONTEXT);
+}
+
+static void parse_cache_remove(ParseCacheEntry *entry) {
+  dlist_delete(&entry->lru_node);
+  pfree(entry->spans);
+  hash_search(parse_cache_htab, &entry->key, HASH_REMOVE, NULL);
+  parse_cache_stats.entries--;
+}
+
+/* Evicts least recently used entries until at most limit remain */
+static void parse_cache_trim(int limit) {
+  while (parse_cache_stats.entries > limit) {
+    ParseCacheEntry *victim =
+        dlist_tail_element(ParseCacheEntry, lru_node, &parse_cache_lru);
+
+    parse_cache_remove(victim);
+    parse_cache_stats.evictions++;
+  }
+}
+
+static uint64 parse_cache_key(uint64 generation, const ParsedAddress *parsed) {
+  return hash_bytes_extended((const unsigned char *)parsed->input,
+                             parsed->input_len, generation);
+}
+
+bool parse_cache_lookup(uint64 generation, ParsedAddress *parsed) {
+  ParseCacheEntry *entry;
+  uint64 key;
+
+  if (parse_cache_htab == NULL)
+    return false;
+
+  /* The GUC may have been lowered since the last store */
+  parse_cache_trim(parse_cache_size);
+  if (parse_cache_size == 0)
+    return false;
+
+  key = parse_cache_key(generation, parsed);
+  entry = hash_search(parse_cache_htab, &key, HASH_FIND, NULL);
+
+  /* Hash collisions are verified against the stored input */
+  if (entry == NULL || entry->generation != generation ||
+      entry->input_len != parsed->input_len ||
+      memcmp(entry->input, parsed->input, parsed->input_len) != 0) {
+    parse_cache_stats.misses++;
+    return false;
+  }
+
+  dlist_move_head(&parse_cache_lru, &entry->lru_node);
+  parse_cache_stats.hits++;
+
+  parsed->num_tokens = entry->num_tokens;
+  parsed->spans = palloc(Max(entry->num_tokens, 1) * sizeof(TokenSpan));
+  parsed->label_ids = palloc(Max(entry->num_tokens, 1) * sizeof(int));
+  memcpy(parsed->spans, entry->spans, entry->num_tokens * sizeof(TokenSpan));
+  memcpy(parsed->label_ids, entry->label_ids,
+         entry->num_tokens * sizeof(int));
+  return true;
+}
+
+void parse_cache_store(uint64 generation, const ParsedAddress *parsed) {
+  ParseCacheEntry *entry;
+  uint64 key;
+  bool found;
+  Size spans_size;
+  Size labels_size;
+  char *data;
+
+  if (parse_cache_size == 0)
+    return;
+  if (parse_cache_htab == NULL)
+    parse_cache_init();
+
+  spans_size = parsed->num_tokens * sizeof(TokenSpan);
+  labels_size = parsed->num_tokens * sizeof(int);
+  data = MemoryContextAlloc(parse_cache_mcxt,
+                            spans_size + labels_size + parsed->input_len);
+
+  key = parse_cache_key(generation, parsed);
+  entry = hash_search(parse_cache_htab, &key, HASH_ENTER, &found);
+  if (found) {
+    /* A colliding input: the newer one takes the slot */
+    dlist_delete(&entry->lru_node);
+    pfree(entry->spans);
+  } else {
+    parse_cache_stats.entries++;
+  }
+
+  entry->generation = generation;
+  entry->input_len = parsed->input_len;
+  entry->num_tokens = parsed->num_tokens;
+  entry->spans = (TokenSpan *)data;
+  entry->label_ids = (int *)(data + spans_size);
+  entry->input = data + spans_size + labels_size;
+  memcpy(entry->spans, parsed->spans, spans_size);
+  memcpy(entry->label_ids, parsed->label_ids, labels_size);
+  memcpy(entry->input, parsed->input, parsed->input_len);
+  dlist_push_head(&parse_cache_lru, &entry->lru_node);
+
+  parse_cache_trim(parse_cache_size);
+}
+
+void parse_cache_get_stats(ParseCacheStats *stats) {
+  *stats = parse_cache_stats;
+}
@@ -0,0 +1,31 @@
+#ifndef PARSE_CACHE_H
+#define PARSE_CACHE_H
+
+#include "pg_usaddress.h"
+
+/* GUC pg_usaddress.cache_size: maximum number of cached addresses */
+extern int parse_cache_size;
+
+typedef struct ParseCacheStats {
+  uint64 hits;
+  uint64 misses;
+  uint64 evictions;
+  int entries;
+} ParseCacheStats;
+
+/*
+ * Looks up parsed->input, keyed by its hash under the given model generation.
+ * On a hit, fills in the token spans and label ids of parsed (palloc'd in the
+ * current memory context) and returns true.
+ */
+extern bool parse_cache_lookup(uint64 generation, ParsedAddress *parsed);
+
+/*
+ * Remembers the tagging result in parsed, evicting the least recently used
+ * entries to stay within pg_usaddress.cache_size.
+ */
+extern void parse_cache_store(uint64 generation, const ParsedAddress *parsed);
+
+extern void parse_cache_get_stats(ParseCacheStats *stats);
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * perfect_hash.h - lookups in the generated tables of usps_tables.h
+ *
+ * Each table is a perfect hash ("hash and displace") over its keys, stored
+ * uppercase: a key's slot is found from its FNV-1a hash and a per-bucket
+ * displacement, so a lookup folds and hashes the word once and then
+ * compares it with a single key. The tables and their hash parameters come
+ * from tools/gen_usps_tables.py, which must hash the same way.
+ *
+ * Plain C, shared by the PostgreSQL glue and the feature extractor.
+ */
+
+#ifndef PERFECT_HASH_H
+#define PERFECT_HASH_H
+
+#include <stdint.h>
+#include <string.h>
+
+/* Longest key of any table */
+#define PERFECT_HASH_MAX_KEY_LEN 32
+
+typedef struct {
+  const char *key; /* uppercase; NULL in an empty slot */
+  uint8_t key_len;
+  const char *value;
+} PerfectHashEntry;
+
+typedef struct {
+  const PerfectHashEntry *slots;
+  const uint16_t *displacements;
+  uint32_t slot_mask;   /* slots - 1, a power of two less one */
+  uint32_t bucket_mask; /* buckets - 1, likewise */
+  int max_key_len;
+} PerfectHashTable;
+
+/* The murmur3 finalizer, to spread a displaced hash over the slots */
+static inline uint32_t perfect_hash_mix(uint32_t h) {
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+  return h;
+}
+
+/*
+ * Returns the entry whose key is the len bytes at word, compared without
+ * regard to ASCII case, or NULL if there is none.
+ */
+static inline const PerfectHashEntry *
+perfect_hash_lookup(const PerfectHashTable *table, const char *word, int len) {
+  char folded[PERFECT_HASH_MAX_KEY_LEN];
+  const PerfectHashEntry *entry;
+  uint32_t h = 2166136261u;
+
+  if (len <= 0 || len > table->max_key_len)
+    return NULL;
+  for (int i = 0; i < len; i++) {
+    unsigned char c = word[i];
+
+    if (c >= 'a' && c <= 'z')
+      c -= 'a' - 'A';
+    folded[i] = c;
+    h = (h ^ c) * 16777619u;
+  }
+
+  entry = &table->slots[perfect_hash_mix(
+                            h ^ table->displacements[h & table->bucket_mask]) &
+                        table->slot_mask];
+  if (entry->key_len != len || memcmp(entry->key, folded, len) != 0)
+    return NULL;
+  return entry;
+}
+
+#endif /* PERFECT_HASH_H */
@@ -1,20 +1,252 @@
 #include "postgres.h"
 
+#include "catalog/pg_type.h"
+#include "common/hashfn.h"
+#if PG_VERSION_NUM >= 150000
+#include "common/pg_prng.h"
+#endif
 #include "fmgr.h"
 #include "funcapi.h"
+#include "lib/stringinfo.h"
+#include "mb/pg_wchar.h"
 #include "miscadmin.h"
+#include "storage/fd.h"
+#include "storage/ipc.h"
+#include "utils/array.h"
 #include "utils/builtins.h"
-#include "utils/json.h"
+#include "utils/datum.h"
+#include "utils/guc.h"
 #include "utils/jsonb.h"
+#include "utils/memutils.h"
+#include "utils/numeric.h"
+#include "utils/tuplestore.h"
+#include "utils/typcache.h"
 
 #include "crfsuite_wrapper.h"
+#include "fast_path.h"
 #include "feature_extractor.h"
-#include "usps_mappings.h"
+#include "latency_histogram.h"
+#include "normalize.h"
+#include "parse_cache.h"
+#include "pg_usaddress.h"
+#include "shared_cache.h"
+#include "stats.h"
+#include "timing.h"
 
 PG_MODULE_MAGIC;
 
+void _PG_init(void);
+
 static CrfSuiteModel *usaddress_model = NULL;
 
+/*
+ * Words of the loaded model's word features, so that features it does not
+ * know are never generated. NULL if it could not be built.
+ */
+static FeatureVocab *feature_vocab = NULL;
+
+/*
+ * Attribute ids of recently seen token words under the loaded model, built
+ * on first use with token_cache_entries words.
+ */
+static TokenCache *token_cache = NULL;
+static int token_cache_entries = 0;
+
+/* Words in the token cache; 0 disables it */
+static int token_cache_size = 4096;
+
+/* kB of state-score rows the model caches; 0 disables the cache */
+static int state_cache_size_kb = 1024;
+
+/* Size the model's state cache was last given, or -1 */
+static int state_cache_applied_kb = -1;
+
+/*
+ * Hash of the loaded model file's contents. Parse cache entries are keyed by
+ * it, so results tagged by a different model are never served.
+ */
+static uint64 model_generation = 0;
+
+/* Number of times this backend has run the tagger */
+static uint64 tag_calls = 0;
+
+/* Calls slower than this many ms are logged; -1 disables the log */
+static int log_min_duration = -1;
+
+/* Fraction of the slow calls that are logged */
+static double log_sample_rate = 1.0;
+
+/* Bytes of the input quoted in slow call log entries */
+#define LOG_INPUT_MAX 256
+
+/* Limits on the work a single call may do; 0 disables a limit */
+static int max_input_bytes = 4096;
+static int max_tokens = 256;
+
+/* What to do with an input over max_input_bytes or max_tokens */
+typedef enum OverflowAction {
+  OVERFLOW_ERROR,
+  OVERFLOW_TRUNCATE, /* parse only the part within the limits */
+  OVERFLOW_SPLIT     /* tag it in segments within the limits */
+} OverflowAction;
+
+static int overflow_action = OVERFLOW_ERROR;
+
+static const struct config_enum_entry overflow_action_options[] = {
+    {"error", OVERFLOW_ERROR, false},
+    {"truncate", OVERFLOW_TRUNCATE, false},
+    {"split", OVERFLOW_SPLIT, false},
+    {NULL, 0, false},
+};
+
+/*
+ * Whether the model's labels of canonical addresses are checked against the
+ * fast path's. The fast path never labels addresses itself: the parse
+ * functions are immutable, so their results must not depend on a setting.
+ */
+typedef enum FastPathMode {
+  FAST_PATH_OFF,
+  FAST_PATH_VERIFY /* report disagreements with the CRF */
+} FastPathMode;
+
+static int fast_path_mode = FAST_PATH_OFF;
+
+static const struct config_enum_entry fast_path_options[] = {
+    {"off", FAST_PATH_OFF, false},
+    {"verify", FAST_PATH_VERIFY, false},
+    {NULL, 0, false},
+};
+
+/* The fast path's labels under the model of fast_path_generation */
+static FastPath fast_path;
+static bool fast_path_usable = false;
+static uint64 fast_path_generation = 0;
+
+#if PG_VERSION_NUM >= 150000
+static shmem_request_hook_type prev_shmem_request_hook = NULL;
+#endif
+static shmem_startup_hook_type prev_shmem_startup_hook = NULL;
+
+static void pg_usaddress_shmem_request(void) {
+#if PG_VERSION_NUM >= 150000
+  if (prev_shmem_request_hook)
+    prev_shmem_request_hook();
+#endif
+  shared_cache_shmem_request();
+  stats_shmem_request();
+  latency_histogram_shmem_request();
+}
+
+static void pg_usaddress_shmem_startup(void) {
+  if (prev_shmem_startup_hook)
+    prev_shmem_startup_hook();
+  shared_cache_shmem_startup();
+  stats_shmem_startup();
+  latency_histogram_shmem_startup();
+}
+
+void _PG_init(void) {
+  DefineCustomIntVariable(
+      "pg_usaddress.cache_size",
+      "Maximum number of parsed addresses cached by each backend.",
+      "Zero disables the parse cache.", &parse_cache_size, 1024, 0, 10000000,
+      PGC_USERSET, 0, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "pg_usaddress.token_cache_size",
+      "Number of token words whose model attribute ids each backend caches.",
+      "Zero disables the token cache.", &token_cache_size, 4096, 0, 1 << 24,
+      PGC_USERSET, 0, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "pg_usaddress.state_cache_size",
+      "Memory each backend may use to cache per-token state scores.",
+      "Zero disables the state cache.", &state_cache_size_kb, 1024, 0,
+      MAX_KILOBYTES, PGC_USERSET, GUC_UNIT_KB, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "pg_usaddress.shared_cache_size",
+      "Size of the parse cache shared by all backends.",
+      "Requires pg_usaddress in shared_preload_libraries. Zero disables the "
+      "shared cache.",
+      &shared_cache_size_mb, 0, 0, MAX_KILOBYTES / 1024, PGC_POSTMASTER,
+      GUC_UNIT_MB, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "pg_usaddress.log_min_duration",
+      "Sets the minimum execution time above which parses are logged.",
+      "Zero logs every parse; -1 disables logging.", &log_min_duration, -1,
+      -1, INT_MAX, PGC_SUSET, GUC_UNIT_MS, NULL, NULL, NULL);
+
+  DefineCustomRealVariable(
+      "pg_usaddress.log_sample_rate",
+      "Fraction of the parses over log_min_duration that are logged.", NULL,
+      &log_sample_rate, 1.0, 0.0, 1.0, PGC_SUSET, 0, NULL, NULL, NULL);
+
+  DefineCustomIntVariable(
+      "pg_usaddress.max_input_bytes",
+      "Sets the longest input that is parsed in one piece.",
+      "Zero means no limit; see pg_usaddress.overflow_action.",
+      &max_input_bytes, 4096, 0, MaxAllocSize, PGC_SUSET, GUC_UNIT_BYTE, NULL,
+      NULL, NULL);
+
+  DefineCustomIntVariable(
+      "pg_usaddress.max_tokens",
+      "Sets the most tokens that are tagged in one piece.",
+      "Zero means no limit; see pg_usaddress.overflow_action.", &max_tokens,
+      256, 0, INT_MAX, PGC_SUSET, 0, NULL, NULL, NULL);
+
+  DefineCustomEnumVariable(
+      "pg_usaddress.overflow_action",
+      "Sets what happens to inputs over max_input_bytes or max_tokens.",
+      "\"error\" rejects them, \"truncate\" parses only the part within the "
+      "limits, and \"split\" tags them in segments that end at commas.",
+      &overflow_action, OVERFLOW_ERROR, overflow_action_options, PGC_SUSET, 0,
+      NULL, NULL, NULL);
+
+  DefineCustomEnumVariable(
+      "pg_usaddress.fast_path",
+      "Checks the model's labels of canonical addresses against rules.",
+      "\"verify\" logs the addresses that the rules label differently.",
+      &fast_path_mode, FAST_PATH_OFF, fast_path_options, PGC_SUSET, 0, NULL,
+      NULL, NULL);
+
+#if PG_VERSION_NUM >= 150000
+  MarkGUCPrefixReserved("pg_usaddress");
+#else
+  EmitWarningsOnPlaceholders("pg_usaddress");
+#endif
+
+  /* Shared memory can only be reserved while the postmaster starts up */
+  if (!process_shared_preload_libraries_in_progress)
+    return;
+
+#if PG_VERSION_NUM >= 150000
+  prev_shmem_request_hook = shmem_request_hook;
+  shmem_request_hook = pg_usaddress_shmem_request;
+#else
+  pg_usaddress_shmem_request();
+#endif
+  prev_shmem_startup_hook = shmem_startup_hook;
+  shmem_startup_hook = pg_usaddress_shmem_startup;
+}
+
+static uint64 model_file_generation(const char *path) {
+  FILE *fp;
+  char buf[65536];
+  size_t n;
+  uint64 generation = 0;
+
+  fp = AllocateFile(path, PG_BINARY_R);
+  if (fp == NULL)
+    return 0;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+    generation = hash_bytes_extended((const unsigned char *)buf, (int)n,
+                                     generation);
+  FreeFile(fp);
+  return generation;
+}
+
 static void load_model_if_needed(void) {
   char path[MAXPGPATH];
   char share_path[MAXPGPATH];
@@ -28,312 +260,930 @@ static void load_model_if_needed(void) {
   if (!usaddress_model) {
     ereport(WARNING,
             (errmsg("Could not load usaddr.crfsuite model from %s", path)));
+  } else {
+    int num_attrs = crfsuite_model_num_attrs(usaddress_model);
+    int i;
+
+    feature_vocab = feature_vocab_create(num_attrs);
+    for (i = 0; feature_vocab && i < num_attrs; i++) {
+      const char *attr = crfsuite_model_attr(usaddress_model, i);
+
+      if (attr)
+        feature_vocab_add_attr(feature_vocab, attr);
+    }
+    model_generation = model_file_generation(path);
+    shared_cache_set_generation(model_generation);
+    stats_add(STAT_MODEL_LOADS, 1);
   }
 }
 
-PG_FUNCTION_INFO_V1(parse_address_crf);
-Datum parse_address_crf(PG_FUNCTION_ARGS) {
-  FuncCallContext *funcctx;
-  int call_cntr;
-  int max_calls;
-
-  if (SRF_IS_FIRSTCALL()) {
-    MemoryContext oldcontext;
-    text *arg;
-    char *input_str;
-    int num_items = 0;
-    TokenFeatures *tokens = NULL;
-    CrfSuiteItem *crf_items;
-    char **labels = NULL;
-    int i;
-    int filtered_count = 0;
-    int current_idx = 0;
-
-    typedef struct {
-      TokenFeatures *tokens;
-      char **labels;
-      int num_items;
-    } UserCtx;
-    UserCtx *uctx;
-
-    load_model_if_needed();
-    if (!usaddress_model)
-      ereport(ERROR, (errmsg("Model not loaded")));
-
-    funcctx = SRF_FIRSTCALL_INIT();
-    oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
-
-    /* Build a tuple descriptor for our result type */
-    if (get_call_result_type(fcinfo, NULL, &funcctx->tuple_desc) !=
-        TYPEFUNC_COMPOSITE)
-      ereport(ERROR, (errmsg("return type must be a row type")));
-    BlessTupleDesc(funcctx->tuple_desc);
+/*
+ * Per-call-site state for the set-returning functions. It lives in fn_extra
+ * (allocated in fn_mcxt), so the result descriptor and the label text Datums
+ * are built once per query instead of once per input row.
+ */
+typedef struct SrfCallCache {
+  TupleDesc tupdesc;
+  int num_labels;
+  Datum *label_datums; /* text Datum per model label id */
+} SrfCallCache;
 
-    arg = PG_GETARG_TEXT_PP(0);
-    input_str = text_to_cstring(arg);
+static SrfCallCache *get_srf_call_cache(FunctionCallInfo fcinfo) {
+  SrfCallCache *cache = (SrfCallCache *)fcinfo->flinfo->fn_extra;
+  MemoryContext oldcontext;
+  TupleDesc tupdesc;
+  int i;
 
-    tokens = tokenize_and_extract_features(input_str, &num_items);
+  if (cache)
+    return cache;
 
-    crf_items = malloc(num_items * sizeof(CrfSuiteItem));
-    for (i = 0; i < num_items; i++)
-      crf_items[i] = tokens[i].features;
+  oldcontext = MemoryContextSwitchTo(fcinfo->flinfo->fn_mcxt);
 
-    if (crfsuite_model_tag(usaddress_model, crf_items, num_items, &labels) !=
-        0) {
-      free(crf_items);
-      free_token_features(tokens, num_items);
-      MemoryContextSwitchTo(oldcontext);
-      ereport(ERROR, (errmsg("Tagging failed")));
-    }
+  if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+    ereport(ERROR, (errmsg("return type must be a row type")));
 
-    // Filter out commas
+  cache = (SrfCallCache *)palloc(sizeof(SrfCallCache));
+  cache->tupdesc = BlessTupleDesc(tupdesc);
+  cache->num_labels = crfsuite_model_num_labels(usaddress_model);
+  cache->label_datums = palloc(cache->num_labels * sizeof(Datum));
+  for (i = 0; i < cache->num_labels; i++) {
+    const char *lbl = crfsuite_model_label(usaddress_model, i);
+    cache->label_datums[i] = CStringGetTextDatum(lbl ? lbl : "");
+  }
 
-    for (i = 0; i < num_items; i++) {
-      if (strcmp(tokens[i].token, ",") != 0) {
-        filtered_count++;
-      }
-    }
+  MemoryContextSwitchTo(oldcontext);
 
-    uctx = (UserCtx *)palloc(sizeof(UserCtx));
-    uctx->tokens = palloc(filtered_count * sizeof(TokenFeatures));
-    uctx->labels = palloc(filtered_count * sizeof(char *));
-    uctx->num_items = filtered_count;
-
-    for (i = 0; i < num_items; i++) {
-      if (strcmp(tokens[i].token, ",") != 0) {
-        // Copy token structure (shallow copy of pointers is fine if we
-        // carefully manage memory, but original 'tokens' array is freed in
-        // 'free_token_features'. We need to keep the strings alive or duplicate
-        // them. The original 'tokens' array was allocated by
-        // 'tokenize_and_extract_features'. The strings inside 'tokens' are
-        // allocated. If we free the original 'tokens' array, we lose the
-        // structs but not necessarily strings if we handle it right. But
-        // 'free_token_features' frees the strings too! So we MUST duplicate the
-        // strings for our new list, OR keep the original list and just have an
-        // index mapping? Easier: Duplicate strings and free the original full
-        // list now.
-
-        uctx->tokens[current_idx].token = pstrdup(tokens[i].token);
-        // We don't need features for the output iteration, just the token
-        // string. But UserCtx definition has TokenFeatures*. Let's respect
-        // that.
-        uctx->tokens[current_idx].features.num_features = 0; // Not used
-        uctx->tokens[current_idx].features.features = NULL;  // Not used
-
-        uctx->labels[current_idx] = pstrdup(labels[i]);
-        current_idx++;
-      }
-    }
+  fcinfo->flinfo->fn_extra = cache;
+  return cache;
+}
 
-    // Now we can free the original arrays
-    free_token_features(tokens, num_items);
+/*
+ * Switches the caller to materialize mode and returns the tuplestore that
+ * will hold the result rows.
+ */
+static Tuplestorestate *begin_materialize_srf(FunctionCallInfo fcinfo,
+                                              TupleDesc tupdesc) {
+  ReturnSetInfo *rsinfo = (ReturnSetInfo *)fcinfo->resultinfo;
+  MemoryContext oldcontext;
+  Tuplestorestate *tupstore;
+
+  if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo))
+    ereport(ERROR,
+            (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+             errmsg("set-valued function called in context that cannot "
+                    "accept a set")));
+  if (!(rsinfo->allowedModes & SFRM_Materialize))
+    ereport(ERROR, (errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+                    errmsg("materialize mode required, but it is not allowed "
+                           "in this context")));
+
+  oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+  tupstore = tuplestore_begin_heap(
+      (rsinfo->allowedModes & SFRM_Materialize_Random) != 0, false, work_mem);
+  rsinfo->returnMode = SFRM_Materialize;
+  rsinfo->setResult = tupstore;
+  /* The executor frees setDesc after each call, so it gets its own copy. */
+  rsinfo->setDesc = CreateTupleDescCopy(tupdesc);
+  MemoryContextSwitchTo(oldcontext);
+
+  return tupstore;
+}
 
-    for (i = 0; i < num_items; i++) {
-      free(labels[i]);
-    }
-    free(labels);
+/* SQL names of the entry points, indexed by UsaddressEntryPoint */
+static const char *const entry_point_names[NUM_ENTRY_POINTS] = {
+    "parse_address_crf",           "parse_address_crf_normalized",
+    "parse_address_crf_cols",      "tag_address_crf",
+    "crf_full_address_normalized", "parse_address_crf_batch",
+};
+
+/* Names of the phases in log entries, indexed by UsaddressPhase */
+static const char *const phase_names[NUM_PHASES] = {
+    "tokenize",    "fast_path", "feature",   "attr_lookup",
+    "state_score", "viterbi",   "normalize", "output",
+};
+
+/*
+ * The SQL call in progress. Entry points start it with begin_parse_call(),
+ * bracket their work with phase_begin()/phase_end(), and report it with
+ * end_parse_call().
+ */
+typedef struct ParseCall {
+  UsaddressEntryPoint entry;
+  uint64 start_ns;
+  const char *input; /* the text argument, for the slow call log */
+  int input_len;
+  int num_tokens;
+  int tokens_tagged; /* 0 when the result came from a cache */
+  uint64 phase_start;
+  uint64 phase_ns[NUM_PHASES];
+} ParseCall;
+
+static ParseCall parse_call;
+
+static void begin_parse_call(UsaddressEntryPoint entry) {
+  memset(&parse_call, 0, sizeof(parse_call));
+  parse_call.entry = entry;
+  parse_call.start_ns = usaddr_now_ns();
+}
 
-    free(crf_items);
+static inline void phase_begin(void) {
+  parse_call.phase_start = usaddr_now_ns();
+}
 
-    // Wait, original code kept 'tokens' and 'labels' directly in uctx.
-    // uctx->tokens = tokens;
-    // uctx->labels = labels;
-    // And freed them in the final call (lines 144-147).
+/* Charges the time since the last phase_begin()/phase_end() to phase */
+static inline void phase_end(UsaddressPhase phase) {
+  uint64 now = usaddr_now_ns();
 
-    // So if I create NEW arrays, I should free the OLD ones NOW.
-    // Yes.
+  parse_call.phase_ns[phase] += now - parse_call.phase_start;
+  parse_call.phase_start = now;
+}
 
-    funcctx->user_fctx = (void *)uctx;
-    funcctx->max_calls = filtered_count;
+static bool slow_call_sampled(void) {
+  if (log_sample_rate >= 1.0)
+    return true;
+#if PG_VERSION_NUM >= 150000
+  return pg_prng_double(&pg_global_prng_state) < log_sample_rate;
+#else
+  return random() < log_sample_rate * MAX_RANDOM_VALUE;
+#endif
+}
 
-    pfree(input_str);
-    MemoryContextSwitchTo(oldcontext);
+/*
+ * Logs a call that ran longer than pg_usaddress.log_min_duration, with enough
+ * detail to tell which phase the time went to. Pathological inputs are
+ * usually long, so only the start of the input is quoted.
+ */
+static void log_slow_call(uint64 elapsed_ns) {
+  StringInfoData detail;
+  int quoted;
+  int p;
+
+  initStringInfo(&detail);
+  appendStringInfo(&detail, "Input length: %d bytes, tokens: %d.",
+                   parse_call.input_len, parse_call.num_tokens);
+  if (parse_call.tokens_tagged == 0)
+    appendStringInfoString(&detail, " Served from cache.");
+  appendStringInfoString(&detail, " Phases (ms):");
+  for (p = 0; p < NUM_PHASES; p++)
+    appendStringInfo(&detail, "%s %s %.3f", p == 0 ? "" : ",", phase_names[p],
+                     parse_call.phase_ns[p] / 1000000.0);
+  quoted = pg_mbcliplen(parse_call.input, parse_call.input_len, LOG_INPUT_MAX);
+  appendStringInfo(&detail, ". Input: \"%.*s%s\"", quoted, parse_call.input,
+                   quoted < parse_call.input_len ? "..." : "");
+
+  ereport(LOG, (errmsg("pg_usaddress: %s took %.3f ms",
+                       entry_point_names[parse_call.entry],
+                       elapsed_ns / 1000000.0),
+                errdetail_internal("%s", detail.data), errhidestmt(true)));
+  pfree(detail.data);
+}
+
+static void end_parse_call(void) {
+  uint64 elapsed_ns = usaddr_now_ns() - parse_call.start_ns;
+
+  stats_count_call(parse_call.entry, parse_call.tokens_tagged,
+                   parse_call.phase_ns);
+  latency_histogram_record(parse_call.entry, parse_call.num_tokens,
+                           elapsed_ns);
+  if (log_min_duration >= 0 && parse_call.input != NULL &&
+      elapsed_ns >= (uint64)log_min_duration * 1000000 && slow_call_sampled())
+    log_slow_call(elapsed_ns);
+}
+
+static void report_overflow(const char *what, int value, const char *guc,
+                            int limit) {
+  ereport(ERROR,
+          (errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+           errmsg("address has %d %s, more than %s (%d)", value, what, guc,
+                  limit),
+           errhint("Set pg_usaddress.overflow_action to \"truncate\" or "
+                   "\"split\" to parse it anyway.")));
+}
+
+/*
+ * Applies pg_usaddress.max_input_bytes to a NUL-terminated input: raises an
+ * error or clips the input as pg_usaddress.overflow_action says. Returns
+ * whether the input is over the limit.
+ */
+static bool check_input_bytes(char *input, int *input_len) {
+  if (max_input_bytes <= 0 || *input_len <= max_input_bytes)
+    return false;
+  if (overflow_action == OVERFLOW_ERROR)
+    report_overflow("bytes", *input_len, "pg_usaddress.max_input_bytes",
+                    max_input_bytes);
+  if (overflow_action == OVERFLOW_TRUNCATE) {
+    *input_len = pg_mbcliplen(input, *input_len, max_input_bytes);
+    input[*input_len] = '\0';
   }
+  return true;
+}
 
-  funcctx = SRF_PERCALL_SETUP();
-  call_cntr = funcctx->call_cntr;
-  max_calls = funcctx->max_calls;
+/*
+ * Applies pg_usaddress.max_tokens to an input of num_items tokens likewise.
+ * Returns the number of tokens to tag, and sets *overflowed if the input is
+ * over the limit.
+ */
+static int check_num_tokens(int num_items, bool *overflowed) {
+  if (max_tokens <= 0 || num_items <= max_tokens)
+    return num_items;
+  if (overflow_action == OVERFLOW_ERROR)
+    report_overflow("tokens", num_items, "pg_usaddress.max_tokens",
+                    max_tokens);
+  *overflowed = true;
+  return overflow_action == OVERFLOW_TRUNCATE ? max_tokens : num_items;
+}
 
-  if (call_cntr < max_calls) {
-    typedef struct {
-      TokenFeatures *tokens;
-      char **labels;
-      int num_items;
-    } UserCtx;
-    UserCtx *uctx = (UserCtx *)funcctx->user_fctx;
+/*
+ * Number of tokens from start on that make up the next segment of a split
+ * input: as many as the limits allow, cut back to just after the last comma
+ * among them if the input continues. Always at least one token.
+ */
+static int next_segment_length(const ParsedAddress *parsed, int start,
+                               int num_items) {
+  int first_offset = parsed->spans[start].offset;
+  int last_comma = 0;
+  int n = 0;
+
+  while (start + n < num_items) {
+    const TokenSpan *span = &parsed->spans[start + n];
+
+    if (n > 0 && max_tokens > 0 && n >= max_tokens)
+      break;
+    if (n > 0 && max_input_bytes > 0 &&
+        span->offset + span->length - first_offset > max_input_bytes)
+      break;
+    n++;
+    if (token_is_comma(parsed, start + n - 1))
+      last_comma = n;
+  }
+  if (start + n < num_items && last_comma > 0)
+    n = last_comma;
+  return n;
+}
 
-    Datum values[2];
-    bool nulls[2] = {false, false};
-    HeapTuple tuple;
-    Datum result;
+/* Token spans allocated before the input's token count is known */
+#define INITIAL_SPANS 32
 
-    values[0] = CStringGetTextDatum(uctx->tokens[call_cntr].token);
-    values[1] = CStringGetTextDatum(uctx->labels[call_cntr]);
+/*
+ * Whether input is read as UTF-8: it is in a UTF8 database, and a SQL_ASCII
+ * one declares no encoding. Other encodings only have their ASCII characters
+ * classified, so inputs tokenize differently there and are kept out of the
+ * shared parse cache, which other databases read.
+ */
+static bool input_is_utf8(void) {
+  int encoding = GetDatabaseEncoding();
 
-    tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
-    result = HeapTupleGetDatum(tuple);
-    SRF_RETURN_NEXT(funcctx, result);
-  } else {
-    // Resources allocated in multi_call_memory_ctx (uctx, tokens, labels)
-    // are automatically freed by PostgreSQL when the SRF finishes.
-    // We must NOT call free() on palloc'd memory.
+  return encoding == PG_UTF8 || encoding == PG_SQL_ASCII;
+}
 
-    SRF_RETURN_DONE(funcctx);
+/*
+ * Tokenizes input into a palloc'd array of spans and returns the number of
+ * tokens. Most addresses fit the first guess; longer inputs are tokenized a
+ * second time into an array of the right size.
+ */
+static int tokenize_palloc(const char *input, int input_len,
+                           TokenSpan **spans) {
+  int num_items;
+
+  *spans = palloc(INITIAL_SPANS * sizeof(TokenSpan));
+  num_items = tokenize_spans(input, input_len, input_is_utf8(), *spans,
+                             INITIAL_SPANS);
+  if (num_items > INITIAL_SPANS) {
+    *spans = repalloc(*spans, num_items * sizeof(TokenSpan));
+    tokenize_spans(input, input_len, input_is_utf8(), *spans, num_items);
   }
+  return num_items;
 }
 
-PG_FUNCTION_INFO_V1(tag_address_crf);
-Datum tag_address_crf(PG_FUNCTION_ARGS) {
-  text *arg;
-  char *input_str;
-  int num_items = 0;
-  TokenFeatures *tokens;
+/*
+ * Generates the features of the tokens into a single palloc'd block, which
+ * holds the items followed by the feature text they point into.
+ */
+static CrfSuiteItem *extract_features_palloc(const char *input,
+                                             const TokenSpan *spans,
+                                             int num_items,
+                                             const FeatureVocab *vocab,
+                                             TokenCache *cache) {
+  Size items_size = MAXALIGN(Max(num_items, 1) * sizeof(CrfSuiteItem));
+  char *block = palloc(items_size + span_features_size(spans, num_items));
+
+  extract_span_features(input, spans, num_items, input_is_utf8(), vocab, cache,
+                        (CrfSuiteItem *)block, block + items_size);
+  return (CrfSuiteItem *)block;
+}
+
+/*
+ * Returns the token cache, (re)built if pg_usaddress.token_cache_size has
+ * changed since, or NULL if it is disabled.
+ */
+static TokenCache *get_token_cache(void) {
+  if (token_cache && token_cache_entries != token_cache_size) {
+    token_cache_free(token_cache);
+    token_cache = NULL;
+  }
+  if (!token_cache && token_cache_size > 0 && usaddress_model) {
+    /* Out of memory only costs the speedup */
+    token_cache = token_cache_create(usaddress_model, token_cache_size);
+    token_cache_entries = token_cache_size;
+  }
+  return token_cache;
+}
+
+/* Resizes the model's state cache if pg_usaddress.state_cache_size changed */
+static void apply_state_cache_size(void) {
+  if (state_cache_applied_kb == state_cache_size_kb || !usaddress_model)
+    return;
+  /* Out of memory only costs the speedup */
+  crfsuite_model_set_state_cache(usaddress_model,
+                                 (size_t)state_cache_size_kb * 1024);
+  state_cache_applied_kb = state_cache_size_kb;
+}
+
+/* Returns the fast path for the loaded model, or NULL if it lacks a label */
+static const FastPath *get_fast_path(void) {
+  if (fast_path_generation != model_generation || !usaddress_model) {
+    fast_path_usable = usaddress_model &&
+                       fast_path_init(&fast_path, usaddress_model) == 0;
+    fast_path_generation = model_generation;
+  }
+  return fast_path_usable ? &fast_path : NULL;
+}
+
+/*
+ * Runs the fast path over the num_items tokens of parsed in "verify" mode.
+ * Returns the labels of a canonical address, to be checked against the
+ * model's by verify_fast_path(), or NULL.
+ */
+static int *try_fast_path(const ParsedAddress *parsed, int num_items) {
+  const FastPath *fp;
+  int *label_ids;
+  bool matched;
+
+  if (fast_path_mode == FAST_PATH_OFF || (fp = get_fast_path()) == NULL)
+    return NULL;
+
+  phase_begin();
+  label_ids = palloc(Max(num_items, 1) * sizeof(int));
+  matched = fast_path_tag(fp, parsed->input, parsed->spans, num_items,
+                          label_ids);
+  phase_end(PHASE_FAST_PATH);
+  if (!matched) {
+    pfree(label_ids);
+    return NULL;
+  }
+
+  stats_add(STAT_FAST_PATH_MATCHES, 1);
+  return label_ids;
+}
+
+/* Logs the first token the fast path labeled differently from the model */
+static void verify_fast_path(const ParsedAddress *parsed,
+                             const int *verify_ids) {
+  int quoted;
+  int i;
+
+  for (i = 0; i < parsed->num_tokens; i++) {
+    if (verify_ids[i] != parsed->label_ids[i])
+      break;
+  }
+  if (i == parsed->num_tokens)
+    return;
+
+  stats_add(STAT_FAST_PATH_MISMATCHES, 1);
+  quoted = pg_mbcliplen(parsed->input, parsed->input_len, LOG_INPUT_MAX);
+  ereport(LOG,
+          (errmsg("pg_usaddress: fast path labeled \"%.*s\" %s, the model %s",
+                  parsed->spans[i].length, TOKEN_TEXT(parsed, i),
+                  crfsuite_model_label(usaddress_model, verify_ids[i]),
+                  crfsuite_model_label(usaddress_model,
+                                       parsed->label_ids[i])),
+           errdetail_internal("Input: \"%.*s%s\"", quoted, parsed->input,
+                              quoted < parsed->input_len ? "..." : ""),
+           errhidestmt(true)));
+}
+
+/*
+ * Tokenizes and tags the text argument into parsed. Inputs found in the
+ * backend's parse cache, or else in the shared one, skip tokenization,
+ * feature extraction and decoding altogether. The arrays in parsed are
+ * palloc'd in the current memory context.
+ *
+ * Inputs over pg_usaddress.max_input_bytes or max_tokens are handled as
+ * pg_usaddress.overflow_action says, and their results are not cached.
+ */
+static void tag_address(text *arg, ParsedAddress *parsed) {
   CrfSuiteItem *crf_items;
-  char **labels = NULL;
-  typedef struct LabelBuf {
-    char *label;
-    StringInfoData buf;
-    struct LabelBuf *next;
-  } LabelBuf;
-  LabelBuf *head = NULL;
-  LabelBuf *curr;
+  int *verify_ids = NULL;
+  TokenCache *cache;
+  uint64_t hits, misses;
+  CrfSuiteTagTimings timings = {0, 0, 0};
+  bool overflowed;
+  int num_items = 0;
+  int num_tagged;
+  int start, len;
+
+  parsed->input = text_to_cstring(arg);
+  parsed->input_len = strlen(parsed->input);
+  parse_call.input = VARDATA_ANY(arg);
+  parse_call.input_len = VARSIZE_ANY_EXHDR(arg);
+
+  /* Checked first, as the input length bounds the tokenizer's work */
+  overflowed = check_input_bytes(parsed->input, &parsed->input_len);
+
+  if (!overflowed && parse_cache_lookup(model_generation, parsed)) {
+    stats_add(STAT_CACHE_HITS, 1);
+    parse_call.num_tokens = parsed->num_tokens;
+    return;
+  }
+  if (!overflowed && input_is_utf8() &&
+      shared_cache_lookup(model_generation, parsed)) {
+    stats_add(STAT_SHARED_CACHE_HITS, 1);
+    parse_call.num_tokens = parsed->num_tokens;
+    parse_cache_store(model_generation, parsed);
+    return;
+  }
+
+  phase_begin();
+  num_items = tokenize_palloc(parsed->input, parsed->input_len, &parsed->spans);
+  phase_end(PHASE_TOKENIZE);
+
+  num_tagged = check_num_tokens(num_items, &overflowed);
+
+  if (!overflowed)
+    verify_ids = try_fast_path(parsed, num_items);
+
+  phase_begin();
+  cache = get_token_cache();
+  crf_items = extract_features_palloc(parsed->input, parsed->spans,
+                                      num_tagged, feature_vocab, cache);
+  if (cache) {
+    token_cache_take_counts(cache, &hits, &misses);
+    stats_add(STAT_TOKEN_CACHE_HITS, hits);
+    stats_add(STAT_TOKEN_CACHE_MISSES, misses);
+  }
+  phase_end(PHASE_FEATURES);
+
+  tag_calls++;
+  apply_state_cache_size();
+  parsed->num_tokens = num_tagged;
+  parsed->label_ids = palloc(Max(num_tagged, 1) * sizeof(int));
+
+  /*
+   * Split inputs are tagged a segment at a time, which bounds the decoder's
+   * per-call context; everything else is a single segment. Tokens at segment
+   * edges keep their features from the neighbouring segment.
+   */
+  start = 0;
+  do {
+    if (overflowed && overflow_action == OVERFLOW_SPLIT)
+      len = next_segment_length(parsed, start, num_tagged);
+    else
+      len = num_tagged;
+    if (crfsuite_model_tag_ids(usaddress_model, crf_items + start, len,
+                               parsed->label_ids + start, &timings) != 0)
+      ereport(ERROR, (errmsg("Tagging failed")));
+    start += len;
+  } while (start < num_tagged);
+
+  parse_call.num_tokens = num_tagged;
+  parse_call.tokens_tagged = num_tagged;
+  parse_call.phase_ns[PHASE_ATTR_LOOKUP] += timings.attr_lookup_ns;
+  parse_call.phase_ns[PHASE_STATE_SCORE] += timings.state_score_ns;
+  parse_call.phase_ns[PHASE_VITERBI] += timings.viterbi_ns;
+  crfsuite_model_state_cache_take_counts(usaddress_model, &hits, &misses);
+  stats_add(STAT_STATE_CACHE_HITS, hits);
+  stats_add(STAT_STATE_CACHE_MISSES, misses);
+
+  pfree(crf_items);
+  if (verify_ids) {
+    verify_fast_path(parsed, verify_ids);
+    pfree(verify_ids);
+  }
+
+  if (!overflowed) {
+    parse_cache_store(model_generation, parsed);
+    if (input_is_utf8())
+      shared_cache_store(model_generation, parsed);
+  }
+}
+
+static void free_parsed_address(ParsedAddress *parsed) {
+  pfree(parsed->spans);
+  pfree(parsed->label_ids);
+  pfree(parsed->input);
+}
+
+PG_FUNCTION_INFO_V1(parse_address_crf);
+Datum parse_address_crf(PG_FUNCTION_ARGS) {
+  SrfCallCache *cache;
+  Tuplestorestate *tupstore;
+  ParsedAddress parsed;
   int i;
-  StringInfoData json_str;
-  bool first;
-  Datum jsonb_datum;
 
   load_model_if_needed();
   if (!usaddress_model)
     ereport(ERROR, (errmsg("Model not loaded")));
 
-  arg = PG_GETARG_TEXT_PP(0);
-  input_str = text_to_cstring(arg);
+  begin_parse_call(ENTRY_PARSE_ADDRESS_CRF);
+  cache = get_srf_call_cache(fcinfo);
+  tupstore = begin_materialize_srf(fcinfo, cache->tupdesc);
 
-  tokens = tokenize_and_extract_features(input_str, &num_items);
+  tag_address(PG_GETARG_TEXT_PP(0), &parsed);
 
-  crf_items = malloc(num_items * sizeof(CrfSuiteItem));
-  for (i = 0; i < num_items; i++)
-    crf_items[i] = tokens[i].features;
+  phase_begin();
+  for (i = 0; i < parsed.num_tokens; i++) {
+    Datum values[2];
+    bool nulls[2] = {false, false};
 
-  if (crfsuite_model_tag(usaddress_model, crf_items, num_items, &labels) != 0) {
-    free(crf_items);
-    free_token_features(tokens, num_items);
-    ereport(ERROR, (errmsg("Tagging failed")));
+    // Filter out commas
+    if (token_is_comma(&parsed, i))
+      continue;
+
+    values[0] = PointerGetDatum(cstring_to_text_with_len(
+        TOKEN_TEXT(&parsed, i), parsed.spans[i].length));
+    values[1] = cache->label_datums[parsed.label_ids[i]];
+    tuplestore_putvalues(tupstore, cache->tupdesc, values, nulls);
   }
+  phase_end(PHASE_OUTPUT);
 
-  free(crf_items);
+  free_parsed_address(&parsed);
+  end_parse_call();
 
-  for (i = 0; i < num_items; i++) {
-    char *lbl = labels[i];
-    char *tok = tokens[i].token;
+  return (Datum)0;
+}
 
-    // Optional: Filter commas in JSON? The user didn't explicitly ask for this
-    // in JSON, but likely "no commas in parsing" applies here too. However, for
-    // JSON construction, maybe we just skip them? Let's stick to the SRF
-    // function first as that's what the test output shows. Leaving JSON
-    // function as is for now unless tests fail there too.
+/* Addresses tagged together by parse_address_crf_batch() */
+#define BATCH_SIZE 1024
+
+/*
+ * Like tag_address(), for an address of parse_address_crf_batch() that is
+ * tagged on its own. Adds its token counts to the batch's.
+ */
+static void tag_address_alone(text *arg, ParsedAddress *parsed,
+                              int *num_tokens, int *tokens_tagged) {
+  parse_call.num_tokens = 0;
+  parse_call.tokens_tagged = 0;
+  tag_address(arg, parsed);
+  *num_tokens += parse_call.num_tokens;
+  *tokens_tagged += parse_call.tokens_tagged;
+}
 
-    curr = head;
-    while (curr) {
-      if (strcmp(curr->label, lbl) == 0)
-        break;
-      curr = curr->next;
+/*
+ * Tokenizes and tags num_args addresses into parsed. Addresses found in a
+ * parse cache are served from it and those over the input limits go through
+ * tag_address(); the rest are tagged in a single batch, in which addresses
+ * that end with the same tokens (", Chicago, IL 60601") share the state
+ * scores and decoding work of that tail.
+ */
+static void tag_address_batch(text **args, int num_args,
+                              ParsedAddress *parsed) {
+  CrfSuiteItem **items = palloc(num_args * sizeof(CrfSuiteItem *));
+  int *num_items = palloc(num_args * sizeof(int));
+  int **label_ids = palloc(num_args * sizeof(int *));
+  ParsedAddress **pending = palloc(num_args * sizeof(ParsedAddress *));
+  int **verify_ids = palloc(num_args * sizeof(int *));
+  TokenCache *cache = get_token_cache();
+  CrfSuiteTagTimings timings = {0, 0, 0};
+  uint64_t hits, misses;
+  int num_pending = 0;
+  int num_tokens = 0;
+  int tokens_tagged = 0;
+  int i, k;
+
+  for (i = 0; i < num_args; i++) {
+    ParsedAddress *p = &parsed[i];
+    int n;
+
+    p->input = text_to_cstring(args[i]);
+    p->input_len = strlen(p->input);
+    if (max_input_bytes > 0 && p->input_len > max_input_bytes) {
+      pfree(p->input);
+      tag_address_alone(args[i], p, &num_tokens, &tokens_tagged);
+      continue;
+    }
+    if (parse_cache_lookup(model_generation, p)) {
+      stats_add(STAT_CACHE_HITS, 1);
+      num_tokens += p->num_tokens;
+      continue;
+    }
+    if (input_is_utf8() && shared_cache_lookup(model_generation, p)) {
+      stats_add(STAT_SHARED_CACHE_HITS, 1);
+      num_tokens += p->num_tokens;
+      parse_cache_store(model_generation, p);
+      continue;
     }
 
-    if (!curr) {
-      curr = palloc(sizeof(LabelBuf));
-      curr->label = pstrdup(lbl);
-      initStringInfo(&curr->buf);
-      curr->next = head;
-      head = curr;
-    } else {
-      appendStringInfoString(&curr->buf, " ");
+    phase_begin();
+    n = tokenize_palloc(p->input, p->input_len, &p->spans);
+    phase_end(PHASE_TOKENIZE);
+    /* Inputs without tokens fail in tag_address(), as they do on their own */
+    if (n == 0 || (max_tokens > 0 && n > max_tokens)) {
+      pfree(p->spans);
+      pfree(p->input);
+      tag_address_alone(args[i], p, &num_tokens, &tokens_tagged);
+      continue;
     }
-    appendStringInfoString(&curr->buf, tok);
+    verify_ids[num_pending] = try_fast_path(p, n);
+
+    phase_begin();
+    items[num_pending] =
+        extract_features_palloc(p->input, p->spans, n, feature_vocab, cache);
+    phase_end(PHASE_FEATURES);
+    p->num_tokens = n;
+    p->label_ids = palloc(Max(n, 1) * sizeof(int));
+    num_items[num_pending] = n;
+    label_ids[num_pending] = p->label_ids;
+    pending[num_pending++] = p;
   }
 
-  initStringInfo(&json_str);
-  appendStringInfoChar(&json_str, '{');
+  if (cache) {
+    token_cache_take_counts(cache, &hits, &misses);
+    stats_add(STAT_TOKEN_CACHE_HITS, hits);
+    stats_add(STAT_TOKEN_CACHE_MISSES, misses);
+  }
+
+  if (num_pending > 0) {
+    tag_calls++;
+    if (crfsuite_model_tag_batch(usaddress_model, items, num_items,
+                                 num_pending, label_ids, &timings,
+                                 NULL) != 0)
+      ereport(ERROR, (errmsg("Tagging failed")));
+    parse_call.phase_ns[PHASE_ATTR_LOOKUP] += timings.attr_lookup_ns;
+    parse_call.phase_ns[PHASE_STATE_SCORE] += timings.state_score_ns;
+    parse_call.phase_ns[PHASE_VITERBI] += timings.viterbi_ns;
+  }
 
-  curr = head;
-  first = true;
-  while (curr) {
-    if (!first)
-      appendStringInfoString(&json_str, ", ");
-    escape_json(&json_str, curr->label);
-    appendStringInfoString(&json_str, ": ");
-    escape_json(&json_str, curr->buf.data);
-    first = false;
-    curr = curr->next;
+  for (k = 0; k < num_pending; k++) {
+    num_tokens += num_items[k];
+    tokens_tagged += num_items[k];
+    pfree(items[k]);
+    if (verify_ids[k])
+      verify_fast_path(pending[k], verify_ids[k]);
+    parse_cache_store(model_generation, pending[k]);
+    if (input_is_utf8())
+      shared_cache_store(model_generation, pending[k]);
   }
-  appendStringInfoChar(&json_str, '}');
 
-  jsonb_datum = DirectFunctionCall1(jsonb_in, CStringGetDatum(json_str.data));
-  free_token_features(tokens, num_items);
-  for (i = 0; i < num_items; i++)
-    free(labels[i]);
-  free(labels);
-  PG_RETURN_JSONB_P(DatumGetJsonbP(jsonb_datum));
+  parse_call.num_tokens = num_tokens;
+  parse_call.tokens_tagged = tokens_tagged;
+  pfree(items);
+  pfree(num_items);
+  pfree(label_ids);
+  pfree(pending);
+  pfree(verify_ids);
 }
 
-PG_FUNCTION_INFO_V1(parse_address_crf_cols);
-Datum parse_address_crf_cols(PG_FUNCTION_ARGS) {
-  text *arg;
-  char *input_str;
-  int num_items = 0;
-  TokenFeatures *tokens;
-  CrfSuiteItem *crf_items;
-  char **labels = NULL;
-  TupleDesc tupdesc;
-  int natts;
-  Datum *values;
-  bool *nulls;
-  StringInfoData *buffers;
-  bool *has_content;
-  int i;
-  HeapTuple tuple;
+PG_FUNCTION_INFO_V1(parse_address_crf_batch);
+Datum parse_address_crf_batch(PG_FUNCTION_ARGS) {
+  ArrayType *array = PG_GETARG_ARRAYTYPE_P(0);
+  SrfCallCache *cache;
+  Tuplestorestate *tupstore;
+  MemoryContext batch_context;
+  MemoryContext oldcontext;
+  Datum *elems;
+  bool *elem_nulls;
+  int num_elems;
+  text **args;
+  int *arg_index;
+  ParsedAddress *parsed;
+  int num_tokens = 0;
+  int tokens_tagged = 0;
+  int start;
 
   load_model_if_needed();
   if (!usaddress_model)
     ereport(ERROR, (errmsg("Model not loaded")));
 
-  arg = PG_GETARG_TEXT_PP(0);
-  input_str = text_to_cstring(arg);
+  begin_parse_call(ENTRY_PARSE_ADDRESS_CRF_BATCH);
+  cache = get_srf_call_cache(fcinfo);
+  tupstore = begin_materialize_srf(fcinfo, cache->tupdesc);
+
+  deconstruct_array(array, TEXTOID, -1, false, TYPALIGN_INT, &elems,
+                    &elem_nulls, &num_elems);
+  args = palloc(Min(num_elems, BATCH_SIZE) * sizeof(text *));
+  arg_index = palloc(Min(num_elems, BATCH_SIZE) * sizeof(int));
+  parsed = palloc(Min(num_elems, BATCH_SIZE) * sizeof(ParsedAddress));
 
-  tokens = tokenize_and_extract_features(input_str, &num_items);
+  /* Each chunk's addresses are freed once its rows are in the tuplestore */
+  batch_context = AllocSetContextCreate(CurrentMemoryContext,
+                                        "parse_address_crf_batch",
+                                        ALLOCSET_DEFAULT_SIZES);
 
-  crf_items = malloc(num_items * sizeof(CrfSuiteItem));
-  for (i = 0; i < num_items; i++)
-    crf_items[i] = tokens[i].features;
+  for (start = 0; start < num_elems; start += BATCH_SIZE) {
+    int num_args = 0;
+    int a, i;
 
-  if (crfsuite_model_tag(usaddress_model, crf_items, num_items, &labels) != 0) {
-    free(crf_items);
-    free_token_features(tokens, num_items);
-    ereport(ERROR, (errmsg("Tagging failed")));
+    for (i = start; i < num_elems && i < start + BATCH_SIZE; i++) {
+      if (elem_nulls[i])
+        continue;
+      args[num_args] = DatumGetTextPP(elems[i]);
+      arg_index[num_args++] = i + 1;
+    }
+
+    oldcontext = MemoryContextSwitchTo(batch_context);
+    tag_address_batch(args, num_args, parsed);
+    num_tokens += parse_call.num_tokens;
+    tokens_tagged += parse_call.tokens_tagged;
+
+    phase_begin();
+    for (a = 0; a < num_args; a++) {
+      for (i = 0; i < parsed[a].num_tokens; i++) {
+        Datum values[3];
+        bool nulls[3] = {false, false, false};
+
+        if (token_is_comma(&parsed[a], i))
+          continue;
+
+        values[0] = Int32GetDatum(arg_index[a]);
+        values[1] = PointerGetDatum(cstring_to_text_with_len(
+            TOKEN_TEXT(&parsed[a], i), parsed[a].spans[i].length));
+        values[2] = cache->label_datums[parsed[a].label_ids[i]];
+        tuplestore_putvalues(tupstore, cache->tupdesc, values, nulls);
+      }
+    }
+    phase_end(PHASE_OUTPUT);
+
+    MemoryContextSwitchTo(oldcontext);
+    MemoryContextReset(batch_context);
   }
-  free(crf_items);
 
-  if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE) {
-    ereport(ERROR, (errmsg("return type must be a row type")));
+  MemoryContextDelete(batch_context);
+  parse_call.num_tokens = num_tokens;
+  parse_call.tokens_tagged = tokens_tagged;
+  /* No single input to quote in the slow call log */
+  parse_call.input = NULL;
+  end_parse_call();
+
+  return (Datum)0;
+}
+
+PG_FUNCTION_INFO_V1(tag_address_crf);
+Datum tag_address_crf(PG_FUNCTION_ARGS) {
+  ParsedAddress parsed;
+  int num_labels;
+  int *label_len;
+  int *label_off;
+  int *label_used;
+  char *buf;
+  int total = 0;
+  JsonbParseState *state = NULL;
+  JsonbValue *res;
+  Jsonb *result;
+  int i, l;
+
+  load_model_if_needed();
+  if (!usaddress_model)
+    ereport(ERROR, (errmsg("Model not loaded")));
+
+  begin_parse_call(ENTRY_TAG_ADDRESS_CRF);
+  tag_address(PG_GETARG_TEXT_PP(0), &parsed);
+
+  phase_begin();
+
+  /*
+   * Each label maps to its tokens joined by spaces. Size those strings per
+   * label id, lay them out in one buffer, then copy the tokens in.
+   */
+  num_labels = crfsuite_model_num_labels(usaddress_model);
+  label_len = palloc0(num_labels * sizeof(int));
+  label_off = palloc(num_labels * sizeof(int));
+  label_used = palloc0(num_labels * sizeof(int));
+
+  for (i = 0; i < parsed.num_tokens; i++) {
+    l = parsed.label_ids[i];
+    if (label_len[l] > 0)
+      label_len[l]++;
+    label_len[l] += parsed.spans[i].length;
+  }
+  for (l = 0; l < num_labels; l++) {
+    label_off[l] = total;
+    total += label_len[l];
   }
 
-  natts = tupdesc->natts;
-  values = palloc0(natts * sizeof(Datum));
-  nulls = palloc0(natts * sizeof(bool));
-  for (i = 0; i < natts; i++)
-    nulls[i] = true;
+  buf = palloc(Max(total, 1));
+  for (i = 0; i < parsed.num_tokens; i++) {
+    int len = parsed.spans[i].length;
+    char *dst;
+
+    l = parsed.label_ids[i];
+    dst = buf + label_off[l] + label_used[l];
+    if (label_used[l] > 0) {
+      *dst++ = ' ';
+      label_used[l]++;
+    }
+    memcpy(dst, TOKEN_TEXT(&parsed, i), len);
+    label_used[l] += len;
+  }
+
+  /* Build the jsonb object directly; jsonb orders the keys itself */
+  pushJsonbValue(&state, WJB_BEGIN_OBJECT, NULL);
+  for (l = 0; l < num_labels; l++) {
+    JsonbValue key;
+    JsonbValue val;
+    const char *lbl;
+
+    if (label_len[l] == 0)
+      continue;
+
+    lbl = crfsuite_model_label(usaddress_model, l);
+    key.type = jbvString;
+    key.val.string.val = (char *)lbl;
+    key.val.string.len = strlen(lbl);
+    pushJsonbValue(&state, WJB_KEY, &key);
+
+    val.type = jbvString;
+    val.val.string.val = buf + label_off[l];
+    val.val.string.len = label_len[l];
+    pushJsonbValue(&state, WJB_VALUE, &val);
+  }
+  res = pushJsonbValue(&state, WJB_END_OBJECT, NULL);
+  result = JsonbValueToJsonb(res);
+  phase_end(PHASE_OUTPUT);
+
+  free_parsed_address(&parsed);
+  end_parse_call();
+  PG_RETURN_JSONB_P(result);
+}
+
+/*
+ * Query-lifetime memo for parse_address_crf_cols(). PostgreSQL evaluates
+ * (f(x)).a, (f(x)).b and (f(x)).* as one call per referenced column, each with
+ * its own FmgrInfo, so fn_extra cannot carry the result between them. All call
+ * sites of one query share the per-query fn_mcxt, though, so the memo belongs
+ * to that context and is forgotten when the context is reset.
+ */
+typedef struct ColsMemo {
+  MemoryContext mcxt;
+  MemoryContextCallback reset_cb;
+  char *input; /* NULL until a result has been stored */
+  int input_len;
+  int num_tokens;
+  Datum result;
+} ColsMemo;
+
+static ColsMemo *cols_memo = NULL;
+
+static void cols_memo_reset(void *arg) {
+  if (cols_memo == (ColsMemo *)arg)
+    cols_memo = NULL;
+}
+
+static ColsMemo *get_cols_memo(MemoryContext mcxt) {
+  if (cols_memo && cols_memo->mcxt == mcxt)
+    return cols_memo;
+
+  cols_memo = MemoryContextAllocZero(mcxt, sizeof(ColsMemo));
+  cols_memo->mcxt = mcxt;
+  cols_memo->reset_cb.func = cols_memo_reset;
+  cols_memo->reset_cb.arg = cols_memo;
+  MemoryContextRegisterResetCallback(mcxt, &cols_memo->reset_cb);
+  return cols_memo;
+}
+
+/*
+ * Per-call-site state for parse_address_crf_cols(), kept in fn_extra. Maps
+ * each model label id to the result column it fills, so tokens are routed to
+ * columns by index. The mapping is rebuilt when the typcache reports a new
+ * descriptor for the result type (e.g. after ALTER TYPE).
+ */
+typedef struct ColsCallCache {
+  Oid typid;
+  uint64 tupdesc_id; /* typcache tupDesc_identifier of tupdesc */
+  TupleDesc tupdesc;
+  int num_labels;
+  int *label_attnum; /* column index per label id, or -1 */
+  Datum *values;
+  bool *nulls;
+  int *col_len; /* scratch: text length per column */
+} ColsCallCache;
+
+static void build_cols_mapping(ColsCallCache *cache, TypeCacheEntry *typentry,
+                               MemoryContext mcxt) {
+  MemoryContext oldcontext = MemoryContextSwitchTo(mcxt);
+  TupleDesc tupdesc;
+  int natts;
+  int l, c;
 
-  buffers = palloc0(natts * sizeof(StringInfoData));
-  has_content = palloc0(natts * sizeof(bool));
+  if (cache->tupdesc) {
+    FreeTupleDesc(cache->tupdesc);
+    pfree(cache->values);
+    pfree(cache->nulls);
+    pfree(cache->col_len);
+  }
 
-  for (i = 0; i < num_items; i++) {
-    char *lbl = labels[i];
-    char *tok = tokens[i].token;
+  tupdesc = CreateTupleDescCopy(typentry->tupDesc);
+  natts = tupdesc->natts;
+  cache->tupdesc = tupdesc;
+  cache->tupdesc_id = typentry->tupDesc_identifier;
+  cache->values = palloc(natts * sizeof(Datum));
+  cache->nulls = palloc(natts * sizeof(bool));
+  cache->col_len = palloc(natts * sizeof(int));
 
-    int match_idx = -1;
-    int c;
+  for (l = 0; l < cache->num_labels; l++) {
+    const char *lbl = crfsuite_model_label(usaddress_model, l);
 
-    for (c = 0; c < natts; c++) {
+    cache->label_attnum[l] = -1;
+    for (c = 0; lbl && c < natts; c++) {
       Form_pg_attribute attr = TupleDescAttr(tupdesc, c);
       char *col_name;
       char clean_col[NAMEDATALEN];
@@ -342,6 +1192,7 @@ Datum parse_address_crf_cols(PG_FUNCTION_ARGS) {
       if (attr->attisdropped)
         continue;
 
+      /* Column names are the label in snake_case, e.g. zip_code/ZipCode */
       col_name = NameStr(attr->attname);
       while (col_name[ci]) {
         if (col_name[ci] != '_')
@@ -351,186 +1202,635 @@ Datum parse_address_crf_cols(PG_FUNCTION_ARGS) {
       clean_col[cj] = '\0';
 
       if (strcasecmp(clean_col, lbl) == 0) {
-        match_idx = c;
+        cache->label_attnum[l] = c;
         break;
       }
     }
+  }
 
-    if (match_idx >= 0) {
-      if (!has_content[match_idx]) {
-        initStringInfo(&buffers[match_idx]);
-        has_content[match_idx] = true;
-      } else {
-        appendStringInfoString(&buffers[match_idx], " ");
-      }
-      appendStringInfoString(&buffers[match_idx], tok);
+  MemoryContextSwitchTo(oldcontext);
+}
+
+static ColsCallCache *get_cols_call_cache(FunctionCallInfo fcinfo) {
+  ColsCallCache *cache = (ColsCallCache *)fcinfo->flinfo->fn_extra;
+  MemoryContext mcxt = fcinfo->flinfo->fn_mcxt;
+  TypeCacheEntry *typentry;
+
+  if (!cache) {
+    TupleDesc tupdesc;
+
+    if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE) {
+      ereport(ERROR, (errmsg("return type must be a row type")));
     }
+
+    cache = MemoryContextAllocZero(mcxt, sizeof(ColsCallCache));
+    cache->typid = tupdesc->tdtypeid;
+    cache->num_labels = crfsuite_model_num_labels(usaddress_model);
+    cache->label_attnum =
+        MemoryContextAlloc(mcxt, Max(cache->num_labels, 1) * sizeof(int));
+    fcinfo->flinfo->fn_extra = cache;
   }
 
+  typentry = lookup_type_cache(cache->typid, TYPECACHE_TUPDESC);
+  if (typentry->tupDesc == NULL)
+    ereport(ERROR, (errmsg("return type must be a row type")));
+  if (!cache->tupdesc || cache->tupdesc_id != typentry->tupDesc_identifier)
+    build_cols_mapping(cache, typentry, mcxt);
+
+  return cache;
+}
+
+PG_FUNCTION_INFO_V1(parse_address_crf_cols);
+Datum parse_address_crf_cols(PG_FUNCTION_ARGS) {
+  text *arg;
+  int input_len;
+  ColsMemo *memo;
+  ColsCallCache *cache;
+  ParsedAddress parsed;
+  int natts;
+  Datum *values;
+  bool *nulls;
+  int *col_len;
+  char **col_pos;
+  int i;
+  HeapTuple tuple;
+  Datum result;
+  MemoryContext oldcontext;
+
+  load_model_if_needed();
+  if (!usaddress_model)
+    ereport(ERROR, (errmsg("Model not loaded")));
+
+  begin_parse_call(ENTRY_PARSE_ADDRESS_CRF_COLS);
+  arg = PG_GETARG_TEXT_PP(0);
+  input_len = VARSIZE_ANY_EXHDR(arg);
+
+  /* Same input as the previous call in this query: reuse its row */
+  memo = get_cols_memo(fcinfo->flinfo->fn_mcxt);
+  if (memo->input && memo->input_len == input_len &&
+      memcmp(memo->input, VARDATA_ANY(arg), input_len) == 0) {
+    parse_call.input = memo->input;
+    parse_call.input_len = input_len;
+    parse_call.num_tokens = memo->num_tokens;
+    phase_begin();
+    result = datumCopy(memo->result, false, -1);
+    phase_end(PHASE_OUTPUT);
+    end_parse_call();
+    PG_RETURN_DATUM(result);
+  }
+
+  cache = get_cols_call_cache(fcinfo);
+
+  tag_address(arg, &parsed);
+
+  phase_begin();
+  natts = cache->tupdesc->natts;
+  values = cache->values;
+  nulls = cache->nulls;
+  col_len = cache->col_len;
+  memset(col_len, 0, natts * sizeof(int));
+
+  /* First pass: size each column (tokens joined by single spaces) */
+  for (i = 0; i < parsed.num_tokens; i++) {
+    int c = cache->label_attnum[parsed.label_ids[i]];
+
+    if (c < 0)
+      continue;
+    if (col_len[c] > 0)
+      col_len[c]++;
+    col_len[c] += parsed.spans[i].length;
+  }
+
+  /* Allocate each non-empty column's text Datum at its final size */
+  col_pos = palloc(natts * sizeof(char *));
   for (i = 0; i < natts; i++) {
-    if (has_content[i]) {
-      values[i] = CStringGetTextDatum(buffers[i].data);
-      nulls[i] = false;
+    text *t;
+
+    if (col_len[i] == 0) {
+      values[i] = (Datum)0;
+      nulls[i] = true;
+      continue;
     }
+    t = (text *)palloc(VARHDRSZ + col_len[i]);
+    SET_VARSIZE(t, VARHDRSZ + col_len[i]);
+    col_pos[i] = VARDATA(t);
+    values[i] = PointerGetDatum(t);
+    nulls[i] = false;
   }
 
-  tuple = heap_form_tuple(tupdesc, values, nulls);
-  free_token_features(tokens, num_items);
-  for (i = 0; i < num_items; i++)
-    free(labels[i]);
-  free(labels);
+  /* Second pass: copy the tokens in */
+  for (i = 0; i < parsed.num_tokens; i++) {
+    int c = cache->label_attnum[parsed.label_ids[i]];
+    int len;
+
+    if (c < 0)
+      continue;
+    if (col_pos[c] != VARDATA(DatumGetPointer(values[c])))
+      *col_pos[c]++ = ' ';
+    len = parsed.spans[i].length;
+    memcpy(col_pos[c], TOKEN_TEXT(&parsed, i), len);
+    col_pos[c] += len;
+  }
 
-  PG_RETURN_DATUM(HeapTupleGetDatum(tuple));
-}
+  tuple = heap_form_tuple(cache->tupdesc, values, nulls);
+  result = HeapTupleGetDatum(tuple);
+  for (i = 0; i < natts; i++) {
+    if (!nulls[i])
+      pfree(DatumGetPointer(values[i]));
+  }
+  pfree(col_pos);
+  free_parsed_address(&parsed);
 
-/* Helper: uppercase a string in-place */
-static void str_to_upper(char *s) {
-  for (; *s; s++) {
-    *s = toupper((unsigned char)*s);
+  if (memo->input) {
+    pfree(memo->input);
+    pfree(DatumGetPointer(memo->result));
+    memo->input = NULL;
   }
+  oldcontext = MemoryContextSwitchTo(memo->mcxt);
+  memo->result = datumCopy(result, false, -1);
+  memo->input_len = input_len;
+  memo->num_tokens = parsed.num_tokens;
+  memo->input = pnstrdup(VARDATA_ANY(arg), input_len);
+  MemoryContextSwitchTo(oldcontext);
+  phase_end(PHASE_OUTPUT);
+
+  end_parse_call();
+  PG_RETURN_DATUM(result);
 }
 
 PG_FUNCTION_INFO_V1(parse_address_crf_normalized);
 Datum parse_address_crf_normalized(PG_FUNCTION_ARGS) {
-  FuncCallContext *funcctx;
-  int call_cntr;
-  int max_calls;
-
-  if (SRF_IS_FIRSTCALL()) {
-    MemoryContext oldcontext;
-    text *arg;
-    char *input_str;
-    int num_items = 0;
-    TokenFeatures *tokens = NULL;
-    CrfSuiteItem *crf_items;
-    char **labels = NULL;
-    int i;
-    int filtered_count = 0;
-    int current_idx = 0;
+  SrfCallCache *cache;
+  Tuplestorestate *tupstore;
+  ParsedAddress parsed;
+  NormalizedToken *out;
+  int num_out;
+  int max_len = 0;
+  text *token;
+  int i;
 
-    typedef struct {
-      char **tokens;
-      char **labels;
-      int num_items;
-    } UserCtx;
-    UserCtx *uctx;
+  load_model_if_needed();
+  if (!usaddress_model)
+    ereport(ERROR, (errmsg("Model not loaded")));
 
-    load_model_if_needed();
-    if (!usaddress_model)
-      ereport(ERROR, (errmsg("Model not loaded")));
+  begin_parse_call(ENTRY_PARSE_ADDRESS_CRF_NORMALIZED);
+  cache = get_srf_call_cache(fcinfo);
+  tupstore = begin_materialize_srf(fcinfo, cache->tupdesc);
+
+  tag_address(PG_GETARG_TEXT_PP(0), &parsed);
+
+  phase_begin();
+  out = palloc(parsed.num_tokens * sizeof(NormalizedToken));
+  num_out = normalize_address(usaddress_model, &parsed, out);
+  phase_end(PHASE_NORMALIZE);
+
+  /*
+   * The tuplestore copies each row, so one text buffer serves for every
+   * token; labels are the per-query label Datums.
+   */
+  for (i = 0; i < num_out; i++)
+    max_len = Max(max_len, out[i].len);
+  token = palloc(VARHDRSZ + max_len);
+  for (i = 0; i < num_out; i++) {
+    Datum values[2];
+    bool nulls[2] = {false, false};
 
-    funcctx = SRF_FIRSTCALL_INIT();
-    oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+    SET_VARSIZE(token, VARHDRSZ + out[i].len);
+    memcpy(VARDATA(token), out[i].text, out[i].len);
+    values[0] = PointerGetDatum(token);
+    values[1] = cache->label_datums[out[i].label_id];
+    tuplestore_putvalues(tupstore, cache->tupdesc, values, nulls);
+  }
+  phase_end(PHASE_OUTPUT);
 
-    if (get_call_result_type(fcinfo, NULL, &funcctx->tuple_desc) !=
-        TYPEFUNC_COMPOSITE)
-      ereport(ERROR, (errmsg("return type must be a row type")));
-    BlessTupleDesc(funcctx->tuple_desc);
+  pfree(token);
+  pfree(out);
+  free_parsed_address(&parsed);
+  end_parse_call();
 
-    arg = PG_GETARG_TEXT_PP(0);
-    input_str = text_to_cstring(arg);
+  return (Datum)0;
+}
 
-    tokens = tokenize_and_extract_features(input_str, &num_items);
+/*
+ * Components of crf_full_address_normalized(), in output order. Tokens with
+ * any other label are left out of the full address.
+ */
+static const char *const full_address_labels[] = {
+    "AddressNumber",
+    "StreetNamePreDirectional",
+    "StreetName",
+    "StreetNamePostType",
+    "StreetNamePostDirectional",
+    "OccupancyType",
+    "OccupancyIdentifier",
+    "PlaceName",
+    "StateName",
+    "ZipCode",
+};
+
+#define FULL_ADDRESS_NUM_PARTS lengthof(full_address_labels)
+#define FULL_ADDRESS_PLACE_NAME 7
+#define FULL_ADDRESS_STATE_NAME 8
+
+/* Slot in full_address_labels for each model label id, or -1 */
+static int *full_address_slots = NULL;
+
+static const int *get_full_address_slots(void) {
+  int num_labels;
+  int i;
 
-    crf_items = malloc(num_items * sizeof(CrfSuiteItem));
-    for (i = 0; i < num_items; i++)
-      crf_items[i] = tokens[i].features;
+  if (full_address_slots)
+    return full_address_slots;
 
-    if (crfsuite_model_tag(usaddress_model, crf_items, num_items, &labels) !=
-        0) {
-      free(crf_items);
-      free_token_features(tokens, num_items);
-      MemoryContextSwitchTo(oldcontext);
-      ereport(ERROR, (errmsg("Tagging failed")));
-    }
+  num_labels = crfsuite_model_num_labels(usaddress_model);
+  full_address_slots =
+      MemoryContextAlloc(TopMemoryContext, Max(num_labels, 1) * sizeof(int));
+  for (i = 0; i < num_labels; i++) {
+    const char *lbl = crfsuite_model_label(usaddress_model, i);
+    int slot;
 
-    /* First pass: count tokens to keep.
-     * Rule: Remove ALL commas.
-     */
-    for (i = 0; i < num_items; i++) {
-      if (strcmp(tokens[i].token, ",") != 0) {
-        filtered_count++;
+    full_address_slots[i] = -1;
+    for (slot = 0; lbl && slot < (int)FULL_ADDRESS_NUM_PARTS; slot++) {
+      if (strcmp(lbl, full_address_labels[slot]) == 0) {
+        full_address_slots[i] = slot;
+        break;
       }
     }
+  }
 
-    uctx = (UserCtx *)palloc(sizeof(UserCtx));
-    uctx->tokens = palloc(filtered_count * sizeof(char *));
-    uctx->labels = palloc(filtered_count * sizeof(char *));
-    uctx->num_items = filtered_count;
-
-    /* Second pass: copy and normalize tokens */
-    for (i = 0; i < num_items; i++) {
-      if (strcmp(tokens[i].token, ",") != 0) {
-        char *tok = pstrdup(tokens[i].token);
-        char *lbl = pstrdup(labels[i]);
-        const char *mapped;
-
-        /* Uppercase the token */
-        str_to_upper(tok);
-
-        /* Apply USPS mappings based on label */
-        if (strcmp(lbl, "StreetNamePostType") == 0 ||
-            strcmp(lbl, "StreetName") == 0) {
-          /* Try to map street types */
-          mapped = lookup_street_type(tok);
-          if (mapped) {
-            pfree(tok);
-            tok = pstrdup(mapped);
-          }
-        } else if (strcmp(lbl, "OccupancyType") == 0 ||
-                   strcmp(lbl, "SubaddressType") == 0) {
-          /* Map occupancy/secondary types */
-          mapped = lookup_occupancy_type(tok);
-          if (mapped) {
-            pfree(tok);
-            tok = pstrdup(mapped);
-          }
-        }
-
-        uctx->tokens[current_idx] = tok;
-        uctx->labels[current_idx] = lbl;
-        current_idx++;
-      }
+  return full_address_slots;
+}
+
+PG_FUNCTION_INFO_V1(crf_full_address_normalized);
+Datum crf_full_address_normalized(PG_FUNCTION_ARGS) {
+  ParsedAddress parsed;
+  const int *slots;
+  NormalizedToken *out;
+  int num_out;
+  int *next;
+  int head[FULL_ADDRESS_NUM_PARTS];
+  int tail[FULL_ADDRESS_NUM_PARTS];
+  text *result;
+  char *dst;
+  int size;
+  int slot;
+  int i;
+
+  load_model_if_needed();
+  if (!usaddress_model)
+    ereport(ERROR, (errmsg("Model not loaded")));
+
+  begin_parse_call(ENTRY_CRF_FULL_ADDRESS_NORMALIZED);
+  tag_address(PG_GETARG_TEXT_PP(0), &parsed);
+  slots = get_full_address_slots();
+
+  phase_begin();
+
+  /*
+   * Thread the kept tokens into one list per component, preserving input
+   * order, then walk the components once to build the output.
+   */
+  out = palloc(parsed.num_tokens * sizeof(NormalizedToken));
+  num_out = normalize_address(usaddress_model, &parsed, out);
+  next = palloc(num_out * sizeof(int));
+  for (slot = 0; slot < (int)FULL_ADDRESS_NUM_PARTS; slot++)
+    head[slot] = tail[slot] = -1;
+
+  for (i = 0; i < num_out; i++) {
+    slot = slots[out[i].label_id];
+    if (slot < 0)
+      continue;
+
+    next[i] = -1;
+    if (tail[slot] >= 0)
+      next[tail[slot]] = i;
+    else
+      head[slot] = i;
+    tail[slot] = i;
+  }
+  phase_end(PHASE_NORMALIZE);
+
+  /*
+   * The result is written straight into a text of the final size: at most
+   * the kept components, a separator after each, and the comma.
+   */
+  size = 1;
+  for (i = 0; i < num_out; i++)
+    size += out[i].len + 1;
+  result = palloc(VARHDRSZ + size);
+  dst = VARDATA(result);
+  for (slot = 0; slot < (int)FULL_ADDRESS_NUM_PARTS; slot++) {
+    for (i = head[slot]; i >= 0; i = next[i]) {
+      if (dst > VARDATA(result))
+        *dst++ = ' ';
+      memcpy(dst, out[i].text, out[i].len);
+      dst += out[i].len;
     }
 
-    /* Free original arrays */
-    free_token_features(tokens, num_items);
-    for (i = 0; i < num_items; i++)
-      free(labels[i]);
-    free(labels);
-    free(crf_items);
+    /* Comma between city and state */
+    if (slot == FULL_ADDRESS_PLACE_NAME && head[slot] >= 0 &&
+        head[FULL_ADDRESS_STATE_NAME] >= 0)
+      *dst++ = ',';
+  }
+  SET_VARSIZE(result, dst - (char *)result);
+  phase_end(PHASE_OUTPUT);
 
-    funcctx->user_fctx = (void *)uctx;
-    funcctx->max_calls = filtered_count;
+  pfree(out);
+  pfree(next);
+  free_parsed_address(&parsed);
+  end_parse_call();
 
-    pfree(input_str);
-    MemoryContextSwitchTo(oldcontext);
+  PG_RETURN_TEXT_P(result);
+}
+
+PG_FUNCTION_INFO_V1(pg_usaddress_tag_calls);
+Datum pg_usaddress_tag_calls(PG_FUNCTION_ARGS) {
+  PG_RETURN_INT64((int64)tag_calls);
+}
+
+PG_FUNCTION_INFO_V1(pg_usaddress_cache_stats);
+Datum pg_usaddress_cache_stats(PG_FUNCTION_ARGS) {
+  TupleDesc tupdesc;
+  ParseCacheStats stats;
+  Datum values[4];
+  bool nulls[4] = {false, false, false, false};
+
+  if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+    ereport(ERROR, (errmsg("return type must be a row type")));
+  tupdesc = BlessTupleDesc(tupdesc);
+
+  parse_cache_get_stats(&stats);
+  values[0] = Int64GetDatum((int64)stats.hits);
+  values[1] = Int64GetDatum((int64)stats.misses);
+  values[2] = Int64GetDatum((int64)stats.evictions);
+  values[3] = Int32GetDatum(stats.entries);
+
+  PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
+
+PG_FUNCTION_INFO_V1(pg_usaddress_shared_cache_stats);
+Datum pg_usaddress_shared_cache_stats(PG_FUNCTION_ARGS) {
+  TupleDesc tupdesc;
+  SharedCacheStats stats;
+  Datum values[4];
+  bool nulls[4] = {false, false, false, false};
+
+  if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+    ereport(ERROR, (errmsg("return type must be a row type")));
+  tupdesc = BlessTupleDesc(tupdesc);
+
+  shared_cache_get_stats(&stats);
+  values[0] = Int64GetDatum(stats.slots);
+  values[1] = Int64GetDatum((int64)stats.hits);
+  values[2] = Int64GetDatum((int64)stats.misses);
+  values[3] = Int64GetDatum((int64)stats.evictions);
+
+  PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
+
+PG_FUNCTION_INFO_V1(pg_usaddress_stats);
+Datum pg_usaddress_stats(PG_FUNCTION_ARGS) {
+  TupleDesc tupdesc;
+  uint64 counters[NUM_COUNTERS];
+  TimestampTz reset_time;
+  Datum values[NUM_COUNTERS + 1];
+  bool nulls[NUM_COUNTERS + 1];
+  int i;
+
+  if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+    ereport(ERROR, (errmsg("return type must be a row type")));
+  tupdesc = BlessTupleDesc(tupdesc);
+
+  stats_read(counters, &reset_time);
+  for (i = 0; i < NUM_COUNTERS; i++) {
+    values[i] = Int64GetDatum((int64)counters[i]);
+    nulls[i] = false;
   }
+  values[NUM_COUNTERS] = TimestampTzGetDatum(reset_time);
+  nulls[NUM_COUNTERS] = false;
 
-  funcctx = SRF_PERCALL_SETUP();
-  call_cntr = funcctx->call_cntr;
-  max_calls = funcctx->max_calls;
+  PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
+}
 
-  if (call_cntr < max_calls) {
-    typedef struct {
-      char **tokens;
-      char **labels;
-      int num_items;
-    } UserCtx;
-    UserCtx *uctx = (UserCtx *)funcctx->user_fctx;
+PG_FUNCTION_INFO_V1(pg_usaddress_stats_reset);
+Datum pg_usaddress_stats_reset(PG_FUNCTION_ARGS) {
+  stats_reset();
+  latency_histogram_reset();
+  PG_RETURN_VOID();
+}
 
-    Datum values[2];
-    bool nulls[2] = {false, false};
-    HeapTuple tuple;
-    Datum result;
+PG_FUNCTION_INFO_V1(pg_usaddress_latency_histogram);
+Datum pg_usaddress_latency_histogram(PG_FUNCTION_ARGS) {
+  TupleDesc tupdesc;
+  Tuplestorestate *tupstore;
+  int e, c, b;
 
-    values[0] = CStringGetTextDatum(uctx->tokens[call_cntr]);
-    values[1] = CStringGetTextDatum(uctx->labels[call_cntr]);
+  if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+    ereport(ERROR, (errmsg("return type must be a row type")));
+  tupstore = begin_materialize_srf(fcinfo, tupdesc);
+
+  /* Only non-empty buckets are returned */
+  for (e = 0; e < NUM_ENTRY_POINTS; e++) {
+    Datum name = CStringGetTextDatum(entry_point_names[e]);
+
+    for (c = 0; c < LATENCY_TOKEN_CLASSES; c++) {
+      int min_tokens, max_tokens;
+
+      latency_token_class_range(c, &min_tokens, &max_tokens);
+      for (b = 0; b < LATENCY_BUCKETS; b++) {
+        uint64 count = latency_histogram_count(e, c, b);
+        uint64 lower, upper;
+        Datum values[6];
+        bool nulls[6] = {false, false, false, false, false, false};
+
+        if (count == 0)
+          continue;
+        latency_bucket_bounds(b, &lower, &upper);
+
+        values[0] = name;
+        values[1] = Int32GetDatum(min_tokens);
+        values[2] = Int32GetDatum(max_tokens);
+        nulls[2] = max_tokens < 0;
+        values[3] = Int64GetDatum((int64)lower);
+        values[4] = Int64GetDatum((int64)upper);
+        values[5] = Int64GetDatum((int64)count);
+        tuplestore_putvalues(tupstore, tupdesc, values, nulls);
+      }
+    }
+  }
 
-    tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
-    result = HeapTupleGetDatum(tuple);
-    SRF_RETURN_NEXT(funcctx, result);
-  } else {
-    SRF_RETURN_DONE(funcctx);
+  return (Datum)0;
+}
+
+static void push_jsonb_key(JsonbParseState **state, const char *key) {
+  JsonbValue v;
+
+  v.type = jbvString;
+  v.val.string.val = (char *)key;
+  v.val.string.len = strlen(key);
+  pushJsonbValue(state, WJB_KEY, &v);
+}
+
+static void push_jsonb_string(JsonbParseState **state, JsonbIteratorToken seq,
+                              const char *str) {
+  JsonbValue v;
+
+  v.type = jbvString;
+  v.val.string.val = (char *)str;
+  v.val.string.len = strlen(str);
+  pushJsonbValue(state, seq, &v);
+}
+
+static void push_jsonb_numeric(JsonbParseState **state, Numeric num) {
+  JsonbValue v;
+
+  v.type = jbvNumeric;
+  v.val.numeric = num;
+  pushJsonbValue(state, WJB_VALUE, &v);
+}
+
+static void push_jsonb_int(JsonbParseState **state, const char *key,
+                           int64 value) {
+  push_jsonb_key(state, key);
+  push_jsonb_numeric(state, int64_to_numeric(value));
+}
+
+static void push_jsonb_float(JsonbParseState **state, const char *key,
+                             double value) {
+  push_jsonb_key(state, key);
+  push_jsonb_numeric(state, DatumGetNumeric(DirectFunctionCall1(
+                                float8_numeric, Float8GetDatum(value))));
+}
+
+/*
+ * Runs one input through the pipeline, bypassing the parse caches, and
+ * returns what each step produced: the tokens with their feature strings,
+ * how many features the model knows, the state scores per label, the Viterbi
+ * label and score, and the time spent in each phase. Inputs over the size
+ * limits are handled as in tag_address(); the Viterbi score of a split input
+ * is the sum of its segments'.
+ */
+PG_FUNCTION_INFO_V1(pg_usaddress_explain);
+Datum pg_usaddress_explain(PG_FUNCTION_ARGS) {
+  ParsedAddress parsed;
+  CrfSuiteItem *crf_items;
+  CrfSuiteTagTimings timings = {0, 0, 0};
+  CrfSuiteTagDetails details;
+  uint64 phase_ns[NUM_PHASES];
+  uint64 t0, t1, t2;
+  double viterbi_score = 0.0;
+  bool overflowed;
+  int num_items = 0;
+  int num_tagged;
+  int num_labels;
+  int start, len;
+  int64 resolved = 0;
+  int64 dropped = 0;
+  JsonbParseState *state = NULL;
+  JsonbValue *res;
+  int i, j, p;
+
+  load_model_if_needed();
+  if (!usaddress_model)
+    ereport(ERROR, (errmsg("Model not loaded")));
+  num_labels = crfsuite_model_num_labels(usaddress_model);
+
+  parsed.input = text_to_cstring(PG_GETARG_TEXT_PP(0));
+  parsed.input_len = strlen(parsed.input);
+  overflowed = check_input_bytes(parsed.input, &parsed.input_len);
+
+  t0 = usaddr_now_ns();
+  num_items = tokenize_palloc(parsed.input, parsed.input_len, &parsed.spans);
+  t1 = usaddr_now_ns();
+  num_tagged = check_num_tokens(num_items, &overflowed);
+  /*
+   * Without pruning or the token cache, so that every feature is shown as a
+   * string, including those the model drops
+   */
+  crf_items = extract_features_palloc(parsed.input, parsed.spans, num_tagged,
+                                      NULL, NULL);
+  t2 = usaddr_now_ns();
+
+  parsed.label_ids = palloc(Max(num_tagged, 1) * sizeof(int));
+  details.resolved_features = palloc0(Max(num_tagged, 1) * sizeof(int));
+  details.state_scores =
+      palloc0(Max(num_tagged, 1) * num_labels * sizeof(double));
+  for (start = 0; start < num_tagged; start += len) {
+    CrfSuiteTagDetails segment;
+
+    if (overflowed && overflow_action == OVERFLOW_SPLIT)
+      len = next_segment_length(&parsed, start, num_tagged);
+    else
+      len = num_tagged;
+    segment.resolved_features = details.resolved_features + start;
+    segment.state_scores = details.state_scores + start * num_labels;
+    if (crfsuite_model_explain(usaddress_model, crf_items + start, len,
+                               parsed.label_ids + start, &timings,
+                               &segment) != 0)
+      ereport(ERROR, (errmsg("Tagging failed")));
+    viterbi_score += segment.viterbi_score;
   }
+
+  memset(phase_ns, 0, sizeof(phase_ns));
+  phase_ns[PHASE_TOKENIZE] = t1 - t0;
+  phase_ns[PHASE_FEATURES] = t2 - t1;
+  phase_ns[PHASE_ATTR_LOOKUP] = timings.attr_lookup_ns;
+  phase_ns[PHASE_STATE_SCORE] = timings.state_score_ns;
+  phase_ns[PHASE_VITERBI] = timings.viterbi_ns;
+
+  pushJsonbValue(&state, WJB_BEGIN_OBJECT, NULL);
+
+  push_jsonb_key(&state, "tokens");
+  pushJsonbValue(&state, WJB_BEGIN_ARRAY, NULL);
+  for (i = 0; i < num_tagged; i++) {
+    CrfSuiteItem *item = &crf_items[i];
+    const double *scores = details.state_scores + i * num_labels;
+    int known = details.resolved_features[i];
+
+    pushJsonbValue(&state, WJB_BEGIN_OBJECT, NULL);
+    push_jsonb_key(&state, "token");
+    push_jsonb_string(&state, WJB_VALUE,
+                      pnstrdup(TOKEN_TEXT(&parsed, i), parsed.spans[i].length));
+    push_jsonb_key(&state, "label");
+    push_jsonb_string(
+        &state, WJB_VALUE,
+        crfsuite_model_label(usaddress_model, parsed.label_ids[i]));
+
+    push_jsonb_key(&state, "features");
+    pushJsonbValue(&state, WJB_BEGIN_ARRAY, NULL);
+    for (j = 0; j < item->num_features; j++)
+      push_jsonb_string(&state, WJB_ELEM, item->features[j]);
+    pushJsonbValue(&state, WJB_END_ARRAY, NULL);
+    push_jsonb_int(&state, "resolved_features", known);
+    push_jsonb_int(&state, "dropped_features", item->num_features - known);
+
+    push_jsonb_key(&state, "state_scores");
+    pushJsonbValue(&state, WJB_BEGIN_OBJECT, NULL);
+    for (j = 0; j < num_labels; j++)
+      push_jsonb_float(&state, crfsuite_model_label(usaddress_model, j),
+                       scores[j]);
+    pushJsonbValue(&state, WJB_END_OBJECT, NULL);
+    pushJsonbValue(&state, WJB_END_OBJECT, NULL);
+
+    resolved += known;
+    dropped += item->num_features - known;
+  }
+  pushJsonbValue(&state, WJB_END_ARRAY, NULL);
+
+  push_jsonb_int(&state, "resolved_features", resolved);
+  push_jsonb_int(&state, "dropped_features", dropped);
+  push_jsonb_float(&state, "viterbi_score", viterbi_score);
+
+  /* The fast path, normalization and output are not part of tagging */
+  push_jsonb_key(&state, "timing_ns");
+  pushJsonbValue(&state, WJB_BEGIN_OBJECT, NULL);
+  for (p = 0; p < PHASE_NORMALIZE; p++) {
+    if (p != PHASE_FAST_PATH)
+      push_jsonb_int(&state, phase_names[p], (int64)phase_ns[p]);
+  }
+  pushJsonbValue(&state, WJB_END_OBJECT, NULL);
+
+  res = pushJsonbValue(&state, WJB_END_OBJECT, NULL);
+
+  PG_RETURN_POINTER(JsonbValueToJsonb(res));
 }
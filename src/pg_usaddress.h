@@ -0,0 +1,26 @@
+#ifndef PG_USADDRESS_H
+#define PG_USADDRESS_H
+
+#include "feature_extractor.h"
+
+/*
+ * A tagged address: the input string together with the byte span and the
+ * model label id of each of its tokens. Token text is read through the spans,
+ * so it is only copied when an output Datum is built.
+ */
+typedef struct ParsedAddress {
+  char *input; /* NUL-terminated copy of the argument */
+  int input_len;
+  int num_tokens;
+  TokenSpan *spans;
+  int *label_ids;
+} ParsedAddress;
+
+/* Start of token i's text; it is spans[i].length bytes long */
+#define TOKEN_TEXT(parsed, i) ((parsed)->input + (parsed)->spans[i].offset)
+
+static inline bool token_is_comma(const ParsedAddress *parsed, int i) {
+  return parsed->spans[i].length == 1 && *TOKEN_TEXT(parsed, i) == ',';
+}
+
+#endif
@@ -0,0 +1,279 @@
+#include "postgres.h"
+
+#include "common/hashfn.h"
+#include "port/atomics.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+
+#include "shared_cache.h"
+
+int shared_cache_size_mb = 0;
+
+/*
+ * The cache is a set-associative table: an input hash picks a bucket, and the
+ * result may live in any of the bucket's slots. Each bucket runs its own
+ * clock sweep over its slots to choose a victim. Buckets are guarded by a
+ * fixed array of lock stripes.
+ */
+#define SHARED_CACHE_WAYS 8
+#define SHARED_CACHE_LOCKS 64
+#define SHARED_CACHE_MAX_USAGE 3
+#define SHARED_CACHE_TRANCHE "pg_usaddress"
+
+/*
+ * A compact parse result. data holds the token spans as uint16 offset/length
+ * pairs, then a uint8 label id per token, then the input bytes. Results that
+ * do not fit are not cached. num_tokens == 0 marks an empty slot.
+ */
+#define SHARED_CACHE_SLOT_DATA 232
+
+typedef struct SharedCacheSlot {
+  uint64 key;
+  uint64 generation;
+  pg_atomic_uint32 usage;
+  uint16 input_len;
+  uint16 num_tokens;
+  char data[SHARED_CACHE_SLOT_DATA];
+} SharedCacheSlot;
+
+typedef struct SharedCacheBucket {
+  uint32 hand; /* next slot the clock sweep looks at */
+  SharedCacheSlot slots[SHARED_CACHE_WAYS];
+} SharedCacheBucket;
+
+typedef struct SharedCacheState {
+  LWLockPadded *locks;
+  pg_atomic_uint64 generation; /* model generation of the newest load */
+  pg_atomic_uint64 hits;
+  pg_atomic_uint64 misses;
+  pg_atomic_uint64 evictions;
+  int64 num_buckets;
+  SharedCacheBucket buckets[FLEXIBLE_ARRAY_MEMBER];
+} SharedCacheState;
+
+static SharedCacheState *shared_cache = NULL;
+
+static int64 shared_cache_num_buckets(void) {
+  return ((int64)shared_cache_size_mb * 1024 * 1024) /
+         sizeof(SharedCacheBucket);
+}
+
+static Size shared_cache_shmem_size(void) {
+  return add_size(offsetof(SharedCacheState, buckets),
+                  mul_size(shared_cache_num_buckets(),
+                           sizeof(SharedCacheBucket)));
+}
+
+void shared_cache_shmem_request(void) {
+  if (shared_cache_num_buckets() == 0)
+    return;
+
+  RequestAddinShmemSpace(shared_cache_shmem_size());
+  RequestNamedLWLockTranche(SHARED_CACHE_TRANCHE, SHARED_CACHE_LOCKS);
+}
+
+void shared_cache_shmem_startup(void) {
+  bool found;
+
+  if (shared_cache_num_buckets() == 0)
+    return;
+
+  LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
+  shared_cache = ShmemInitStruct("pg_usaddress shared cache",
+                                 shared_cache_shmem_size(), &found);
+  if (!found) {
+    int64 b;
+    int w;
+
+    shared_cache->locks = GetNamedLWLockTranche(SHARED_CACHE_TRANCHE);
+    pg_atomic_init_u64(&shared_cache->generation, 0);
+    pg_atomic_init_u64(&shared_cache->hits, 0);
+    pg_atomic_init_u64(&shared_cache->misses, 0);
+    pg_atomic_init_u64(&shared_cache->evictions, 0);
+    shared_cache->num_buckets = shared_cache_num_buckets();
+    for (b = 0; b < shared_cache->num_buckets; b++) {
+      SharedCacheBucket *bucket = &shared_cache->buckets[b];
+
+      bucket->hand = 0;
+      for (w = 0; w < SHARED_CACHE_WAYS; w++) {
+        bucket->slots[w].num_tokens = 0;
+        pg_atomic_init_u32(&bucket->slots[w].usage, 0);
+      }
+    }
+  }
+  LWLockRelease(AddinShmemInitLock);
+}
+
+void shared_cache_set_generation(uint64 generation) {
+  if (shared_cache == NULL)
+    return;
+  if (pg_atomic_read_u64(&shared_cache->generation) != generation)
+    pg_atomic_write_u64(&shared_cache->generation, generation);
+}
+
+static uint64 shared_cache_key(uint64 generation, const ParsedAddress *parsed) {
+  return hash_bytes_extended((const unsigned char *)parsed->input,
+                             parsed->input_len, generation);
+}
+
+static Size slot_data_size(int input_len, int num_tokens) {
+  return num_tokens * (2 * sizeof(uint16) + sizeof(uint8)) + input_len;
+}
+
+static SharedCacheBucket *bucket_for_key(uint64 key, LWLock **lock) {
+  int64 b = key % shared_cache->num_buckets;
+
+  *lock = &shared_cache->locks[b % SHARED_CACHE_LOCKS].lock;
+  return &shared_cache->buckets[b];
+}
+
+static bool slot_matches(const SharedCacheSlot *slot, uint64 key,
+                         uint64 generation, const ParsedAddress *parsed) {
+  const char *input;
+
+  if (slot->num_tokens == 0 || slot->key != key ||
+      slot->generation != generation || slot->input_len != parsed->input_len)
+    return false;
+  input = slot->data + slot->num_tokens * (2 * sizeof(uint16) + sizeof(uint8));
+  return memcmp(input, parsed->input, parsed->input_len) == 0;
+}
+
+bool shared_cache_lookup(uint64 generation, ParsedAddress *parsed) {
+  SharedCacheBucket *bucket;
+  LWLock *lock;
+  uint64 key;
+  int w;
+
+  if (shared_cache == NULL)
+    return false;
+
+  key = shared_cache_key(generation, parsed);
+  bucket = bucket_for_key(key, &lock);
+
+  LWLockAcquire(lock, LW_SHARED);
+  for (w = 0; w < SHARED_CACHE_WAYS; w++) {
+    SharedCacheSlot *slot = &bucket->slots[w];
+    const uint16 *spans;
+    const uint8 *labels;
+    uint32 usage;
+    int n, i;
+
+    if (!slot_matches(slot, key, generation, parsed))
+      continue;
+
+    n = slot->num_tokens;
+    parsed->num_tokens = n;
+    parsed->spans = palloc(n * sizeof(TokenSpan));
+    parsed->label_ids = palloc(n * sizeof(int));
+    spans = (const uint16 *)slot->data;
+    labels = (const uint8 *)(slot->data + n * 2 * sizeof(uint16));
+    for (i = 0; i < n; i++) {
+      parsed->spans[i].offset = spans[2 * i];
+      parsed->spans[i].length = spans[2 * i + 1];
+      parsed->label_ids[i] = labels[i];
+    }
+
+    /* Racing bumps may lose an increment, which the sweep tolerates */
+    usage = pg_atomic_read_u32(&slot->usage);
+    if (usage < SHARED_CACHE_MAX_USAGE)
+      pg_atomic_write_u32(&slot->usage, usage + 1);
+    LWLockRelease(lock);
+
+    pg_atomic_fetch_add_u64(&shared_cache->hits, 1);
+    return true;
+  }
+  LWLockRelease(lock);
+
+  pg_atomic_fetch_add_u64(&shared_cache->misses, 1);
+  return false;
+}
+
+/*
+ * Picks the slot to overwrite: an empty slot or one left by another model
+ * generation if there is one, otherwise the first slot the clock sweep finds
+ * with no remaining usage. Caller holds the bucket's lock exclusively.
+ */
+static SharedCacheSlot *choose_victim(SharedCacheBucket *bucket,
+                                      uint64 current_generation) {
+  int w;
+
+  for (w = 0; w < SHARED_CACHE_WAYS; w++) {
+    SharedCacheSlot *slot = &bucket->slots[w];
+
+    if (slot->num_tokens == 0 || slot->generation != current_generation)
+      return slot;
+  }
+
+  for (;;) {
+    SharedCacheSlot *slot = &bucket->slots[bucket->hand];
+    uint32 usage = pg_atomic_read_u32(&slot->usage);
+
+    bucket->hand = (bucket->hand + 1) % SHARED_CACHE_WAYS;
+    if (usage == 0) {
+      pg_atomic_fetch_add_u64(&shared_cache->evictions, 1);
+      return slot;
+    }
+    pg_atomic_write_u32(&slot->usage, usage - 1);
+  }
+}
+
+void shared_cache_store(uint64 generation, const ParsedAddress *parsed) {
+  SharedCacheBucket *bucket;
+  SharedCacheSlot *slot;
+  LWLock *lock;
+  uint64 key;
+  uint16 *spans;
+  uint8 *labels;
+  int n = parsed->num_tokens;
+  int w, i;
+
+  if (shared_cache == NULL || n == 0 ||
+      slot_data_size(parsed->input_len, n) > SHARED_CACHE_SLOT_DATA)
+    return;
+  for (i = 0; i < n; i++) {
+    if (parsed->label_ids[i] > PG_UINT8_MAX)
+      return;
+  }
+
+  key = shared_cache_key(generation, parsed);
+  bucket = bucket_for_key(key, &lock);
+
+  LWLockAcquire(lock, LW_EXCLUSIVE);
+
+  /* Another backend may have stored the same input meanwhile */
+  for (w = 0; w < SHARED_CACHE_WAYS; w++) {
+    if (slot_matches(&bucket->slots[w], key, generation, parsed)) {
+      LWLockRelease(lock);
+      return;
+    }
+  }
+
+  slot = choose_victim(bucket, pg_atomic_read_u64(&shared_cache->generation));
+  slot->key = key;
+  slot->generation = generation;
+  slot->input_len = parsed->input_len;
+  slot->num_tokens = n;
+  pg_atomic_write_u32(&slot->usage, 1);
+
+  spans = (uint16 *)slot->data;
+  labels = (uint8 *)(slot->data + n * 2 * sizeof(uint16));
+  for (i = 0; i < n; i++) {
+    spans[2 * i] = parsed->spans[i].offset;
+    spans[2 * i + 1] = parsed->spans[i].length;
+    labels[i] = parsed->label_ids[i];
+  }
+  memcpy(labels + n, parsed->input, parsed->input_len);
+
+  LWLockRelease(lock);
+}
+
+void shared_cache_get_stats(SharedCacheStats *stats) {
+  if (shared_cache == NULL) {
+    memset(stats, 0, sizeof(*stats));
+    return;
+  }
+  stats->slots = shared_cache->num_buckets * SHARED_CACHE_WAYS;
+  stats->hits = pg_atomic_read_u64(&shared_cache->hits);
+  stats->misses = pg_atomic_read_u64(&shared_cache->misses);
+  stats->evictions = pg_atomic_read_u64(&shared_cache->evictions);
+}
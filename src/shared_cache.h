@@ -0,0 +1,36 @@
+#ifndef SHARED_CACHE_H
+#define SHARED_CACHE_H
+
+#include "pg_usaddress.h"
+
+/*
+ * GUC pg_usaddress.shared_cache_size: size in MB of the cross-backend parse
+ * cache. It lives in the main shared memory segment, so it is only available
+ * when the library is in shared_preload_libraries.
+ */
+extern int shared_cache_size_mb;
+
+typedef struct SharedCacheStats {
+  int64 slots;
+  uint64 hits;
+  uint64 misses;
+  uint64 evictions;
+} SharedCacheStats;
+
+/* Called from the extension's shmem request and startup hooks */
+extern void shared_cache_shmem_request(void);
+extern void shared_cache_shmem_startup(void);
+
+/*
+ * Records the generation of the model this backend loaded. Entries of any
+ * other generation are treated as free slots from then on.
+ */
+extern void shared_cache_set_generation(uint64 generation);
+
+/* Same contract as parse_cache_lookup() and parse_cache_store() */
+extern bool shared_cache_lookup(uint64 generation, ParsedAddress *parsed);
+extern void shared_cache_store(uint64 generation, const ParsedAddress *parsed);
+
+extern void shared_cache_get_stats(SharedCacheStats *stats);
+
+#endif
@@ -0,0 +1,115 @@
+#include "postgres.h"
+
+#include "miscadmin.h"
+#include "port/atomics.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/timestamp.h"
+
+#include "stats.h"
+
+/*
+ * Backends add to one of several stripes of counters, picked by pid, so that
+ * concurrent backends rarely contend on the same atomics. Readers sum the
+ * stripes.
+ */
+#define STATS_STRIPES 32
+
+typedef struct StatsStripe {
+  pg_atomic_uint64 counters[NUM_COUNTERS];
+} StatsStripe;
+
+typedef struct StatsShared {
+  pg_atomic_uint64 reset_time; /* TimestampTz of the last reset */
+  StatsStripe stripes[STATS_STRIPES];
+} StatsShared;
+
+/* Backend-local counters, used when the library is not preloaded */
+static StatsShared local_stats;
+
+static StatsShared *stats = NULL;
+static StatsStripe *my_stripe = NULL;
+
+static void stats_init(StatsShared *s) {
+  int i, c;
+
+  pg_atomic_init_u64(&s->reset_time, (uint64)GetCurrentTimestamp());
+  for (i = 0; i < STATS_STRIPES; i++) {
+    for (c = 0; c < NUM_COUNTERS; c++)
+      pg_atomic_init_u64(&s->stripes[i].counters[c], 0);
+  }
+}
+
+void stats_shmem_request(void) {
+  RequestAddinShmemSpace(sizeof(StatsShared));
+}
+
+void stats_shmem_startup(void) {
+  bool found;
+
+  LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
+  stats = ShmemInitStruct("pg_usaddress stats", sizeof(StatsShared), &found);
+  if (!found)
+    stats_init(stats);
+  LWLockRelease(AddinShmemInitLock);
+}
+
+static StatsShared *get_stats(void) {
+  if (stats == NULL) {
+    stats_init(&local_stats);
+    stats = &local_stats;
+  }
+  return stats;
+}
+
+static StatsStripe *get_stripe(void) {
+  if (my_stripe == NULL)
+    my_stripe = &get_stats()->stripes[MyProcPid % STATS_STRIPES];
+  return my_stripe;
+}
+
+void stats_add(UsaddressCounter counter, uint64 value) {
+  pg_atomic_fetch_add_u64(&get_stripe()->counters[counter], value);
+}
+
+void stats_count_call(UsaddressEntryPoint entry, int tokens_tagged,
+                      const uint64 *phase_ns) {
+  StatsStripe *stripe = get_stripe();
+  int p;
+
+  pg_atomic_fetch_add_u64(&stripe->counters[STAT_CALLS + entry], 1);
+  if (tokens_tagged > 0)
+    pg_atomic_fetch_add_u64(&stripe->counters[STAT_TOKENS], tokens_tagged);
+  for (p = 0; p < NUM_PHASES; p++) {
+    if (phase_ns[p] > 0)
+      pg_atomic_fetch_add_u64(&stripe->counters[STAT_PHASE_NS + p],
+                              phase_ns[p]);
+  }
+}
+
+void stats_read(uint64 *values, TimestampTz *reset_time) {
+  StatsShared *s = get_stats();
+  int i, c;
+
+  memset(values, 0, NUM_COUNTERS * sizeof(uint64));
+  for (i = 0; i < STATS_STRIPES; i++) {
+    for (c = 0; c < NUM_COUNTERS; c++)
+      values[c] += pg_atomic_read_u64(&s->stripes[i].counters[c]);
+  }
+  *reset_time = (TimestampTz)pg_atomic_read_u64(&s->reset_time);
+}
+
+/*
+ * Zeroes the counters. Additions racing with the reset may survive it, which
+ * is fine for statistics.
+ */
+void stats_reset(void) {
+  StatsShared *s = get_stats();
+  int i, c;
+
+  for (i = 0; i < STATS_STRIPES; i++) {
+    for (c = 0; c < NUM_COUNTERS; c++)
+      pg_atomic_write_u64(&s->stripes[i].counters[c], 0);
+  }
+  pg_atomic_write_u64(&s->reset_time, (uint64)GetCurrentTimestamp());
+}
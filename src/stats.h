@@ -0,0 +1,71 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include "utils/timestamp.h"
+
+/* SQL entry points, in the column order of the pg_usaddress_stats view */
+typedef enum UsaddressEntryPoint {
+  ENTRY_PARSE_ADDRESS_CRF,
+  ENTRY_PARSE_ADDRESS_CRF_NORMALIZED,
+  ENTRY_PARSE_ADDRESS_CRF_COLS,
+  ENTRY_TAG_ADDRESS_CRF,
+  ENTRY_CRF_FULL_ADDRESS_NORMALIZED,
+  ENTRY_PARSE_ADDRESS_CRF_BATCH,
+  NUM_ENTRY_POINTS
+} UsaddressEntryPoint;
+
+/* Phases of a parse that are timed separately */
+typedef enum UsaddressPhase {
+  PHASE_TOKENIZE,
+  PHASE_FAST_PATH,
+  PHASE_FEATURES,
+  PHASE_ATTR_LOOKUP,
+  PHASE_STATE_SCORE,
+  PHASE_VITERBI,
+  PHASE_NORMALIZE,
+  PHASE_OUTPUT,
+  NUM_PHASES
+} UsaddressPhase;
+
+/* Counters reported by pg_usaddress_stats, in view column order */
+typedef enum UsaddressCounter {
+  /* calls, one counter per entry point */
+  STAT_CALLS,
+  /* tokens run through the tagger */
+  STAT_TOKENS = STAT_CALLS + NUM_ENTRY_POINTS,
+  /* nanoseconds, one counter per phase */
+  STAT_PHASE_NS,
+  STAT_CACHE_HITS = STAT_PHASE_NS + NUM_PHASES,
+  STAT_SHARED_CACHE_HITS,
+  STAT_MODEL_LOADS,
+  /* token words found in, and added to, the per-backend token cache */
+  STAT_TOKEN_CACHE_HITS,
+  STAT_TOKEN_CACHE_MISSES,
+  /* tokens whose state scores were found in, and added to, the state cache */
+  STAT_STATE_CACHE_HITS,
+  STAT_STATE_CACHE_MISSES,
+  /* canonical addresses matched by the fast path; those the model disagreed
+     with in verify mode */
+  STAT_FAST_PATH_MATCHES,
+  STAT_FAST_PATH_MISMATCHES,
+  NUM_COUNTERS
+} UsaddressCounter;
+
+/*
+ * The counters live in shared memory when the library is preloaded, and are
+ * then cluster-wide. Otherwise each backend counts only its own work.
+ */
+extern void stats_shmem_request(void);
+extern void stats_shmem_startup(void);
+
+extern void stats_add(UsaddressCounter counter, uint64 value);
+
+/* Records one finished SQL call and its per-phase timings */
+extern void stats_count_call(UsaddressEntryPoint entry, int tokens_tagged,
+                             const uint64 *phase_ns);
+
+/* Sums the counters into values (NUM_COUNTERS long) */
+extern void stats_read(uint64 *values, TimestampTz *reset_time);
+extern void stats_reset(void);
+
+#endif
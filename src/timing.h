@@ -0,0 +1,21 @@
+/*
+ * timing.h - monotonic nanosecond clock for the per-phase counters
+ *
+ * Shared by the PostgreSQL glue and the plain C tagging code, which cannot
+ * use instr_time (and whose nanosecond accessor only exists in PG 16+).
+ */
+
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <stdint.h>
+#include <time.h>
+
+static inline uint64_t usaddr_now_ns(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+#endif /* TIMING_H */
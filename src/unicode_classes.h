@@ -0,0 +1,1714 @@
+/*
+ * Character classes of the tokenizer, as the Python re module sees them
+ * (Unicode 15.0.0).
+ *
+ * Generated by tools/gen_unicode_classes.py; do not edit.
+ */
+#ifndef UNICODE_CLASSES_H
+#define UNICODE_CLASSES_H
+
+#include <stdint.h>
+
+typedef enum { CHAR_SPACE, CHAR_WORD, CHAR_PUNCT } CharClass;
+
+static const uint8_t ascii_char_class[128] = {
+    CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_SPACE, CHAR_SPACE, CHAR_SPACE,
+    CHAR_SPACE, CHAR_SPACE, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_SPACE, CHAR_SPACE, CHAR_SPACE, CHAR_SPACE,
+    CHAR_SPACE, CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT, CHAR_WORD,
+    CHAR_PUNCT, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_WORD,
+    CHAR_WORD, CHAR_WORD, CHAR_WORD, CHAR_PUNCT,
+    CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT, CHAR_PUNCT,
+};
+
+/* Code points from first up to the next entry have class cls */
+static const struct {
+  uint32_t first;
+  uint8_t cls;
+} unicode_char_ranges[1503] = {
+    {0x0080, CHAR_PUNCT}, {0x0085, CHAR_SPACE}, {0x0086, CHAR_PUNCT},
+    {0x00A0, CHAR_SPACE}, {0x00A1, CHAR_PUNCT}, {0x00AA, CHAR_WORD},
+    {0x00AB, CHAR_PUNCT}, {0x00B2, CHAR_WORD}, {0x00B4, CHAR_PUNCT},
+    {0x00B5, CHAR_WORD}, {0x00B6, CHAR_PUNCT}, {0x00B9, CHAR_WORD},
+    {0x00BB, CHAR_PUNCT}, {0x00BC, CHAR_WORD}, {0x00BF, CHAR_PUNCT},
+    {0x00C0, CHAR_WORD}, {0x00D7, CHAR_PUNCT}, {0x00D8, CHAR_WORD},
+    {0x00F7, CHAR_PUNCT}, {0x00F8, CHAR_WORD}, {0x02C2, CHAR_PUNCT},
+    {0x02C6, CHAR_WORD}, {0x02D2, CHAR_PUNCT}, {0x02E0, CHAR_WORD},
+    {0x02E5, CHAR_PUNCT}, {0x02EC, CHAR_WORD}, {0x02ED, CHAR_PUNCT},
+    {0x02EE, CHAR_WORD}, {0x02EF, CHAR_PUNCT}, {0x0370, CHAR_WORD},
+    {0x0375, CHAR_PUNCT}, {0x0376, CHAR_WORD}, {0x0378, CHAR_PUNCT},
+    {0x037A, CHAR_WORD}, {0x037E, CHAR_PUNCT}, {0x037F, CHAR_WORD},
+    {0x0380, CHAR_PUNCT}, {0x0386, CHAR_WORD}, {0x0387, CHAR_PUNCT},
+    {0x0388, CHAR_WORD}, {0x038B, CHAR_PUNCT}, {0x038C, CHAR_WORD},
+    {0x038D, CHAR_PUNCT}, {0x038E, CHAR_WORD}, {0x03A2, CHAR_PUNCT},
+    {0x03A3, CHAR_WORD}, {0x03F6, CHAR_PUNCT}, {0x03F7, CHAR_WORD},
+    {0x0482, CHAR_PUNCT}, {0x048A, CHAR_WORD}, {0x0530, CHAR_PUNCT},
+    {0x0531, CHAR_WORD}, {0x0557, CHAR_PUNCT}, {0x0559, CHAR_WORD},
+    {0x055A, CHAR_PUNCT}, {0x0560, CHAR_WORD}, {0x0589, CHAR_PUNCT},
+    {0x05D0, CHAR_WORD}, {0x05EB, CHAR_PUNCT}, {0x05EF, CHAR_WORD},
+    {0x05F3, CHAR_PUNCT}, {0x0620, CHAR_WORD}, {0x064B, CHAR_PUNCT},
+    {0x0660, CHAR_WORD}, {0x066A, CHAR_PUNCT}, {0x066E, CHAR_WORD},
+    {0x0670, CHAR_PUNCT}, {0x0671, CHAR_WORD}, {0x06D4, CHAR_PUNCT},
+    {0x06D5, CHAR_WORD}, {0x06D6, CHAR_PUNCT}, {0x06E5, CHAR_WORD},
+    {0x06E7, CHAR_PUNCT}, {0x06EE, CHAR_WORD}, {0x06FD, CHAR_PUNCT},
+    {0x06FF, CHAR_WORD}, {0x0700, CHAR_PUNCT}, {0x0710, CHAR_WORD},
+    {0x0711, CHAR_PUNCT}, {0x0712, CHAR_WORD}, {0x0730, CHAR_PUNCT},
+    {0x074D, CHAR_WORD}, {0x07A6, CHAR_PUNCT}, {0x07B1, CHAR_WORD},
+    {0x07B2, CHAR_PUNCT}, {0x07C0, CHAR_WORD}, {0x07EB, CHAR_PUNCT},
+    {0x07F4, CHAR_WORD}, {0x07F6, CHAR_PUNCT}, {0x07FA, CHAR_WORD},
+    {0x07FB, CHAR_PUNCT}, {0x0800, CHAR_WORD}, {0x0816, CHAR_PUNCT},
+    {0x081A, CHAR_WORD}, {0x081B, CHAR_PUNCT}, {0x0824, CHAR_WORD},
+    {0x0825, CHAR_PUNCT}, {0x0828, CHAR_WORD}, {0x0829, CHAR_PUNCT},
+    {0x0840, CHAR_WORD}, {0x0859, CHAR_PUNCT}, {0x0860, CHAR_WORD},
+    {0x086B, CHAR_PUNCT}, {0x0870, CHAR_WORD}, {0x0888, CHAR_PUNCT},
+    {0x0889, CHAR_WORD}, {0x088F, CHAR_PUNCT}, {0x08A0, CHAR_WORD},
+    {0x08CA, CHAR_PUNCT}, {0x0904, CHAR_WORD}, {0x093A, CHAR_PUNCT},
+    {0x093D, CHAR_WORD}, {0x093E, CHAR_PUNCT}, {0x0950, CHAR_WORD},
+    {0x0951, CHAR_PUNCT}, {0x0958, CHAR_WORD}, {0x0962, CHAR_PUNCT},
+    {0x0966, CHAR_WORD}, {0x0970, CHAR_PUNCT}, {0x0971, CHAR_WORD},
+    {0x0981, CHAR_PUNCT}, {0x0985, CHAR_WORD}, {0x098D, CHAR_PUNCT},
+    {0x098F, CHAR_WORD}, {0x0991, CHAR_PUNCT}, {0x0993, CHAR_WORD},
+    {0x09A9, CHAR_PUNCT}, {0x09AA, CHAR_WORD}, {0x09B1, CHAR_PUNCT},
+    {0x09B2, CHAR_WORD}, {0x09B3, CHAR_PUNCT}, {0x09B6, CHAR_WORD},
+    {0x09BA, CHAR_PUNCT}, {0x09BD, CHAR_WORD}, {0x09BE, CHAR_PUNCT},
+    {0x09CE, CHAR_WORD}, {0x09CF, CHAR_PUNCT}, {0x09DC, CHAR_WORD},
+    {0x09DE, CHAR_PUNCT}, {0x09DF, CHAR_WORD}, {0x09E2, CHAR_PUNCT},
+    {0x09E6, CHAR_WORD}, {0x09F2, CHAR_PUNCT}, {0x09F4, CHAR_WORD},
+    {0x09FA, CHAR_PUNCT}, {0x09FC, CHAR_WORD}, {0x09FD, CHAR_PUNCT},
+    {0x0A05, CHAR_WORD}, {0x0A0B, CHAR_PUNCT}, {0x0A0F, CHAR_WORD},
+    {0x0A11, CHAR_PUNCT}, {0x0A13, CHAR_WORD}, {0x0A29, CHAR_PUNCT},
+    {0x0A2A, CHAR_WORD}, {0x0A31, CHAR_PUNCT}, {0x0A32, CHAR_WORD},
+    {0x0A34, CHAR_PUNCT}, {0x0A35, CHAR_WORD}, {0x0A37, CHAR_PUNCT},
+    {0x0A38, CHAR_WORD}, {0x0A3A, CHAR_PUNCT}, {0x0A59, CHAR_WORD},
+    {0x0A5D, CHAR_PUNCT}, {0x0A5E, CHAR_WORD}, {0x0A5F, CHAR_PUNCT},
+    {0x0A66, CHAR_WORD}, {0x0A70, CHAR_PUNCT}, {0x0A72, CHAR_WORD},
+    {0x0A75, CHAR_PUNCT}, {0x0A85, CHAR_WORD}, {0x0A8E, CHAR_PUNCT},
+    {0x0A8F, CHAR_WORD}, {0x0A92, CHAR_PUNCT}, {0x0A93, CHAR_WORD},
+    {0x0AA9, CHAR_PUNCT}, {0x0AAA, CHAR_WORD}, {0x0AB1, CHAR_PUNCT},
+    {0x0AB2, CHAR_WORD}, {0x0AB4, CHAR_PUNCT}, {0x0AB5, CHAR_WORD},
+    {0x0ABA, CHAR_PUNCT}, {0x0ABD, CHAR_WORD}, {0x0ABE, CHAR_PUNCT},
+    {0x0AD0, CHAR_WORD}, {0x0AD1, CHAR_PUNCT}, {0x0AE0, CHAR_WORD},
+    {0x0AE2, CHAR_PUNCT}, {0x0AE6, CHAR_WORD}, {0x0AF0, CHAR_PUNCT},
+    {0x0AF9, CHAR_WORD}, {0x0AFA, CHAR_PUNCT}, {0x0B05, CHAR_WORD},
+    {0x0B0D, CHAR_PUNCT}, {0x0B0F, CHAR_WORD}, {0x0B11, CHAR_PUNCT},
+    {0x0B13, CHAR_WORD}, {0x0B29, CHAR_PUNCT}, {0x0B2A, CHAR_WORD},
+    {0x0B31, CHAR_PUNCT}, {0x0B32, CHAR_WORD}, {0x0B34, CHAR_PUNCT},
+    {0x0B35, CHAR_WORD}, {0x0B3A, CHAR_PUNCT}, {0x0B3D, CHAR_WORD},
+    {0x0B3E, CHAR_PUNCT}, {0x0B5C, CHAR_WORD}, {0x0B5E, CHAR_PUNCT},
+    {0x0B5F, CHAR_WORD}, {0x0B62, CHAR_PUNCT}, {0x0B66, CHAR_WORD},
+    {0x0B70, CHAR_PUNCT}, {0x0B71, CHAR_WORD}, {0x0B78, CHAR_PUNCT},
+    {0x0B83, CHAR_WORD}, {0x0B84, CHAR_PUNCT}, {0x0B85, CHAR_WORD},
+    {0x0B8B, CHAR_PUNCT}, {0x0B8E, CHAR_WORD}, {0x0B91, CHAR_PUNCT},
+    {0x0B92, CHAR_WORD}, {0x0B96, CHAR_PUNCT}, {0x0B99, CHAR_WORD},
+    {0x0B9B, CHAR_PUNCT}, {0x0B9C, CHAR_WORD}, {0x0B9D, CHAR_PUNCT},
+    {0x0B9E, CHAR_WORD}, {0x0BA0, CHAR_PUNCT}, {0x0BA3, CHAR_WORD},
+    {0x0BA5, CHAR_PUNCT}, {0x0BA8, CHAR_WORD}, {0x0BAB, CHAR_PUNCT},
+    {0x0BAE, CHAR_WORD}, {0x0BBA, CHAR_PUNCT}, {0x0BD0, CHAR_WORD},
+    {0x0BD1, CHAR_PUNCT}, {0x0BE6, CHAR_WORD}, {0x0BF3, CHAR_PUNCT},
+    {0x0C05, CHAR_WORD}, {0x0C0D, CHAR_PUNCT}, {0x0C0E, CHAR_WORD},
+    {0x0C11, CHAR_PUNCT}, {0x0C12, CHAR_WORD}, {0x0C29, CHAR_PUNCT},
+    {0x0C2A, CHAR_WORD}, {0x0C3A, CHAR_PUNCT}, {0x0C3D, CHAR_WORD},
+    {0x0C3E, CHAR_PUNCT}, {0x0C58, CHAR_WORD}, {0x0C5B, CHAR_PUNCT},
+    {0x0C5D, CHAR_WORD}, {0x0C5E, CHAR_PUNCT}, {0x0C60, CHAR_WORD},
+    {0x0C62, CHAR_PUNCT}, {0x0C66, CHAR_WORD}, {0x0C70, CHAR_PUNCT},
+    {0x0C78, CHAR_WORD}, {0x0C7F, CHAR_PUNCT}, {0x0C80, CHAR_WORD},
+    {0x0C81, CHAR_PUNCT}, {0x0C85, CHAR_WORD}, {0x0C8D, CHAR_PUNCT},
+    {0x0C8E, CHAR_WORD}, {0x0C91, CHAR_PUNCT}, {0x0C92, CHAR_WORD},
+    {0x0CA9, CHAR_PUNCT}, {0x0CAA, CHAR_WORD}, {0x0CB4, CHAR_PUNCT},
+    {0x0CB5, CHAR_WORD}, {0x0CBA, CHAR_PUNCT}, {0x0CBD, CHAR_WORD},
+    {0x0CBE, CHAR_PUNCT}, {0x0CDD, CHAR_WORD}, {0x0CDF, CHAR_PUNCT},
+    {0x0CE0, CHAR_WORD}, {0x0CE2, CHAR_PUNCT}, {0x0CE6, CHAR_WORD},
+    {0x0CF0, CHAR_PUNCT}, {0x0CF1, CHAR_WORD}, {0x0CF3, CHAR_PUNCT},
+    {0x0D04, CHAR_WORD}, {0x0D0D, CHAR_PUNCT}, {0x0D0E, CHAR_WORD},
+    {0x0D11, CHAR_PUNCT}, {0x0D12, CHAR_WORD}, {0x0D3B, CHAR_PUNCT},
+    {0x0D3D, CHAR_WORD}, {0x0D3E, CHAR_PUNCT}, {0x0D4E, CHAR_WORD},
+    {0x0D4F, CHAR_PUNCT}, {0x0D54, CHAR_WORD}, {0x0D57, CHAR_PUNCT},
+    {0x0D58, CHAR_WORD}, {0x0D62, CHAR_PUNCT}, {0x0D66, CHAR_WORD},
+    {0x0D79, CHAR_PUNCT}, {0x0D7A, CHAR_WORD}, {0x0D80, CHAR_PUNCT},
+    {0x0D85, CHAR_WORD}, {0x0D97, CHAR_PUNCT}, {0x0D9A, CHAR_WORD},
+    {0x0DB2, CHAR_PUNCT}, {0x0DB3, CHAR_WORD}, {0x0DBC, CHAR_PUNCT},
+    {0x0DBD, CHAR_WORD}, {0x0DBE, CHAR_PUNCT}, {0x0DC0, CHAR_WORD},
+    {0x0DC7, CHAR_PUNCT}, {0x0DE6, CHAR_WORD}, {0x0DF0, CHAR_PUNCT},
+    {0x0E01, CHAR_WORD}, {0x0E31, CHAR_PUNCT}, {0x0E32, CHAR_WORD},
+    {0x0E34, CHAR_PUNCT}, {0x0E40, CHAR_WORD}, {0x0E47, CHAR_PUNCT},
+    {0x0E50, CHAR_WORD}, {0x0E5A, CHAR_PUNCT}, {0x0E81, CHAR_WORD},
+    {0x0E83, CHAR_PUNCT}, {0x0E84, CHAR_WORD}, {0x0E85, CHAR_PUNCT},
+    {0x0E86, CHAR_WORD}, {0x0E8B, CHAR_PUNCT}, {0x0E8C, CHAR_WORD},
+    {0x0EA4, CHAR_PUNCT}, {0x0EA5, CHAR_WORD}, {0x0EA6, CHAR_PUNCT},
+    {0x0EA7, CHAR_WORD}, {0x0EB1, CHAR_PUNCT}, {0x0EB2, CHAR_WORD},
+    {0x0EB4, CHAR_PUNCT}, {0x0EBD, CHAR_WORD}, {0x0EBE, CHAR_PUNCT},
+    {0x0EC0, CHAR_WORD}, {0x0EC5, CHAR_PUNCT}, {0x0EC6, CHAR_WORD},
+    {0x0EC7, CHAR_PUNCT}, {0x0ED0, CHAR_WORD}, {0x0EDA, CHAR_PUNCT},
+    {0x0EDC, CHAR_WORD}, {0x0EE0, CHAR_PUNCT}, {0x0F00, CHAR_WORD},
+    {0x0F01, CHAR_PUNCT}, {0x0F20, CHAR_WORD}, {0x0F34, CHAR_PUNCT},
+    {0x0F40, CHAR_WORD}, {0x0F48, CHAR_PUNCT}, {0x0F49, CHAR_WORD},
+    {0x0F6D, CHAR_PUNCT}, {0x0F88, CHAR_WORD}, {0x0F8D, CHAR_PUNCT},
+    {0x1000, CHAR_WORD}, {0x102B, CHAR_PUNCT}, {0x103F, CHAR_WORD},
+    {0x104A, CHAR_PUNCT}, {0x1050, CHAR_WORD}, {0x1056, CHAR_PUNCT},
+    {0x105A, CHAR_WORD}, {0x105E, CHAR_PUNCT}, {0x1061, CHAR_WORD},
+    {0x1062, CHAR_PUNCT}, {0x1065, CHAR_WORD}, {0x1067, CHAR_PUNCT},
+    {0x106E, CHAR_WORD}, {0x1071, CHAR_PUNCT}, {0x1075, CHAR_WORD},
+    {0x1082, CHAR_PUNCT}, {0x108E, CHAR_WORD}, {0x108F, CHAR_PUNCT},
+    {0x1090, CHAR_WORD}, {0x109A, CHAR_PUNCT}, {0x10A0, CHAR_WORD},
+    {0x10C6, CHAR_PUNCT}, {0x10C7, CHAR_WORD}, {0x10C8, CHAR_PUNCT},
+    {0x10CD, CHAR_WORD}, {0x10CE, CHAR_PUNCT}, {0x10D0, CHAR_WORD},
+    {0x10FB, CHAR_PUNCT}, {0x10FC, CHAR_WORD}, {0x1249, CHAR_PUNCT},
+    {0x124A, CHAR_WORD}, {0x124E, CHAR_PUNCT}, {0x1250, CHAR_WORD},
+    {0x1257, CHAR_PUNCT}, {0x1258, CHAR_WORD}, {0x1259, CHAR_PUNCT},
+    {0x125A, CHAR_WORD}, {0x125E, CHAR_PUNCT}, {0x1260, CHAR_WORD},
+    {0x1289, CHAR_PUNCT}, {0x128A, CHAR_WORD}, {0x128E, CHAR_PUNCT},
+    {0x1290, CHAR_WORD}, {0x12B1, CHAR_PUNCT}, {0x12B2, CHAR_WORD},
+    {0x12B6, CHAR_PUNCT}, {0x12B8, CHAR_WORD}, {0x12BF, CHAR_PUNCT},
+    {0x12C0, CHAR_WORD}, {0x12C1, CHAR_PUNCT}, {0x12C2, CHAR_WORD},
+    {0x12C6, CHAR_PUNCT}, {0x12C8, CHAR_WORD}, {0x12D7, CHAR_PUNCT},
+    {0x12D8, CHAR_WORD}, {0x1311, CHAR_PUNCT}, {0x1312, CHAR_WORD},
+    {0x1316, CHAR_PUNCT}, {0x1318, CHAR_WORD}, {0x135B, CHAR_PUNCT},
+    {0x1369, CHAR_WORD}, {0x137D, CHAR_PUNCT}, {0x1380, CHAR_WORD},
+    {0x1390, CHAR_PUNCT}, {0x13A0, CHAR_WORD}, {0x13F6, CHAR_PUNCT},
+    {0x13F8, CHAR_WORD}, {0x13FE, CHAR_PUNCT}, {0x1401, CHAR_WORD},
+    {0x166D, CHAR_PUNCT}, {0x166F, CHAR_WORD}, {0x1680, CHAR_SPACE},
+    {0x1681, CHAR_WORD}, {0x169B, CHAR_PUNCT}, {0x16A0, CHAR_WORD},
+    {0x16EB, CHAR_PUNCT}, {0x16EE, CHAR_WORD}, {0x16F9, CHAR_PUNCT},
+    {0x1700, CHAR_WORD}, {0x1712, CHAR_PUNCT}, {0x171F, CHAR_WORD},
+    {0x1732, CHAR_PUNCT}, {0x1740, CHAR_WORD}, {0x1752, CHAR_PUNCT},
+    {0x1760, CHAR_WORD}, {0x176D, CHAR_PUNCT}, {0x176E, CHAR_WORD},
+    {0x1771, CHAR_PUNCT}, {0x1780, CHAR_WORD}, {0x17B4, CHAR_PUNCT},
+    {0x17D7, CHAR_WORD}, {0x17D8, CHAR_PUNCT}, {0x17DC, CHAR_WORD},
+    {0x17DD, CHAR_PUNCT}, {0x17E0, CHAR_WORD}, {0x17EA, CHAR_PUNCT},
+    {0x17F0, CHAR_WORD}, {0x17FA, CHAR_PUNCT}, {0x1810, CHAR_WORD},
+    {0x181A, CHAR_PUNCT}, {0x1820, CHAR_WORD}, {0x1879, CHAR_PUNCT},
+    {0x1880, CHAR_WORD}, {0x1885, CHAR_PUNCT}, {0x1887, CHAR_WORD},
+    {0x18A9, CHAR_PUNCT}, {0x18AA, CHAR_WORD}, {0x18AB, CHAR_PUNCT},
+    {0x18B0, CHAR_WORD}, {0x18F6, CHAR_PUNCT}, {0x1900, CHAR_WORD},
+    {0x191F, CHAR_PUNCT}, {0x1946, CHAR_WORD}, {0x196E, CHAR_PUNCT},
+    {0x1970, CHAR_WORD}, {0x1975, CHAR_PUNCT}, {0x1980, CHAR_WORD},
+    {0x19AC, CHAR_PUNCT}, {0x19B0, CHAR_WORD}, {0x19CA, CHAR_PUNCT},
+    {0x19D0, CHAR_WORD}, {0x19DB, CHAR_PUNCT}, {0x1A00, CHAR_WORD},
+    {0x1A17, CHAR_PUNCT}, {0x1A20, CHAR_WORD}, {0x1A55, CHAR_PUNCT},
+    {0x1A80, CHAR_WORD}, {0x1A8A, CHAR_PUNCT}, {0x1A90, CHAR_WORD},
+    {0x1A9A, CHAR_PUNCT}, {0x1AA7, CHAR_WORD}, {0x1AA8, CHAR_PUNCT},
+    {0x1B05, CHAR_WORD}, {0x1B34, CHAR_PUNCT}, {0x1B45, CHAR_WORD},
+    {0x1B4D, CHAR_PUNCT}, {0x1B50, CHAR_WORD}, {0x1B5A, CHAR_PUNCT},
+    {0x1B83, CHAR_WORD}, {0x1BA1, CHAR_PUNCT}, {0x1BAE, CHAR_WORD},
+    {0x1BE6, CHAR_PUNCT}, {0x1C00, CHAR_WORD}, {0x1C24, CHAR_PUNCT},
+    {0x1C40, CHAR_WORD}, {0x1C4A, CHAR_PUNCT}, {0x1C4D, CHAR_WORD},
+    {0x1C7E, CHAR_PUNCT}, {0x1C80, CHAR_WORD}, {0x1C89, CHAR_PUNCT},
+    {0x1C90, CHAR_WORD}, {0x1CBB, CHAR_PUNCT}, {0x1CBD, CHAR_WORD},
+    {0x1CC0, CHAR_PUNCT}, {0x1CE9, CHAR_WORD}, {0x1CED, CHAR_PUNCT},
+    {0x1CEE, CHAR_WORD}, {0x1CF4, CHAR_PUNCT}, {0x1CF5, CHAR_WORD},
+    {0x1CF7, CHAR_PUNCT}, {0x1CFA, CHAR_WORD}, {0x1CFB, CHAR_PUNCT},
+    {0x1D00, CHAR_WORD}, {0x1DC0, CHAR_PUNCT}, {0x1E00, CHAR_WORD},
+    {0x1F16, CHAR_PUNCT}, {0x1F18, CHAR_WORD}, {0x1F1E, CHAR_PUNCT},
+    {0x1F20, CHAR_WORD}, {0x1F46, CHAR_PUNCT}, {0x1F48, CHAR_WORD},
+    {0x1F4E, CHAR_PUNCT}, {0x1F50, CHAR_WORD}, {0x1F58, CHAR_PUNCT},
+    {0x1F59, CHAR_WORD}, {0x1F5A, CHAR_PUNCT}, {0x1F5B, CHAR_WORD},
+    {0x1F5C, CHAR_PUNCT}, {0x1F5D, CHAR_WORD}, {0x1F5E, CHAR_PUNCT},
+    {0x1F5F, CHAR_WORD}, {0x1F7E, CHAR_PUNCT}, {0x1F80, CHAR_WORD},
+    {0x1FB5, CHAR_PUNCT}, {0x1FB6, CHAR_WORD}, {0x1FBD, CHAR_PUNCT},
+    {0x1FBE, CHAR_WORD}, {0x1FBF, CHAR_PUNCT}, {0x1FC2, CHAR_WORD},
+    {0x1FC5, CHAR_PUNCT}, {0x1FC6, CHAR_WORD}, {0x1FCD, CHAR_PUNCT},
+    {0x1FD0, CHAR_WORD}, {0x1FD4, CHAR_PUNCT}, {0x1FD6, CHAR_WORD},
+    {0x1FDC, CHAR_PUNCT}, {0x1FE0, CHAR_WORD}, {0x1FED, CHAR_PUNCT},
+    {0x1FF2, CHAR_WORD}, {0x1FF5, CHAR_PUNCT}, {0x1FF6, CHAR_WORD},
+    {0x1FFD, CHAR_PUNCT}, {0x2000, CHAR_SPACE}, {0x200B, CHAR_PUNCT},
+    {0x2028, CHAR_SPACE}, {0x202A, CHAR_PUNCT}, {0x202F, CHAR_SPACE},
+    {0x2030, CHAR_PUNCT}, {0x205F, CHAR_SPACE}, {0x2060, CHAR_PUNCT},
+    {0x2070, CHAR_WORD}, {0x2072, CHAR_PUNCT}, {0x2074, CHAR_WORD},
+    {0x207A, CHAR_PUNCT}, {0x207F, CHAR_WORD}, {0x208A, CHAR_PUNCT},
+    {0x2090, CHAR_WORD}, {0x209D, CHAR_PUNCT}, {0x2102, CHAR_WORD},
+    {0x2103, CHAR_PUNCT}, {0x2107, CHAR_WORD}, {0x2108, CHAR_PUNCT},
+    {0x210A, CHAR_WORD}, {0x2114, CHAR_PUNCT}, {0x2115, CHAR_WORD},
+    {0x2116, CHAR_PUNCT}, {0x2119, CHAR_WORD}, {0x211E, CHAR_PUNCT},
+    {0x2124, CHAR_WORD}, {0x2125, CHAR_PUNCT}, {0x2126, CHAR_WORD},
+    {0x2127, CHAR_PUNCT}, {0x2128, CHAR_WORD}, {0x2129, CHAR_PUNCT},
+    {0x212A, CHAR_WORD}, {0x212E, CHAR_PUNCT}, {0x212F, CHAR_WORD},
+    {0x213A, CHAR_PUNCT}, {0x213C, CHAR_WORD}, {0x2140, CHAR_PUNCT},
+    {0x2145, CHAR_WORD}, {0x214A, CHAR_PUNCT}, {0x214E, CHAR_WORD},
+    {0x214F, CHAR_PUNCT}, {0x2150, CHAR_WORD}, {0x218A, CHAR_PUNCT},
+    {0x2460, CHAR_WORD}, {0x249C, CHAR_PUNCT}, {0x24EA, CHAR_WORD},
+    {0x2500, CHAR_PUNCT}, {0x2776, CHAR_WORD}, {0x2794, CHAR_PUNCT},
+    {0x2C00, CHAR_WORD}, {0x2CE5, CHAR_PUNCT}, {0x2CEB, CHAR_WORD},
+    {0x2CEF, CHAR_PUNCT}, {0x2CF2, CHAR_WORD}, {0x2CF4, CHAR_PUNCT},
+    {0x2CFD, CHAR_WORD}, {0x2CFE, CHAR_PUNCT}, {0x2D00, CHAR_WORD},
+    {0x2D26, CHAR_PUNCT}, {0x2D27, CHAR_WORD}, {0x2D28, CHAR_PUNCT},
+    {0x2D2D, CHAR_WORD}, {0x2D2E, CHAR_PUNCT}, {0x2D30, CHAR_WORD},
+    {0x2D68, CHAR_PUNCT}, {0x2D6F, CHAR_WORD}, {0x2D70, CHAR_PUNCT},
+    {0x2D80, CHAR_WORD}, {0x2D97, CHAR_PUNCT}, {0x2DA0, CHAR_WORD},
+    {0x2DA7, CHAR_PUNCT}, {0x2DA8, CHAR_WORD}, {0x2DAF, CHAR_PUNCT},
+    {0x2DB0, CHAR_WORD}, {0x2DB7, CHAR_PUNCT}, {0x2DB8, CHAR_WORD},
+    {0x2DBF, CHAR_PUNCT}, {0x2DC0, CHAR_WORD}, {0x2DC7, CHAR_PUNCT},
+    {0x2DC8, CHAR_WORD}, {0x2DCF, CHAR_PUNCT}, {0x2DD0, CHAR_WORD},
+    {0x2DD7, CHAR_PUNCT}, {0x2DD8, CHAR_WORD}, {0x2DDF, CHAR_PUNCT},
+    {0x2E2F, CHAR_WORD}, {0x2E30, CHAR_PUNCT}, {0x3000, CHAR_SPACE},
+    {0x3001, CHAR_PUNCT}, {0x3005, CHAR_WORD}, {0x3008, CHAR_PUNCT},
+    {0x3021, CHAR_WORD}, {0x302A, CHAR_PUNCT}, {0x3031, CHAR_WORD},
+    {0x3036, CHAR_PUNCT}, {0x3038, CHAR_WORD}, {0x303D, CHAR_PUNCT},
+    {0x3041, CHAR_WORD}, {0x3097, CHAR_PUNCT}, {0x309D, CHAR_WORD},
+    {0x30A0, CHAR_PUNCT}, {0x30A1, CHAR_WORD}, {0x30FB, CHAR_PUNCT},
+    {0x30FC, CHAR_WORD}, {0x3100, CHAR_PUNCT}, {0x3105, CHAR_WORD},
+    {0x3130, CHAR_PUNCT}, {0x3131, CHAR_WORD}, {0x318F, CHAR_PUNCT},
+    {0x3192, CHAR_WORD}, {0x3196, CHAR_PUNCT}, {0x31A0, CHAR_WORD},
+    {0x31C0, CHAR_PUNCT}, {0x31F0, CHAR_WORD}, {0x3200, CHAR_PUNCT},
+    {0x3220, CHAR_WORD}, {0x322A, CHAR_PUNCT}, {0x3248, CHAR_WORD},
+    {0x3250, CHAR_PUNCT}, {0x3251, CHAR_WORD}, {0x3260, CHAR_PUNCT},
+    {0x3280, CHAR_WORD}, {0x328A, CHAR_PUNCT}, {0x32B1, CHAR_WORD},
+    {0x32C0, CHAR_PUNCT}, {0x3400, CHAR_WORD}, {0x4DC0, CHAR_PUNCT},
+    {0x4E00, CHAR_WORD}, {0xA48D, CHAR_PUNCT}, {0xA4D0, CHAR_WORD},
+    {0xA4FE, CHAR_PUNCT}, {0xA500, CHAR_WORD}, {0xA60D, CHAR_PUNCT},
+    {0xA610, CHAR_WORD}, {0xA62C, CHAR_PUNCT}, {0xA640, CHAR_WORD},
+    {0xA66F, CHAR_PUNCT}, {0xA67F, CHAR_WORD}, {0xA69E, CHAR_PUNCT},
+    {0xA6A0, CHAR_WORD}, {0xA6F0, CHAR_PUNCT}, {0xA717, CHAR_WORD},
+    {0xA720, CHAR_PUNCT}, {0xA722, CHAR_WORD}, {0xA789, CHAR_PUNCT},
+    {0xA78B, CHAR_WORD}, {0xA7CB, CHAR_PUNCT}, {0xA7D0, CHAR_WORD},
+    {0xA7D2, CHAR_PUNCT}, {0xA7D3, CHAR_WORD}, {0xA7D4, CHAR_PUNCT},
+    {0xA7D5, CHAR_WORD}, {0xA7DA, CHAR_PUNCT}, {0xA7F2, CHAR_WORD},
+    {0xA802, CHAR_PUNCT}, {0xA803, CHAR_WORD}, {0xA806, CHAR_PUNCT},
+    {0xA807, CHAR_WORD}, {0xA80B, CHAR_PUNCT}, {0xA80C, CHAR_WORD},
+    {0xA823, CHAR_PUNCT}, {0xA830, CHAR_WORD}, {0xA836, CHAR_PUNCT},
+    {0xA840, CHAR_WORD}, {0xA874, CHAR_PUNCT}, {0xA882, CHAR_WORD},
+    {0xA8B4, CHAR_PUNCT}, {0xA8D0, CHAR_WORD}, {0xA8DA, CHAR_PUNCT},
+    {0xA8F2, CHAR_WORD}, {0xA8F8, CHAR_PUNCT}, {0xA8FB, CHAR_WORD},
+    {0xA8FC, CHAR_PUNCT}, {0xA8FD, CHAR_WORD}, {0xA8FF, CHAR_PUNCT},
+    {0xA900, CHAR_WORD}, {0xA926, CHAR_PUNCT}, {0xA930, CHAR_WORD},
+    {0xA947, CHAR_PUNCT}, {0xA960, CHAR_WORD}, {0xA97D, CHAR_PUNCT},
+    {0xA984, CHAR_WORD}, {0xA9B3, CHAR_PUNCT}, {0xA9CF, CHAR_WORD},
+    {0xA9DA, CHAR_PUNCT}, {0xA9E0, CHAR_WORD}, {0xA9E5, CHAR_PUNCT},
+    {0xA9E6, CHAR_WORD}, {0xA9FF, CHAR_PUNCT}, {0xAA00, CHAR_WORD},
+    {0xAA29, CHAR_PUNCT}, {0xAA40, CHAR_WORD}, {0xAA43, CHAR_PUNCT},
+    {0xAA44, CHAR_WORD}, {0xAA4C, CHAR_PUNCT}, {0xAA50, CHAR_WORD},
+    {0xAA5A, CHAR_PUNCT}, {0xAA60, CHAR_WORD}, {0xAA77, CHAR_PUNCT},
+    {0xAA7A, CHAR_WORD}, {0xAA7B, CHAR_PUNCT}, {0xAA7E, CHAR_WORD},
+    {0xAAB0, CHAR_PUNCT}, {0xAAB1, CHAR_WORD}, {0xAAB2, CHAR_PUNCT},
+    {0xAAB5, CHAR_WORD}, {0xAAB7, CHAR_PUNCT}, {0xAAB9, CHAR_WORD},
+    {0xAABE, CHAR_PUNCT}, {0xAAC0, CHAR_WORD}, {0xAAC1, CHAR_PUNCT},
+    {0xAAC2, CHAR_WORD}, {0xAAC3, CHAR_PUNCT}, {0xAADB, CHAR_WORD},
+    {0xAADE, CHAR_PUNCT}, {0xAAE0, CHAR_WORD}, {0xAAEB, CHAR_PUNCT},
+    {0xAAF2, CHAR_WORD}, {0xAAF5, CHAR_PUNCT}, {0xAB01, CHAR_WORD},
+    {0xAB07, CHAR_PUNCT}, {0xAB09, CHAR_WORD}, {0xAB0F, CHAR_PUNCT},
+    {0xAB11, CHAR_WORD}, {0xAB17, CHAR_PUNCT}, {0xAB20, CHAR_WORD},
+    {0xAB27, CHAR_PUNCT}, {0xAB28, CHAR_WORD}, {0xAB2F, CHAR_PUNCT},
+    {0xAB30, CHAR_WORD}, {0xAB5B, CHAR_PUNCT}, {0xAB5C, CHAR_WORD},
+    {0xAB6A, CHAR_PUNCT}, {0xAB70, CHAR_WORD}, {0xABE3, CHAR_PUNCT},
+    {0xABF0, CHAR_WORD}, {0xABFA, CHAR_PUNCT}, {0xAC00, CHAR_WORD},
+    {0xD7A4, CHAR_PUNCT}, {0xD7B0, CHAR_WORD}, {0xD7C7, CHAR_PUNCT},
+    {0xD7CB, CHAR_WORD}, {0xD7FC, CHAR_PUNCT}, {0xF900, CHAR_WORD},
+    {0xFA6E, CHAR_PUNCT}, {0xFA70, CHAR_WORD}, {0xFADA, CHAR_PUNCT},
+    {0xFB00, CHAR_WORD}, {0xFB07, CHAR_PUNCT}, {0xFB13, CHAR_WORD},
+    {0xFB18, CHAR_PUNCT}, {0xFB1D, CHAR_WORD}, {0xFB1E, CHAR_PUNCT},
+    {0xFB1F, CHAR_WORD}, {0xFB29, CHAR_PUNCT}, {0xFB2A, CHAR_WORD},
+    {0xFB37, CHAR_PUNCT}, {0xFB38, CHAR_WORD}, {0xFB3D, CHAR_PUNCT},
+    {0xFB3E, CHAR_WORD}, {0xFB3F, CHAR_PUNCT}, {0xFB40, CHAR_WORD},
+    {0xFB42, CHAR_PUNCT}, {0xFB43, CHAR_WORD}, {0xFB45, CHAR_PUNCT},
+    {0xFB46, CHAR_WORD}, {0xFBB2, CHAR_PUNCT}, {0xFBD3, CHAR_WORD},
+    {0xFD3E, CHAR_PUNCT}, {0xFD50, CHAR_WORD}, {0xFD90, CHAR_PUNCT},
+    {0xFD92, CHAR_WORD}, {0xFDC8, CHAR_PUNCT}, {0xFDF0, CHAR_WORD},
+    {0xFDFC, CHAR_PUNCT}, {0xFE70, CHAR_WORD}, {0xFE75, CHAR_PUNCT},
+    {0xFE76, CHAR_WORD}, {0xFEFD, CHAR_PUNCT}, {0xFF10, CHAR_WORD},
+    {0xFF1A, CHAR_PUNCT}, {0xFF21, CHAR_WORD}, {0xFF3B, CHAR_PUNCT},
+    {0xFF41, CHAR_WORD}, {0xFF5B, CHAR_PUNCT}, {0xFF66, CHAR_WORD},
+    {0xFFBF, CHAR_PUNCT}, {0xFFC2, CHAR_WORD}, {0xFFC8, CHAR_PUNCT},
+    {0xFFCA, CHAR_WORD}, {0xFFD0, CHAR_PUNCT}, {0xFFD2, CHAR_WORD},
+    {0xFFD8, CHAR_PUNCT}, {0xFFDA, CHAR_WORD}, {0xFFDD, CHAR_PUNCT},
+    {0x10000, CHAR_WORD}, {0x1000C, CHAR_PUNCT}, {0x1000D, CHAR_WORD},
+    {0x10027, CHAR_PUNCT}, {0x10028, CHAR_WORD}, {0x1003B, CHAR_PUNCT},
+    {0x1003C, CHAR_WORD}, {0x1003E, CHAR_PUNCT}, {0x1003F, CHAR_WORD},
+    {0x1004E, CHAR_PUNCT}, {0x10050, CHAR_WORD}, {0x1005E, CHAR_PUNCT},
+    {0x10080, CHAR_WORD}, {0x100FB, CHAR_PUNCT}, {0x10107, CHAR_WORD},
+    {0x10134, CHAR_PUNCT}, {0x10140, CHAR_WORD}, {0x10179, CHAR_PUNCT},
+    {0x1018A, CHAR_WORD}, {0x1018C, CHAR_PUNCT}, {0x10280, CHAR_WORD},
+    {0x1029D, CHAR_PUNCT}, {0x102A0, CHAR_WORD}, {0x102D1, CHAR_PUNCT},
+    {0x102E1, CHAR_WORD}, {0x102FC, CHAR_PUNCT}, {0x10300, CHAR_WORD},
+    {0x10324, CHAR_PUNCT}, {0x1032D, CHAR_WORD}, {0x1034B, CHAR_PUNCT},
+    {0x10350, CHAR_WORD}, {0x10376, CHAR_PUNCT}, {0x10380, CHAR_WORD},
+    {0x1039E, CHAR_PUNCT}, {0x103A0, CHAR_WORD}, {0x103C4, CHAR_PUNCT},
+    {0x103C8, CHAR_WORD}, {0x103D0, CHAR_PUNCT}, {0x103D1, CHAR_WORD},
+    {0x103D6, CHAR_PUNCT}, {0x10400, CHAR_WORD}, {0x1049E, CHAR_PUNCT},
+    {0x104A0, CHAR_WORD}, {0x104AA, CHAR_PUNCT}, {0x104B0, CHAR_WORD},
+    {0x104D4, CHAR_PUNCT}, {0x104D8, CHAR_WORD}, {0x104FC, CHAR_PUNCT},
+    {0x10500, CHAR_WORD}, {0x10528, CHAR_PUNCT}, {0x10530, CHAR_WORD},
+    {0x10564, CHAR_PUNCT}, {0x10570, CHAR_WORD}, {0x1057B, CHAR_PUNCT},
+    {0x1057C, CHAR_WORD}, {0x1058B, CHAR_PUNCT}, {0x1058C, CHAR_WORD},
+    {0x10593, CHAR_PUNCT}, {0x10594, CHAR_WORD}, {0x10596, CHAR_PUNCT},
+    {0x10597, CHAR_WORD}, {0x105A2, CHAR_PUNCT}, {0x105A3, CHAR_WORD},
+    {0x105B2, CHAR_PUNCT}, {0x105B3, CHAR_WORD}, {0x105BA, CHAR_PUNCT},
+    {0x105BB, CHAR_WORD}, {0x105BD, CHAR_PUNCT}, {0x10600, CHAR_WORD},
+    {0x10737, CHAR_PUNCT}, {0x10740, CHAR_WORD}, {0x10756, CHAR_PUNCT},
+    {0x10760, CHAR_WORD}, {0x10768, CHAR_PUNCT}, {0x10780, CHAR_WORD},
+    {0x10786, CHAR_PUNCT}, {0x10787, CHAR_WORD}, {0x107B1, CHAR_PUNCT},
+    {0x107B2, CHAR_WORD}, {0x107BB, CHAR_PUNCT}, {0x10800, CHAR_WORD},
+    {0x10806, CHAR_PUNCT}, {0x10808, CHAR_WORD}, {0x10809, CHAR_PUNCT},
+    {0x1080A, CHAR_WORD}, {0x10836, CHAR_PUNCT}, {0x10837, CHAR_WORD},
+    {0x10839, CHAR_PUNCT}, {0x1083C, CHAR_WORD}, {0x1083D, CHAR_PUNCT},
+    {0x1083F, CHAR_WORD}, {0x10856, CHAR_PUNCT}, {0x10858, CHAR_WORD},
+    {0x10877, CHAR_PUNCT}, {0x10879, CHAR_WORD}, {0x1089F, CHAR_PUNCT},
+    {0x108A7, CHAR_WORD}, {0x108B0, CHAR_PUNCT}, {0x108E0, CHAR_WORD},
+    {0x108F3, CHAR_PUNCT}, {0x108F4, CHAR_WORD}, {0x108F6, CHAR_PUNCT},
+    {0x108FB, CHAR_WORD}, {0x1091C, CHAR_PUNCT}, {0x10920, CHAR_WORD},
+    {0x1093A, CHAR_PUNCT}, {0x10980, CHAR_WORD}, {0x109B8, CHAR_PUNCT},
+    {0x109BC, CHAR_WORD}, {0x109D0, CHAR_PUNCT}, {0x109D2, CHAR_WORD},
+    {0x10A01, CHAR_PUNCT}, {0x10A10, CHAR_WORD}, {0x10A14, CHAR_PUNCT},
+    {0x10A15, CHAR_WORD}, {0x10A18, CHAR_PUNCT}, {0x10A19, CHAR_WORD},
+    {0x10A36, CHAR_PUNCT}, {0x10A40, CHAR_WORD}, {0x10A49, CHAR_PUNCT},
+    {0x10A60, CHAR_WORD}, {0x10A7F, CHAR_PUNCT}, {0x10A80, CHAR_WORD},
+    {0x10AA0, CHAR_PUNCT}, {0x10AC0, CHAR_WORD}, {0x10AC8, CHAR_PUNCT},
+    {0x10AC9, CHAR_WORD}, {0x10AE5, CHAR_PUNCT}, {0x10AEB, CHAR_WORD},
+    {0x10AF0, CHAR_PUNCT}, {0x10B00, CHAR_WORD}, {0x10B36, CHAR_PUNCT},
+    {0x10B40, CHAR_WORD}, {0x10B56, CHAR_PUNCT}, {0x10B58, CHAR_WORD},
+    {0x10B73, CHAR_PUNCT}, {0x10B78, CHAR_WORD}, {0x10B92, CHAR_PUNCT},
+    {0x10BA9, CHAR_WORD}, {0x10BB0, CHAR_PUNCT}, {0x10C00, CHAR_WORD},
+    {0x10C49, CHAR_PUNCT}, {0x10C80, CHAR_WORD}, {0x10CB3, CHAR_PUNCT},
+    {0x10CC0, CHAR_WORD}, {0x10CF3, CHAR_PUNCT}, {0x10CFA, CHAR_WORD},
+    {0x10D24, CHAR_PUNCT}, {0x10D30, CHAR_WORD}, {0x10D3A, CHAR_PUNCT},
+    {0x10E60, CHAR_WORD}, {0x10E7F, CHAR_PUNCT}, {0x10E80, CHAR_WORD},
+    {0x10EAA, CHAR_PUNCT}, {0x10EB0, CHAR_WORD}, {0x10EB2, CHAR_PUNCT},
+    {0x10F00, CHAR_WORD}, {0x10F28, CHAR_PUNCT}, {0x10F30, CHAR_WORD},
+    {0x10F46, CHAR_PUNCT}, {0x10F51, CHAR_WORD}, {0x10F55, CHAR_PUNCT},
+    {0x10F70, CHAR_WORD}, {0x10F82, CHAR_PUNCT}, {0x10FB0, CHAR_WORD},
+    {0x10FCC, CHAR_PUNCT}, {0x10FE0, CHAR_WORD}, {0x10FF7, CHAR_PUNCT},
+    {0x11003, CHAR_WORD}, {0x11038, CHAR_PUNCT}, {0x11052, CHAR_WORD},
+    {0x11070, CHAR_PUNCT}, {0x11071, CHAR_WORD}, {0x11073, CHAR_PUNCT},
+    {0x11075, CHAR_WORD}, {0x11076, CHAR_PUNCT}, {0x11083, CHAR_WORD},
+    {0x110B0, CHAR_PUNCT}, {0x110D0, CHAR_WORD}, {0x110E9, CHAR_PUNCT},
+    {0x110F0, CHAR_WORD}, {0x110FA, CHAR_PUNCT}, {0x11103, CHAR_WORD},
+    {0x11127, CHAR_PUNCT}, {0x11136, CHAR_WORD}, {0x11140, CHAR_PUNCT},
+    {0x11144, CHAR_WORD}, {0x11145, CHAR_PUNCT}, {0x11147, CHAR_WORD},
+    {0x11148, CHAR_PUNCT}, {0x11150, CHAR_WORD}, {0x11173, CHAR_PUNCT},
+    {0x11176, CHAR_WORD}, {0x11177, CHAR_PUNCT}, {0x11183, CHAR_WORD},
+    {0x111B3, CHAR_PUNCT}, {0x111C1, CHAR_WORD}, {0x111C5, CHAR_PUNCT},
+    {0x111D0, CHAR_WORD}, {0x111DB, CHAR_PUNCT}, {0x111DC, CHAR_WORD},
+    {0x111DD, CHAR_PUNCT}, {0x111E1, CHAR_WORD}, {0x111F5, CHAR_PUNCT},
+    {0x11200, CHAR_WORD}, {0x11212, CHAR_PUNCT}, {0x11213, CHAR_WORD},
+    {0x1122C, CHAR_PUNCT}, {0x1123F, CHAR_WORD}, {0x11241, CHAR_PUNCT},
+    {0x11280, CHAR_WORD}, {0x11287, CHAR_PUNCT}, {0x11288, CHAR_WORD},
+    {0x11289, CHAR_PUNCT}, {0x1128A, CHAR_WORD}, {0x1128E, CHAR_PUNCT},
+    {0x1128F, CHAR_WORD}, {0x1129E, CHAR_PUNCT}, {0x1129F, CHAR_WORD},
+    {0x112A9, CHAR_PUNCT}, {0x112B0, CHAR_WORD}, {0x112DF, CHAR_PUNCT},
+    {0x112F0, CHAR_WORD}, {0x112FA, CHAR_PUNCT}, {0x11305, CHAR_WORD},
+    {0x1130D, CHAR_PUNCT}, {0x1130F, CHAR_WORD}, {0x11311, CHAR_PUNCT},
+    {0x11313, CHAR_WORD}, {0x11329, CHAR_PUNCT}, {0x1132A, CHAR_WORD},
+    {0x11331, CHAR_PUNCT}, {0x11332, CHAR_WORD}, {0x11334, CHAR_PUNCT},
+    {0x11335, CHAR_WORD}, {0x1133A, CHAR_PUNCT}, {0x1133D, CHAR_WORD},
+    {0x1133E, CHAR_PUNCT}, {0x11350, CHAR_WORD}, {0x11351, CHAR_PUNCT},
+    {0x1135D, CHAR_WORD}, {0x11362, CHAR_PUNCT}, {0x11400, CHAR_WORD},
+    {0x11435, CHAR_PUNCT}, {0x11447, CHAR_WORD}, {0x1144B, CHAR_PUNCT},
+    {0x11450, CHAR_WORD}, {0x1145A, CHAR_PUNCT}, {0x1145F, CHAR_WORD},
+    {0x11462, CHAR_PUNCT}, {0x11480, CHAR_WORD}, {0x114B0, CHAR_PUNCT},
+    {0x114C4, CHAR_WORD}, {0x114C6, CHAR_PUNCT}, {0x114C7, CHAR_WORD},
+    {0x114C8, CHAR_PUNCT}, {0x114D0, CHAR_WORD}, {0x114DA, CHAR_PUNCT},
+    {0x11580, CHAR_WORD}, {0x115AF, CHAR_PUNCT}, {0x115D8, CHAR_WORD},
+    {0x115DC, CHAR_PUNCT}, {0x11600, CHAR_WORD}, {0x11630, CHAR_PUNCT},
+    {0x11644, CHAR_WORD}, {0x11645, CHAR_PUNCT}, {0x11650, CHAR_WORD},
+    {0x1165A, CHAR_PUNCT}, {0x11680, CHAR_WORD}, {0x116AB, CHAR_PUNCT},
+    {0x116B8, CHAR_WORD}, {0x116B9, CHAR_PUNCT}, {0x116C0, CHAR_WORD},
+    {0x116CA, CHAR_PUNCT}, {0x11700, CHAR_WORD}, {0x1171B, CHAR_PUNCT},
+    {0x11730, CHAR_WORD}, {0x1173C, CHAR_PUNCT}, {0x11740, CHAR_WORD},
+    {0x11747, CHAR_PUNCT}, {0x11800, CHAR_WORD}, {0x1182C, CHAR_PUNCT},
+    {0x118A0, CHAR_WORD}, {0x118F3, CHAR_PUNCT}, {0x118FF, CHAR_WORD},
+    {0x11907, CHAR_PUNCT}, {0x11909, CHAR_WORD}, {0x1190A, CHAR_PUNCT},
+    {0x1190C, CHAR_WORD}, {0x11914, CHAR_PUNCT}, {0x11915, CHAR_WORD},
+    {0x11917, CHAR_PUNCT}, {0x11918, CHAR_WORD}, {0x11930, CHAR_PUNCT},
+    {0x1193F, CHAR_WORD}, {0x11940, CHAR_PUNCT}, {0x11941, CHAR_WORD},
+    {0x11942, CHAR_PUNCT}, {0x11950, CHAR_WORD}, {0x1195A, CHAR_PUNCT},
+    {0x119A0, CHAR_WORD}, {0x119A8, CHAR_PUNCT}, {0x119AA, CHAR_WORD},
+    {0x119D1, CHAR_PUNCT}, {0x119E1, CHAR_WORD}, {0x119E2, CHAR_PUNCT},
+    {0x119E3, CHAR_WORD}, {0x119E4, CHAR_PUNCT}, {0x11A00, CHAR_WORD},
+    {0x11A01, CHAR_PUNCT}, {0x11A0B, CHAR_WORD}, {0x11A33, CHAR_PUNCT},
+    {0x11A3A, CHAR_WORD}, {0x11A3B, CHAR_PUNCT}, {0x11A50, CHAR_WORD},
+    {0x11A51, CHAR_PUNCT}, {0x11A5C, CHAR_WORD}, {0x11A8A, CHAR_PUNCT},
+    {0x11A9D, CHAR_WORD}, {0x11A9E, CHAR_PUNCT}, {0x11AB0, CHAR_WORD},
+    {0x11AF9, CHAR_PUNCT}, {0x11C00, CHAR_WORD}, {0x11C09, CHAR_PUNCT},
+    {0x11C0A, CHAR_WORD}, {0x11C2F, CHAR_PUNCT}, {0x11C40, CHAR_WORD},
+    {0x11C41, CHAR_PUNCT}, {0x11C50, CHAR_WORD}, {0x11C6D, CHAR_PUNCT},
+    {0x11C72, CHAR_WORD}, {0x11C90, CHAR_PUNCT}, {0x11D00, CHAR_WORD},
+    {0x11D07, CHAR_PUNCT}, {0x11D08, CHAR_WORD}, {0x11D0A, CHAR_PUNCT},
+    {0x11D0B, CHAR_WORD}, {0x11D31, CHAR_PUNCT}, {0x11D46, CHAR_WORD},
+    {0x11D47, CHAR_PUNCT}, {0x11D50, CHAR_WORD}, {0x11D5A, CHAR_PUNCT},
+    {0x11D60, CHAR_WORD}, {0x11D66, CHAR_PUNCT}, {0x11D67, CHAR_WORD},
+    {0x11D69, CHAR_PUNCT}, {0x11D6A, CHAR_WORD}, {0x11D8A, CHAR_PUNCT},
+    {0x11D98, CHAR_WORD}, {0x11D99, CHAR_PUNCT}, {0x11DA0, CHAR_WORD},
+    {0x11DAA, CHAR_PUNCT}, {0x11EE0, CHAR_WORD}, {0x11EF3, CHAR_PUNCT},
+    {0x11F02, CHAR_WORD}, {0x11F03, CHAR_PUNCT}, {0x11F04, CHAR_WORD},
+    {0x11F11, CHAR_PUNCT}, {0x11F12, CHAR_WORD}, {0x11F34, CHAR_PUNCT},
+    {0x11F50, CHAR_WORD}, {0x11F5A, CHAR_PUNCT}, {0x11FB0, CHAR_WORD},
+    {0x11FB1, CHAR_PUNCT}, {0x11FC0, CHAR_WORD}, {0x11FD5, CHAR_PUNCT},
+    {0x12000, CHAR_WORD}, {0x1239A, CHAR_PUNCT}, {0x12400, CHAR_WORD},
+    {0x1246F, CHAR_PUNCT}, {0x12480, CHAR_WORD}, {0x12544, CHAR_PUNCT},
+    {0x12F90, CHAR_WORD}, {0x12FF1, CHAR_PUNCT}, {0x13000, CHAR_WORD},
+    {0x13430, CHAR_PUNCT}, {0x13441, CHAR_WORD}, {0x13447, CHAR_PUNCT},
+    {0x14400, CHAR_WORD}, {0x14647, CHAR_PUNCT}, {0x16800, CHAR_WORD},
+    {0x16A39, CHAR_PUNCT}, {0x16A40, CHAR_WORD}, {0x16A5F, CHAR_PUNCT},
+    {0x16A60, CHAR_WORD}, {0x16A6A, CHAR_PUNCT}, {0x16A70, CHAR_WORD},
+    {0x16ABF, CHAR_PUNCT}, {0x16AC0, CHAR_WORD}, {0x16ACA, CHAR_PUNCT},
+    {0x16AD0, CHAR_WORD}, {0x16AEE, CHAR_PUNCT}, {0x16B00, CHAR_WORD},
+    {0x16B30, CHAR_PUNCT}, {0x16B40, CHAR_WORD}, {0x16B44, CHAR_PUNCT},
+    {0x16B50, CHAR_WORD}, {0x16B5A, CHAR_PUNCT}, {0x16B5B, CHAR_WORD},
+    {0x16B62, CHAR_PUNCT}, {0x16B63, CHAR_WORD}, {0x16B78, CHAR_PUNCT},
+    {0x16B7D, CHAR_WORD}, {0x16B90, CHAR_PUNCT}, {0x16E40, CHAR_WORD},
+    {0x16E97, CHAR_PUNCT}, {0x16F00, CHAR_WORD}, {0x16F4B, CHAR_PUNCT},
+    {0x16F50, CHAR_WORD}, {0x16F51, CHAR_PUNCT}, {0x16F93, CHAR_WORD},
+    {0x16FA0, CHAR_PUNCT}, {0x16FE0, CHAR_WORD}, {0x16FE2, CHAR_PUNCT},
+    {0x16FE3, CHAR_WORD}, {0x16FE4, CHAR_PUNCT}, {0x17000, CHAR_WORD},
+    {0x187F8, CHAR_PUNCT}, {0x18800, CHAR_WORD}, {0x18CD6, CHAR_PUNCT},
+    {0x18D00, CHAR_WORD}, {0x18D09, CHAR_PUNCT}, {0x1AFF0, CHAR_WORD},
+    {0x1AFF4, CHAR_PUNCT}, {0x1AFF5, CHAR_WORD}, {0x1AFFC, CHAR_PUNCT},
+    {0x1AFFD, CHAR_WORD}, {0x1AFFF, CHAR_PUNCT}, {0x1B000, CHAR_WORD},
+    {0x1B123, CHAR_PUNCT}, {0x1B132, CHAR_WORD}, {0x1B133, CHAR_PUNCT},
+    {0x1B150, CHAR_WORD}, {0x1B153, CHAR_PUNCT}, {0x1B155, CHAR_WORD},
+    {0x1B156, CHAR_PUNCT}, {0x1B164, CHAR_WORD}, {0x1B168, CHAR_PUNCT},
+    {0x1B170, CHAR_WORD}, {0x1B2FC, CHAR_PUNCT}, {0x1BC00, CHAR_WORD},
+    {0x1BC6B, CHAR_PUNCT}, {0x1BC70, CHAR_WORD}, {0x1BC7D, CHAR_PUNCT},
+    {0x1BC80, CHAR_WORD}, {0x1BC89, CHAR_PUNCT}, {0x1BC90, CHAR_WORD},
+    {0x1BC9A, CHAR_PUNCT}, {0x1D2C0, CHAR_WORD}, {0x1D2D4, CHAR_PUNCT},
+    {0x1D2E0, CHAR_WORD}, {0x1D2F4, CHAR_PUNCT}, {0x1D360, CHAR_WORD},
+    {0x1D379, CHAR_PUNCT}, {0x1D400, CHAR_WORD}, {0x1D455, CHAR_PUNCT},
+    {0x1D456, CHAR_WORD}, {0x1D49D, CHAR_PUNCT}, {0x1D49E, CHAR_WORD},
+    {0x1D4A0, CHAR_PUNCT}, {0x1D4A2, CHAR_WORD}, {0x1D4A3, CHAR_PUNCT},
+    {0x1D4A5, CHAR_WORD}, {0x1D4A7, CHAR_PUNCT}, {0x1D4A9, CHAR_WORD},
+    {0x1D4AD, CHAR_PUNCT}, {0x1D4AE, CHAR_WORD}, {0x1D4BA, CHAR_PUNCT},
+    {0x1D4BB, CHAR_WORD}, {0x1D4BC, CHAR_PUNCT}, {0x1D4BD, CHAR_WORD},
+    {0x1D4C4, CHAR_PUNCT}, {0x1D4C5, CHAR_WORD}, {0x1D506, CHAR_PUNCT},
+    {0x1D507, CHAR_WORD}, {0x1D50B, CHAR_PUNCT}, {0x1D50D, CHAR_WORD},
+    {0x1D515, CHAR_PUNCT}, {0x1D516, CHAR_WORD}, {0x1D51D, CHAR_PUNCT},
+    {0x1D51E, CHAR_WORD}, {0x1D53A, CHAR_PUNCT}, {0x1D53B, CHAR_WORD},
+    {0x1D53F, CHAR_PUNCT}, {0x1D540, CHAR_WORD}, {0x1D545, CHAR_PUNCT},
+    {0x1D546, CHAR_WORD}, {0x1D547, CHAR_PUNCT}, {0x1D54A, CHAR_WORD},
+    {0x1D551, CHAR_PUNCT}, {0x1D552, CHAR_WORD}, {0x1D6A6, CHAR_PUNCT},
+    {0x1D6A8, CHAR_WORD}, {0x1D6C1, CHAR_PUNCT}, {0x1D6C2, CHAR_WORD},
+    {0x1D6DB, CHAR_PUNCT}, {0x1D6DC, CHAR_WORD}, {0x1D6FB, CHAR_PUNCT},
+    {0x1D6FC, CHAR_WORD}, {0x1D715, CHAR_PUNCT}, {0x1D716, CHAR_WORD},
+    {0x1D735, CHAR_PUNCT}, {0x1D736, CHAR_WORD}, {0x1D74F, CHAR_PUNCT},
+    {0x1D750, CHAR_WORD}, {0x1D76F, CHAR_PUNCT}, {0x1D770, CHAR_WORD},
+    {0x1D789, CHAR_PUNCT}, {0x1D78A, CHAR_WORD}, {0x1D7A9, CHAR_PUNCT},
+    {0x1D7AA, CHAR_WORD}, {0x1D7C3, CHAR_PUNCT}, {0x1D7C4, CHAR_WORD},
+    {0x1D7CC, CHAR_PUNCT}, {0x1D7CE, CHAR_WORD}, {0x1D800, CHAR_PUNCT},
+    {0x1DF00, CHAR_WORD}, {0x1DF1F, CHAR_PUNCT}, {0x1DF25, CHAR_WORD},
+    {0x1DF2B, CHAR_PUNCT}, {0x1E030, CHAR_WORD}, {0x1E06E, CHAR_PUNCT},
+    {0x1E100, CHAR_WORD}, {0x1E12D, CHAR_PUNCT}, {0x1E137, CHAR_WORD},
+    {0x1E13E, CHAR_PUNCT}, {0x1E140, CHAR_WORD}, {0x1E14A, CHAR_PUNCT},
+    {0x1E14E, CHAR_WORD}, {0x1E14F, CHAR_PUNCT}, {0x1E290, CHAR_WORD},
+    {0x1E2AE, CHAR_PUNCT}, {0x1E2C0, CHAR_WORD}, {0x1E2EC, CHAR_PUNCT},
+    {0x1E2F0, CHAR_WORD}, {0x1E2FA, CHAR_PUNCT}, {0x1E4D0, CHAR_WORD},
+    {0x1E4EC, CHAR_PUNCT}, {0x1E4F0, CHAR_WORD}, {0x1E4FA, CHAR_PUNCT},
+    {0x1E7E0, CHAR_WORD}, {0x1E7E7, CHAR_PUNCT}, {0x1E7E8, CHAR_WORD},
+    {0x1E7EC, CHAR_PUNCT}, {0x1E7ED, CHAR_WORD}, {0x1E7EF, CHAR_PUNCT},
+    {0x1E7F0, CHAR_WORD}, {0x1E7FF, CHAR_PUNCT}, {0x1E800, CHAR_WORD},
+    {0x1E8C5, CHAR_PUNCT}, {0x1E8C7, CHAR_WORD}, {0x1E8D0, CHAR_PUNCT},
+    {0x1E900, CHAR_WORD}, {0x1E944, CHAR_PUNCT}, {0x1E94B, CHAR_WORD},
+    {0x1E94C, CHAR_PUNCT}, {0x1E950, CHAR_WORD}, {0x1E95A, CHAR_PUNCT},
+    {0x1EC71, CHAR_WORD}, {0x1ECAC, CHAR_PUNCT}, {0x1ECAD, CHAR_WORD},
+    {0x1ECB0, CHAR_PUNCT}, {0x1ECB1, CHAR_WORD}, {0x1ECB5, CHAR_PUNCT},
+    {0x1ED01, CHAR_WORD}, {0x1ED2E, CHAR_PUNCT}, {0x1ED2F, CHAR_WORD},
+    {0x1ED3E, CHAR_PUNCT}, {0x1EE00, CHAR_WORD}, {0x1EE04, CHAR_PUNCT},
+    {0x1EE05, CHAR_WORD}, {0x1EE20, CHAR_PUNCT}, {0x1EE21, CHAR_WORD},
+    {0x1EE23, CHAR_PUNCT}, {0x1EE24, CHAR_WORD}, {0x1EE25, CHAR_PUNCT},
+    {0x1EE27, CHAR_WORD}, {0x1EE28, CHAR_PUNCT}, {0x1EE29, CHAR_WORD},
+    {0x1EE33, CHAR_PUNCT}, {0x1EE34, CHAR_WORD}, {0x1EE38, CHAR_PUNCT},
+    {0x1EE39, CHAR_WORD}, {0x1EE3A, CHAR_PUNCT}, {0x1EE3B, CHAR_WORD},
+    {0x1EE3C, CHAR_PUNCT}, {0x1EE42, CHAR_WORD}, {0x1EE43, CHAR_PUNCT},
+    {0x1EE47, CHAR_WORD}, {0x1EE48, CHAR_PUNCT}, {0x1EE49, CHAR_WORD},
+    {0x1EE4A, CHAR_PUNCT}, {0x1EE4B, CHAR_WORD}, {0x1EE4C, CHAR_PUNCT},
+    {0x1EE4D, CHAR_WORD}, {0x1EE50, CHAR_PUNCT}, {0x1EE51, CHAR_WORD},
+    {0x1EE53, CHAR_PUNCT}, {0x1EE54, CHAR_WORD}, {0x1EE55, CHAR_PUNCT},
+    {0x1EE57, CHAR_WORD}, {0x1EE58, CHAR_PUNCT}, {0x1EE59, CHAR_WORD},
+    {0x1EE5A, CHAR_PUNCT}, {0x1EE5B, CHAR_WORD}, {0x1EE5C, CHAR_PUNCT},
+    {0x1EE5D, CHAR_WORD}, {0x1EE5E, CHAR_PUNCT}, {0x1EE5F, CHAR_WORD},
+    {0x1EE60, CHAR_PUNCT}, {0x1EE61, CHAR_WORD}, {0x1EE63, CHAR_PUNCT},
+    {0x1EE64, CHAR_WORD}, {0x1EE65, CHAR_PUNCT}, {0x1EE67, CHAR_WORD},
+    {0x1EE6B, CHAR_PUNCT}, {0x1EE6C, CHAR_WORD}, {0x1EE73, CHAR_PUNCT},
+    {0x1EE74, CHAR_WORD}, {0x1EE78, CHAR_PUNCT}, {0x1EE79, CHAR_WORD},
+    {0x1EE7D, CHAR_PUNCT}, {0x1EE7E, CHAR_WORD}, {0x1EE7F, CHAR_PUNCT},
+    {0x1EE80, CHAR_WORD}, {0x1EE8A, CHAR_PUNCT}, {0x1EE8B, CHAR_WORD},
+    {0x1EE9C, CHAR_PUNCT}, {0x1EEA1, CHAR_WORD}, {0x1EEA4, CHAR_PUNCT},
+    {0x1EEA5, CHAR_WORD}, {0x1EEAA, CHAR_PUNCT}, {0x1EEAB, CHAR_WORD},
+    {0x1EEBC, CHAR_PUNCT}, {0x1F100, CHAR_WORD}, {0x1F10D, CHAR_PUNCT},
+    {0x1FBF0, CHAR_WORD}, {0x1FBFA, CHAR_PUNCT}, {0x20000, CHAR_WORD},
+    {0x2A6E0, CHAR_PUNCT}, {0x2A700, CHAR_WORD}, {0x2B73A, CHAR_PUNCT},
+    {0x2B740, CHAR_WORD}, {0x2B81E, CHAR_PUNCT}, {0x2B820, CHAR_WORD},
+    {0x2CEA2, CHAR_PUNCT}, {0x2CEB0, CHAR_WORD}, {0x2EBE1, CHAR_PUNCT},
+    {0x2F800, CHAR_WORD}, {0x2FA1E, CHAR_PUNCT}, {0x30000, CHAR_WORD},
+    {0x3134B, CHAR_PUNCT}, {0x31350, CHAR_WORD}, {0x323B0, CHAR_PUNCT},
+};
+
+/* Properties of a character, as Python's str methods see them */
+#define CHAR_IS_ALPHA 1 /* isalpha() */
+#define CHAR_IS_DIGIT 2 /* isdigit() */
+#define CHAR_IS_UPPER 4 /* isupper() */
+/* islower() or titlecase (Lt), which keep a string from being isupper() */
+#define CHAR_IS_LOWER_OR_TITLE 8
+/* For the final sigma of str.lower() */
+#define CHAR_IS_CASED 16
+#define CHAR_IS_CASE_IGNORABLE 32
+
+static const uint8_t ascii_char_props[128] = {
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 32,
+    0, 0, 0, 0, 0, 0, 32, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 32, 0, 0, 0, 0, 0,
+    0, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 0, 0, 0, 32, 0,
+    32, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 0, 0, 0, 0, 0,
+};
+
+/*
+ * Code points from first up to the next entry have the properties props, and
+ * lowercase to the code point lower_delta away, unless listed in
+ * unicode_long_lowercase.
+ */
+static const struct {
+  uint32_t first;
+  uint8_t props;
+  int32_t lower_delta;
+} unicode_case_ranges[3323] = {
+    {0x0080, 0, 0}, {0x00A8, 32, 0}, {0x00A9, 0, 0},
+    {0x00AA, 25, 0}, {0x00AB, 0, 0}, {0x00AD, 32, 0},
+    {0x00AE, 0, 0}, {0x00AF, 32, 0}, {0x00B0, 0, 0},
+    {0x00B2, 2, 0}, {0x00B4, 32, 0}, {0x00B5, 25, 0},
+    {0x00B6, 0, 0}, {0x00B7, 32, 0}, {0x00B9, 2, 0},
+    {0x00BA, 25, 0}, {0x00BB, 0, 0}, {0x00C0, 21, 32},
+    {0x00D7, 0, 0}, {0x00D8, 21, 32}, {0x00DF, 25, 0},
+    {0x00F7, 0, 0}, {0x00F8, 25, 0}, {0x0100, 21, 1},
+    {0x0101, 25, 0}, {0x0102, 21, 1}, {0x0103, 25, 0},
+    {0x0104, 21, 1}, {0x0105, 25, 0}, {0x0106, 21, 1},
+    {0x0107, 25, 0}, {0x0108, 21, 1}, {0x0109, 25, 0},
+    {0x010A, 21, 1}, {0x010B, 25, 0}, {0x010C, 21, 1},
+    {0x010D, 25, 0}, {0x010E, 21, 1}, {0x010F, 25, 0},
+    {0x0110, 21, 1}, {0x0111, 25, 0}, {0x0112, 21, 1},
+    {0x0113, 25, 0}, {0x0114, 21, 1}, {0x0115, 25, 0},
+    {0x0116, 21, 1}, {0x0117, 25, 0}, {0x0118, 21, 1},
+    {0x0119, 25, 0}, {0x011A, 21, 1}, {0x011B, 25, 0},
+    {0x011C, 21, 1}, {0x011D, 25, 0}, {0x011E, 21, 1},
+    {0x011F, 25, 0}, {0x0120, 21, 1}, {0x0121, 25, 0},
+    {0x0122, 21, 1}, {0x0123, 25, 0}, {0x0124, 21, 1},
+    {0x0125, 25, 0}, {0x0126, 21, 1}, {0x0127, 25, 0},
+    {0x0128, 21, 1}, {0x0129, 25, 0}, {0x012A, 21, 1},
+    {0x012B, 25, 0}, {0x012C, 21, 1}, {0x012D, 25, 0},
+    {0x012E, 21, 1}, {0x012F, 25, 0}, {0x0130, 21, 0},
+    {0x0131, 25, 0}, {0x0132, 21, 1}, {0x0133, 25, 0},
+    {0x0134, 21, 1}, {0x0135, 25, 0}, {0x0136, 21, 1},
+    {0x0137, 25, 0}, {0x0139, 21, 1}, {0x013A, 25, 0},
+    {0x013B, 21, 1}, {0x013C, 25, 0}, {0x013D, 21, 1},
+    {0x013E, 25, 0}, {0x013F, 21, 1}, {0x0140, 25, 0},
+    {0x0141, 21, 1}, {0x0142, 25, 0}, {0x0143, 21, 1},
+    {0x0144, 25, 0}, {0x0145, 21, 1}, {0x0146, 25, 0},
+    {0x0147, 21, 1}, {0x0148, 25, 0}, {0x014A, 21, 1},
+    {0x014B, 25, 0}, {0x014C, 21, 1}, {0x014D, 25, 0},
+    {0x014E, 21, 1}, {0x014F, 25, 0}, {0x0150, 21, 1},
+    {0x0151, 25, 0}, {0x0152, 21, 1}, {0x0153, 25, 0},
+    {0x0154, 21, 1}, {0x0155, 25, 0}, {0x0156, 21, 1},
+    {0x0157, 25, 0}, {0x0158, 21, 1}, {0x0159, 25, 0},
+    {0x015A, 21, 1}, {0x015B, 25, 0}, {0x015C, 21, 1},
+    {0x015D, 25, 0}, {0x015E, 21, 1}, {0x015F, 25, 0},
+    {0x0160, 21, 1}, {0x0161, 25, 0}, {0x0162, 21, 1},
+    {0x0163, 25, 0}, {0x0164, 21, 1}, {0x0165, 25, 0},
+    {0x0166, 21, 1}, {0x0167, 25, 0}, {0x0168, 21, 1},
+    {0x0169, 25, 0}, {0x016A, 21, 1}, {0x016B, 25, 0},
+    {0x016C, 21, 1}, {0x016D, 25, 0}, {0x016E, 21, 1},
+    {0x016F, 25, 0}, {0x0170, 21, 1}, {0x0171, 25, 0},
+    {0x0172, 21, 1}, {0x0173, 25, 0}, {0x0174, 21, 1},
+    {0x0175, 25, 0}, {0x0176, 21, 1}, {0x0177, 25, 0},
+    {0x0178, 21, -121}, {0x0179, 21, 1}, {0x017A, 25, 0},
+    {0x017B, 21, 1}, {0x017C, 25, 0}, {0x017D, 21, 1},
+    {0x017E, 25, 0}, {0x0181, 21, 210}, {0x0182, 21, 1},
+    {0x0183, 25, 0}, {0x0184, 21, 1}, {0x0185, 25, 0},
+    {0x0186, 21, 206}, {0x0187, 21, 1}, {0x0188, 25, 0},
+    {0x0189, 21, 205}, {0x018B, 21, 1}, {0x018C, 25, 0},
+    {0x018E, 21, 79}, {0x018F, 21, 202}, {0x0190, 21, 203},
+    {0x0191, 21, 1}, {0x0192, 25, 0}, {0x0193, 21, 205},
+    {0x0194, 21, 207}, {0x0195, 25, 0}, {0x0196, 21, 211},
+    {0x0197, 21, 209}, {0x0198, 21, 1}, {0x0199, 25, 0},
+    {0x019C, 21, 211}, {0x019D, 21, 213}, {0x019E, 25, 0},
+    {0x019F, 21, 214}, {0x01A0, 21, 1}, {0x01A1, 25, 0},
+    {0x01A2, 21, 1}, {0x01A3, 25, 0}, {0x01A4, 21, 1},
+    {0x01A5, 25, 0}, {0x01A6, 21, 218}, {0x01A7, 21, 1},
+    {0x01A8, 25, 0}, {0x01A9, 21, 218}, {0x01AA, 25, 0},
+    {0x01AC, 21, 1}, {0x01AD, 25, 0}, {0x01AE, 21, 218},
+    {0x01AF, 21, 1}, {0x01B0, 25, 0}, {0x01B1, 21, 217},
+    {0x01B3, 21, 1}, {0x01B4, 25, 0}, {0x01B5, 21, 1},
+    {0x01B6, 25, 0}, {0x01B7, 21, 219}, {0x01B8, 21, 1},
+    {0x01B9, 25, 0}, {0x01BB, 1, 0}, {0x01BC, 21, 1},
+    {0x01BD, 25, 0}, {0x01C0, 1, 0}, {0x01C4, 21, 2},
+    {0x01C5, 25, 1}, {0x01C6, 25, 0}, {0x01C7, 21, 2},
+    {0x01C8, 25, 1}, {0x01C9, 25, 0}, {0x01CA, 21, 2},
+    {0x01CB, 25, 1}, {0x01CC, 25, 0}, {0x01CD, 21, 1},
+    {0x01CE, 25, 0}, {0x01CF, 21, 1}, {0x01D0, 25, 0},
+    {0x01D1, 21, 1}, {0x01D2, 25, 0}, {0x01D3, 21, 1},
+    {0x01D4, 25, 0}, {0x01D5, 21, 1}, {0x01D6, 25, 0},
+    {0x01D7, 21, 1}, {0x01D8, 25, 0}, {0x01D9, 21, 1},
+    {0x01DA, 25, 0}, {0x01DB, 21, 1}, {0x01DC, 25, 0},
+    {0x01DE, 21, 1}, {0x01DF, 25, 0}, {0x01E0, 21, 1},
+    {0x01E1, 25, 0}, {0x01E2, 21, 1}, {0x01E3, 25, 0},
+    {0x01E4, 21, 1}, {0x01E5, 25, 0}, {0x01E6, 21, 1},
+    {0x01E7, 25, 0}, {0x01E8, 21, 1}, {0x01E9, 25, 0},
+    {0x01EA, 21, 1}, {0x01EB, 25, 0}, {0x01EC, 21, 1},
+    {0x01ED, 25, 0}, {0x01EE, 21, 1}, {0x01EF, 25, 0},
+    {0x01F1, 21, 2}, {0x01F2, 25, 1}, {0x01F3, 25, 0},
+    {0x01F4, 21, 1}, {0x01F5, 25, 0}, {0x01F6, 21, -97},
+    {0x01F7, 21, -56}, {0x01F8, 21, 1}, {0x01F9, 25, 0},
+    {0x01FA, 21, 1}, {0x01FB, 25, 0}, {0x01FC, 21, 1},
+    {0x01FD, 25, 0}, {0x01FE, 21, 1}, {0x01FF, 25, 0},
+    {0x0200, 21, 1}, {0x0201, 25, 0}, {0x0202, 21, 1},
+    {0x0203, 25, 0}, {0x0204, 21, 1}, {0x0205, 25, 0},
+    {0x0206, 21, 1}, {0x0207, 25, 0}, {0x0208, 21, 1},
+    {0x0209, 25, 0}, {0x020A, 21, 1}, {0x020B, 25, 0},
+    {0x020C, 21, 1}, {0x020D, 25, 0}, {0x020E, 21, 1},
+    {0x020F, 25, 0}, {0x0210, 21, 1}, {0x0211, 25, 0},
+    {0x0212, 21, 1}, {0x0213, 25, 0}, {0x0214, 21, 1},
+    {0x0215, 25, 0}, {0x0216, 21, 1}, {0x0217, 25, 0},
+    {0x0218, 21, 1}, {0x0219, 25, 0}, {0x021A, 21, 1},
+    {0x021B, 25, 0}, {0x021C, 21, 1}, {0x021D, 25, 0},
+    {0x021E, 21, 1}, {0x021F, 25, 0}, {0x0220, 21, -130},
+    {0x0221, 25, 0}, {0x0222, 21, 1}, {0x0223, 25, 0},
+    {0x0224, 21, 1}, {0x0225, 25, 0}, {0x0226, 21, 1},
+    {0x0227, 25, 0}, {0x0228, 21, 1}, {0x0229, 25, 0},
+    {0x022A, 21, 1}, {0x022B, 25, 0}, {0x022C, 21, 1},
+    {0x022D, 25, 0}, {0x022E, 21, 1}, {0x022F, 25, 0},
+    {0x0230, 21, 1}, {0x0231, 25, 0}, {0x0232, 21, 1},
+    {0x0233, 25, 0}, {0x023A, 21, 10795}, {0x023B, 21, 1},
+    {0x023C, 25, 0}, {0x023D, 21, -163}, {0x023E, 21, 10792},
+    {0x023F, 25, 0}, {0x0241, 21, 1}, {0x0242, 25, 0},
+    {0x0243, 21, -195}, {0x0244, 21, 69}, {0x0245, 21, 71},
+    {0x0246, 21, 1}, {0x0247, 25, 0}, {0x0248, 21, 1},
+    {0x0249, 25, 0}, {0x024A, 21, 1}, {0x024B, 25, 0},
+    {0x024C, 21, 1}, {0x024D, 25, 0}, {0x024E, 21, 1},
+    {0x024F, 25, 0}, {0x0294, 1, 0}, {0x0295, 25, 0},
+    {0x02B0, 41, 0}, {0x02B9, 33, 0}, {0x02C0, 41, 0},
+    {0x02C2, 32, 0}, {0x02C6, 33, 0}, {0x02D2, 32, 0},
+    {0x02E0, 41, 0}, {0x02E5, 32, 0}, {0x02EC, 33, 0},
+    {0x02ED, 32, 0}, {0x02EE, 33, 0}, {0x02EF, 32, 0},
+    {0x0345, 40, 0}, {0x0346, 32, 0}, {0x0370, 21, 1},
+    {0x0371, 25, 0}, {0x0372, 21, 1}, {0x0373, 25, 0},
+    {0x0374, 33, 0}, {0x0375, 32, 0}, {0x0376, 21, 1},
+    {0x0377, 25, 0}, {0x0378, 0, 0}, {0x037A, 41, 0},
+    {0x037B, 25, 0}, {0x037E, 0, 0}, {0x037F, 21, 116},
+    {0x0380, 0, 0}, {0x0384, 32, 0}, {0x0386, 21, 38},
+    {0x0387, 32, 0}, {0x0388, 21, 37}, {0x038B, 0, 0},
+    {0x038C, 21, 64}, {0x038D, 0, 0}, {0x038E, 21, 63},
+    {0x0390, 25, 0}, {0x0391, 21, 32}, {0x03A2, 0, 0},
+    {0x03A3, 21, 32}, {0x03AC, 25, 0}, {0x03CF, 21, 8},
+    {0x03D0, 25, 0}, {0x03D2, 21, 0}, {0x03D5, 25, 0},
+    {0x03D8, 21, 1}, {0x03D9, 25, 0}, {0x03DA, 21, 1},
+    {0x03DB, 25, 0}, {0x03DC, 21, 1}, {0x03DD, 25, 0},
+    {0x03DE, 21, 1}, {0x03DF, 25, 0}, {0x03E0, 21, 1},
+    {0x03E1, 25, 0}, {0x03E2, 21, 1}, {0x03E3, 25, 0},
+    {0x03E4, 21, 1}, {0x03E5, 25, 0}, {0x03E6, 21, 1},
+    {0x03E7, 25, 0}, {0x03E8, 21, 1}, {0x03E9, 25, 0},
+    {0x03EA, 21, 1}, {0x03EB, 25, 0}, {0x03EC, 21, 1},
+    {0x03ED, 25, 0}, {0x03EE, 21, 1}, {0x03EF, 25, 0},
+    {0x03F4, 21, -60}, {0x03F5, 25, 0}, {0x03F6, 0, 0},
+    {0x03F7, 21, 1}, {0x03F8, 25, 0}, {0x03F9, 21, -7},
+    {0x03FA, 21, 1}, {0x03FB, 25, 0}, {0x03FD, 21, -130},
+    {0x0400, 21, 80}, {0x0410, 21, 32}, {0x0430, 25, 0},
+    {0x0460, 21, 1}, {0x0461, 25, 0}, {0x0462, 21, 1},
+    {0x0463, 25, 0}, {0x0464, 21, 1}, {0x0465, 25, 0},
+    {0x0466, 21, 1}, {0x0467, 25, 0}, {0x0468, 21, 1},
+    {0x0469, 25, 0}, {0x046A, 21, 1}, {0x046B, 25, 0},
+    {0x046C, 21, 1}, {0x046D, 25, 0}, {0x046E, 21, 1},
+    {0x046F, 25, 0}, {0x0470, 21, 1}, {0x0471, 25, 0},
+    {0x0472, 21, 1}, {0x0473, 25, 0}, {0x0474, 21, 1},
+    {0x0475, 25, 0}, {0x0476, 21, 1}, {0x0477, 25, 0},
+    {0x0478, 21, 1}, {0x0479, 25, 0}, {0x047A, 21, 1},
+    {0x047B, 25, 0}, {0x047C, 21, 1}, {0x047D, 25, 0},
+    {0x047E, 21, 1}, {0x047F, 25, 0}, {0x0480, 21, 1},
+    {0x0481, 25, 0}, {0x0482, 0, 0}, {0x0483, 32, 0},
+    {0x048A, 21, 1}, {0x048B, 25, 0}, {0x048C, 21, 1},
+    {0x048D, 25, 0}, {0x048E, 21, 1}, {0x048F, 25, 0},
+    {0x0490, 21, 1}, {0x0491, 25, 0}, {0x0492, 21, 1},
+    {0x0493, 25, 0}, {0x0494, 21, 1}, {0x0495, 25, 0},
+    {0x0496, 21, 1}, {0x0497, 25, 0}, {0x0498, 21, 1},
+    {0x0499, 25, 0}, {0x049A, 21, 1}, {0x049B, 25, 0},
+    {0x049C, 21, 1}, {0x049D, 25, 0}, {0x049E, 21, 1},
+    {0x049F, 25, 0}, {0x04A0, 21, 1}, {0x04A1, 25, 0},
+    {0x04A2, 21, 1}, {0x04A3, 25, 0}, {0x04A4, 21, 1},
+    {0x04A5, 25, 0}, {0x04A6, 21, 1}, {0x04A7, 25, 0},
+    {0x04A8, 21, 1}, {0x04A9, 25, 0}, {0x04AA, 21, 1},
+    {0x04AB, 25, 0}, {0x04AC, 21, 1}, {0x04AD, 25, 0},
+    {0x04AE, 21, 1}, {0x04AF, 25, 0}, {0x04B0, 21, 1},
+    {0x04B1, 25, 0}, {0x04B2, 21, 1}, {0x04B3, 25, 0},
+    {0x04B4, 21, 1}, {0x04B5, 25, 0}, {0x04B6, 21, 1},
+    {0x04B7, 25, 0}, {0x04B8, 21, 1}, {0x04B9, 25, 0},
+    {0x04BA, 21, 1}, {0x04BB, 25, 0}, {0x04BC, 21, 1},
+    {0x04BD, 25, 0}, {0x04BE, 21, 1}, {0x04BF, 25, 0},
+    {0x04C0, 21, 15}, {0x04C1, 21, 1}, {0x04C2, 25, 0},
+    {0x04C3, 21, 1}, {0x04C4, 25, 0}, {0x04C5, 21, 1},
+    {0x04C6, 25, 0}, {0x04C7, 21, 1}, {0x04C8, 25, 0},
+    {0x04C9, 21, 1}, {0x04CA, 25, 0}, {0x04CB, 21, 1},
+    {0x04CC, 25, 0}, {0x04CD, 21, 1}, {0x04CE, 25, 0},
+    {0x04D0, 21, 1}, {0x04D1, 25, 0}, {0x04D2, 21, 1},
+    {0x04D3, 25, 0}, {0x04D4, 21, 1}, {0x04D5, 25, 0},
+    {0x04D6, 21, 1}, {0x04D7, 25, 0}, {0x04D8, 21, 1},
+    {0x04D9, 25, 0}, {0x04DA, 21, 1}, {0x04DB, 25, 0},
+    {0x04DC, 21, 1}, {0x04DD, 25, 0}, {0x04DE, 21, 1},
+    {0x04DF, 25, 0}, {0x04E0, 21, 1}, {0x04E1, 25, 0},
+    {0x04E2, 21, 1}, {0x04E3, 25, 0}, {0x04E4, 21, 1},
+    {0x04E5, 25, 0}, {0x04E6, 21, 1}, {0x04E7, 25, 0},
+    {0x04E8, 21, 1}, {0x04E9, 25, 0}, {0x04EA, 21, 1},
+    {0x04EB, 25, 0}, {0x04EC, 21, 1}, {0x04ED, 25, 0},
+    {0x04EE, 21, 1}, {0x04EF, 25, 0}, {0x04F0, 21, 1},
+    {0x04F1, 25, 0}, {0x04F2, 21, 1}, {0x04F3, 25, 0},
+    {0x04F4, 21, 1}, {0x04F5, 25, 0}, {0x04F6, 21, 1},
+    {0x04F7, 25, 0}, {0x04F8, 21, 1}, {0x04F9, 25, 0},
+    {0x04FA, 21, 1}, {0x04FB, 25, 0}, {0x04FC, 21, 1},
+    {0x04FD, 25, 0}, {0x04FE, 21, 1}, {0x04FF, 25, 0},
+    {0x0500, 21, 1}, {0x0501, 25, 0}, {0x0502, 21, 1},
+    {0x0503, 25, 0}, {0x0504, 21, 1}, {0x0505, 25, 0},
+    {0x0506, 21, 1}, {0x0507, 25, 0}, {0x0508, 21, 1},
+    {0x0509, 25, 0}, {0x050A, 21, 1}, {0x050B, 25, 0},
+    {0x050C, 21, 1}, {0x050D, 25, 0}, {0x050E, 21, 1},
+    {0x050F, 25, 0}, {0x0510, 21, 1}, {0x0511, 25, 0},
+    {0x0512, 21, 1}, {0x0513, 25, 0}, {0x0514, 21, 1},
+    {0x0515, 25, 0}, {0x0516, 21, 1}, {0x0517, 25, 0},
+    {0x0518, 21, 1}, {0x0519, 25, 0}, {0x051A, 21, 1},
+    {0x051B, 25, 0}, {0x051C, 21, 1}, {0x051D, 25, 0},
+    {0x051E, 21, 1}, {0x051F, 25, 0}, {0x0520, 21, 1},
+    {0x0521, 25, 0}, {0x0522, 21, 1}, {0x0523, 25, 0},
+    {0x0524, 21, 1}, {0x0525, 25, 0}, {0x0526, 21, 1},
+    {0x0527, 25, 0}, {0x0528, 21, 1}, {0x0529, 25, 0},
+    {0x052A, 21, 1}, {0x052B, 25, 0}, {0x052C, 21, 1},
+    {0x052D, 25, 0}, {0x052E, 21, 1}, {0x052F, 25, 0},
+    {0x0530, 0, 0}, {0x0531, 21, 48}, {0x0557, 0, 0},
+    {0x0559, 33, 0}, {0x055A, 0, 0}, {0x055F, 32, 0},
+    {0x0560, 25, 0}, {0x0589, 0, 0}, {0x0591, 32, 0},
+    {0x05BE, 0, 0}, {0x05BF, 32, 0}, {0x05C0, 0, 0},
+    {0x05C1, 32, 0}, {0x05C3, 0, 0}, {0x05C4, 32, 0},
+    {0x05C6, 0, 0}, {0x05C7, 32, 0}, {0x05C8, 0, 0},
+    {0x05D0, 1, 0}, {0x05EB, 0, 0}, {0x05EF, 1, 0},
+    {0x05F3, 0, 0}, {0x05F4, 32, 0}, {0x05F5, 0, 0},
+    {0x0600, 32, 0}, {0x0606, 0, 0}, {0x0610, 32, 0},
+    {0x061B, 0, 0}, {0x061C, 32, 0}, {0x061D, 0, 0},
+    {0x0620, 1, 0}, {0x0640, 33, 0}, {0x0641, 1, 0},
+    {0x064B, 32, 0}, {0x0660, 2, 0}, {0x066A, 0, 0},
+    {0x066E, 1, 0}, {0x0670, 32, 0}, {0x0671, 1, 0},
+    {0x06D4, 0, 0}, {0x06D5, 1, 0}, {0x06D6, 32, 0},
+    {0x06DE, 0, 0}, {0x06DF, 32, 0}, {0x06E5, 33, 0},
+    {0x06E7, 32, 0}, {0x06E9, 0, 0}, {0x06EA, 32, 0},
+    {0x06EE, 1, 0}, {0x06F0, 2, 0}, {0x06FA, 1, 0},
+    {0x06FD, 0, 0}, {0x06FF, 1, 0}, {0x0700, 0, 0},
+    {0x070F, 32, 0}, {0x0710, 1, 0}, {0x0711, 32, 0},
+    {0x0712, 1, 0}, {0x0730, 32, 0}, {0x074B, 0, 0},
+    {0x074D, 1, 0}, {0x07A6, 32, 0}, {0x07B1, 1, 0},
+    {0x07B2, 0, 0}, {0x07C0, 2, 0}, {0x07CA, 1, 0},
+    {0x07EB, 32, 0}, {0x07F4, 33, 0}, {0x07F6, 0, 0},
+    {0x07FA, 33, 0}, {0x07FB, 0, 0}, {0x07FD, 32, 0},
+    {0x07FE, 0, 0}, {0x0800, 1, 0}, {0x0816, 32, 0},
+    {0x081A, 33, 0}, {0x081B, 32, 0}, {0x0824, 33, 0},
+    {0x0825, 32, 0}, {0x0828, 33, 0}, {0x0829, 32, 0},
+    {0x082E, 0, 0}, {0x0840, 1, 0}, {0x0859, 32, 0},
+    {0x085C, 0, 0}, {0x0860, 1, 0}, {0x086B, 0, 0},
+    {0x0870, 1, 0}, {0x0888, 32, 0}, {0x0889, 1, 0},
+    {0x088F, 0, 0}, {0x0890, 32, 0}, {0x0892, 0, 0},
+    {0x0898, 32, 0}, {0x08A0, 1, 0}, {0x08C9, 33, 0},
+    {0x08CA, 32, 0}, {0x0903, 0, 0}, {0x0904, 1, 0},
+    {0x093A, 32, 0}, {0x093B, 0, 0}, {0x093C, 32, 0},
+    {0x093D, 1, 0}, {0x093E, 0, 0}, {0x0941, 32, 0},
+    {0x0949, 0, 0}, {0x094D, 32, 0}, {0x094E, 0, 0},
+    {0x0950, 1, 0}, {0x0951, 32, 0}, {0x0958, 1, 0},
+    {0x0962, 32, 0}, {0x0964, 0, 0}, {0x0966, 2, 0},
+    {0x0970, 0, 0}, {0x0971, 33, 0}, {0x0972, 1, 0},
+    {0x0981, 32, 0}, {0x0982, 0, 0}, {0x0985, 1, 0},
+    {0x098D, 0, 0}, {0x098F, 1, 0}, {0x0991, 0, 0},
+    {0x0993, 1, 0}, {0x09A9, 0, 0}, {0x09AA, 1, 0},
+    {0x09B1, 0, 0}, {0x09B2, 1, 0}, {0x09B3, 0, 0},
+    {0x09B6, 1, 0}, {0x09BA, 0, 0}, {0x09BC, 32, 0},
+    {0x09BD, 1, 0}, {0x09BE, 0, 0}, {0x09C1, 32, 0},
+    {0x09C5, 0, 0}, {0x09CD, 32, 0}, {0x09CE, 1, 0},
+    {0x09CF, 0, 0}, {0x09DC, 1, 0}, {0x09DE, 0, 0},
+    {0x09DF, 1, 0}, {0x09E2, 32, 0}, {0x09E4, 0, 0},
+    {0x09E6, 2, 0}, {0x09F0, 1, 0}, {0x09F2, 0, 0},
+    {0x09FC, 1, 0}, {0x09FD, 0, 0}, {0x09FE, 32, 0},
+    {0x09FF, 0, 0}, {0x0A01, 32, 0}, {0x0A03, 0, 0},
+    {0x0A05, 1, 0}, {0x0A0B, 0, 0}, {0x0A0F, 1, 0},
+    {0x0A11, 0, 0}, {0x0A13, 1, 0}, {0x0A29, 0, 0},
+    {0x0A2A, 1, 0}, {0x0A31, 0, 0}, {0x0A32, 1, 0},
+    {0x0A34, 0, 0}, {0x0A35, 1, 0}, {0x0A37, 0, 0},
+    {0x0A38, 1, 0}, {0x0A3A, 0, 0}, {0x0A3C, 32, 0},
+    {0x0A3D, 0, 0}, {0x0A41, 32, 0}, {0x0A43, 0, 0},
+    {0x0A47, 32, 0}, {0x0A49, 0, 0}, {0x0A4B, 32, 0},
+    {0x0A4E, 0, 0}, {0x0A51, 32, 0}, {0x0A52, 0, 0},
+    {0x0A59, 1, 0}, {0x0A5D, 0, 0}, {0x0A5E, 1, 0},
+    {0x0A5F, 0, 0}, {0x0A66, 2, 0}, {0x0A70, 32, 0},
+    {0x0A72, 1, 0}, {0x0A75, 32, 0}, {0x0A76, 0, 0},
+    {0x0A81, 32, 0}, {0x0A83, 0, 0}, {0x0A85, 1, 0},
+    {0x0A8E, 0, 0}, {0x0A8F, 1, 0}, {0x0A92, 0, 0},
+    {0x0A93, 1, 0}, {0x0AA9, 0, 0}, {0x0AAA, 1, 0},
+    {0x0AB1, 0, 0}, {0x0AB2, 1, 0}, {0x0AB4, 0, 0},
+    {0x0AB5, 1, 0}, {0x0ABA, 0, 0}, {0x0ABC, 32, 0},
+    {0x0ABD, 1, 0}, {0x0ABE, 0, 0}, {0x0AC1, 32, 0},
+    {0x0AC6, 0, 0}, {0x0AC7, 32, 0}, {0x0AC9, 0, 0},
+    {0x0ACD, 32, 0}, {0x0ACE, 0, 0}, {0x0AD0, 1, 0},
+    {0x0AD1, 0, 0}, {0x0AE0, 1, 0}, {0x0AE2, 32, 0},
+    {0x0AE4, 0, 0}, {0x0AE6, 2, 0}, {0x0AF0, 0, 0},
+    {0x0AF9, 1, 0}, {0x0AFA, 32, 0}, {0x0B00, 0, 0},
+    {0x0B01, 32, 0}, {0x0B02, 0, 0}, {0x0B05, 1, 0},
+    {0x0B0D, 0, 0}, {0x0B0F, 1, 0}, {0x0B11, 0, 0},
+    {0x0B13, 1, 0}, {0x0B29, 0, 0}, {0x0B2A, 1, 0},
+    {0x0B31, 0, 0}, {0x0B32, 1, 0}, {0x0B34, 0, 0},
+    {0x0B35, 1, 0}, {0x0B3A, 0, 0}, {0x0B3C, 32, 0},
+    {0x0B3D, 1, 0}, {0x0B3E, 0, 0}, {0x0B3F, 32, 0},
+    {0x0B40, 0, 0}, {0x0B41, 32, 0}, {0x0B45, 0, 0},
+    {0x0B4D, 32, 0}, {0x0B4E, 0, 0}, {0x0B55, 32, 0},
+    {0x0B57, 0, 0}, {0x0B5C, 1, 0}, {0x0B5E, 0, 0},
+    {0x0B5F, 1, 0}, {0x0B62, 32, 0}, {0x0B64, 0, 0},
+    {0x0B66, 2, 0}, {0x0B70, 0, 0}, {0x0B71, 1, 0},
+    {0x0B72, 0, 0}, {0x0B82, 32, 0}, {0x0B83, 1, 0},
+    {0x0B84, 0, 0}, {0x0B85, 1, 0}, {0x0B8B, 0, 0},
+    {0x0B8E, 1, 0}, {0x0B91, 0, 0}, {0x0B92, 1, 0},
+    {0x0B96, 0, 0}, {0x0B99, 1, 0}, {0x0B9B, 0, 0},
+    {0x0B9C, 1, 0}, {0x0B9D, 0, 0}, {0x0B9E, 1, 0},
+    {0x0BA0, 0, 0}, {0x0BA3, 1, 0}, {0x0BA5, 0, 0},
+    {0x0BA8, 1, 0}, {0x0BAB, 0, 0}, {0x0BAE, 1, 0},
+    {0x0BBA, 0, 0}, {0x0BC0, 32, 0}, {0x0BC1, 0, 0},
+    {0x0BCD, 32, 0}, {0x0BCE, 0, 0}, {0x0BD0, 1, 0},
+    {0x0BD1, 0, 0}, {0x0BE6, 2, 0}, {0x0BF0, 0, 0},
+    {0x0C00, 32, 0}, {0x0C01, 0, 0}, {0x0C04, 32, 0},
+    {0x0C05, 1, 0}, {0x0C0D, 0, 0}, {0x0C0E, 1, 0},
+    {0x0C11, 0, 0}, {0x0C12, 1, 0}, {0x0C29, 0, 0},
+    {0x0C2A, 1, 0}, {0x0C3A, 0, 0}, {0x0C3C, 32, 0},
+    {0x0C3D, 1, 0}, {0x0C3E, 32, 0}, {0x0C41, 0, 0},
+    {0x0C46, 32, 0}, {0x0C49, 0, 0}, {0x0C4A, 32, 0},
+    {0x0C4E, 0, 0}, {0x0C55, 32, 0}, {0x0C57, 0, 0},
+    {0x0C58, 1, 0}, {0x0C5B, 0, 0}, {0x0C5D, 1, 0},
+    {0x0C5E, 0, 0}, {0x0C60, 1, 0}, {0x0C62, 32, 0},
+    {0x0C64, 0, 0}, {0x0C66, 2, 0}, {0x0C70, 0, 0},
+    {0x0C80, 1, 0}, {0x0C81, 32, 0}, {0x0C82, 0, 0},
+    {0x0C85, 1, 0}, {0x0C8D, 0, 0}, {0x0C8E, 1, 0},
+    {0x0C91, 0, 0}, {0x0C92, 1, 0}, {0x0CA9, 0, 0},
+    {0x0CAA, 1, 0}, {0x0CB4, 0, 0}, {0x0CB5, 1, 0},
+    {0x0CBA, 0, 0}, {0x0CBC, 32, 0}, {0x0CBD, 1, 0},
+    {0x0CBE, 0, 0}, {0x0CBF, 32, 0}, {0x0CC0, 0, 0},
+    {0x0CC6, 32, 0}, {0x0CC7, 0, 0}, {0x0CCC, 32, 0},
+    {0x0CCE, 0, 0}, {0x0CDD, 1, 0}, {0x0CDF, 0, 0},
+    {0x0CE0, 1, 0}, {0x0CE2, 32, 0}, {0x0CE4, 0, 0},
+    {0x0CE6, 2, 0}, {0x0CF0, 0, 0}, {0x0CF1, 1, 0},
+    {0x0CF3, 0, 0}, {0x0D00, 32, 0}, {0x0D02, 0, 0},
+    {0x0D04, 1, 0}, {0x0D0D, 0, 0}, {0x0D0E, 1, 0},
+    {0x0D11, 0, 0}, {0x0D12, 1, 0}, {0x0D3B, 32, 0},
+    {0x0D3D, 1, 0}, {0x0D3E, 0, 0}, {0x0D41, 32, 0},
+    {0x0D45, 0, 0}, {0x0D4D, 32, 0}, {0x0D4E, 1, 0},
+    {0x0D4F, 0, 0}, {0x0D54, 1, 0}, {0x0D57, 0, 0},
+    {0x0D5F, 1, 0}, {0x0D62, 32, 0}, {0x0D64, 0, 0},
+    {0x0D66, 2, 0}, {0x0D70, 0, 0}, {0x0D7A, 1, 0},
+    {0x0D80, 0, 0}, {0x0D81, 32, 0}, {0x0D82, 0, 0},
+    {0x0D85, 1, 0}, {0x0D97, 0, 0}, {0x0D9A, 1, 0},
+    {0x0DB2, 0, 0}, {0x0DB3, 1, 0}, {0x0DBC, 0, 0},
+    {0x0DBD, 1, 0}, {0x0DBE, 0, 0}, {0x0DC0, 1, 0},
+    {0x0DC7, 0, 0}, {0x0DCA, 32, 0}, {0x0DCB, 0, 0},
+    {0x0DD2, 32, 0}, {0x0DD5, 0, 0}, {0x0DD6, 32, 0},
+    {0x0DD7, 0, 0}, {0x0DE6, 2, 0}, {0x0DF0, 0, 0},
+    {0x0E01, 1, 0}, {0x0E31, 32, 0}, {0x0E32, 1, 0},
+    {0x0E34, 32, 0}, {0x0E3B, 0, 0}, {0x0E40, 1, 0},
+    {0x0E46, 33, 0}, {0x0E47, 32, 0}, {0x0E4F, 0, 0},
+    {0x0E50, 2, 0}, {0x0E5A, 0, 0}, {0x0E81, 1, 0},
+    {0x0E83, 0, 0}, {0x0E84, 1, 0}, {0x0E85, 0, 0},
+    {0x0E86, 1, 0}, {0x0E8B, 0, 0}, {0x0E8C, 1, 0},
+    {0x0EA4, 0, 0}, {0x0EA5, 1, 0}, {0x0EA6, 0, 0},
+    {0x0EA7, 1, 0}, {0x0EB1, 32, 0}, {0x0EB2, 1, 0},
+    {0x0EB4, 32, 0}, {0x0EBD, 1, 0}, {0x0EBE, 0, 0},
+    {0x0EC0, 1, 0}, {0x0EC5, 0, 0}, {0x0EC6, 33, 0},
+    {0x0EC7, 0, 0}, {0x0EC8, 32, 0}, {0x0ECF, 0, 0},
+    {0x0ED0, 2, 0}, {0x0EDA, 0, 0}, {0x0EDC, 1, 0},
+    {0x0EE0, 0, 0}, {0x0F00, 1, 0}, {0x0F01, 0, 0},
+    {0x0F18, 32, 0}, {0x0F1A, 0, 0}, {0x0F20, 2, 0},
+    {0x0F2A, 0, 0}, {0x0F35, 32, 0}, {0x0F36, 0, 0},
+    {0x0F37, 32, 0}, {0x0F38, 0, 0}, {0x0F39, 32, 0},
+    {0x0F3A, 0, 0}, {0x0F40, 1, 0}, {0x0F48, 0, 0},
+    {0x0F49, 1, 0}, {0x0F6D, 0, 0}, {0x0F71, 32, 0},
+    {0x0F7F, 0, 0}, {0x0F80, 32, 0}, {0x0F85, 0, 0},
+    {0x0F86, 32, 0}, {0x0F88, 1, 0}, {0x0F8D, 32, 0},
+    {0x0F98, 0, 0}, {0x0F99, 32, 0}, {0x0FBD, 0, 0},
+    {0x0FC6, 32, 0}, {0x0FC7, 0, 0}, {0x1000, 1, 0},
+    {0x102B, 0, 0}, {0x102D, 32, 0}, {0x1031, 0, 0},
+    {0x1032, 32, 0}, {0x1038, 0, 0}, {0x1039, 32, 0},
+    {0x103B, 0, 0}, {0x103D, 32, 0}, {0x103F, 1, 0},
+    {0x1040, 2, 0}, {0x104A, 0, 0}, {0x1050, 1, 0},
+    {0x1056, 0, 0}, {0x1058, 32, 0}, {0x105A, 1, 0},
+    {0x105E, 32, 0}, {0x1061, 1, 0}, {0x1062, 0, 0},
+    {0x1065, 1, 0}, {0x1067, 0, 0}, {0x106E, 1, 0},
+    {0x1071, 32, 0}, {0x1075, 1, 0}, {0x1082, 32, 0},
+    {0x1083, 0, 0}, {0x1085, 32, 0}, {0x1087, 0, 0},
+    {0x108D, 32, 0}, {0x108E, 1, 0}, {0x108F, 0, 0},
+    {0x1090, 2, 0}, {0x109A, 0, 0}, {0x109D, 32, 0},
+    {0x109E, 0, 0}, {0x10A0, 21, 7264}, {0x10C6, 0, 0},
+    {0x10C7, 21, 7264}, {0x10C8, 0, 0}, {0x10CD, 21, 7264},
+    {0x10CE, 0, 0}, {0x10D0, 25, 0}, {0x10FB, 0, 0},
+    {0x10FC, 41, 0}, {0x10FD, 25, 0}, {0x1100, 1, 0},
+    {0x1249, 0, 0}, {0x124A, 1, 0}, {0x124E, 0, 0},
+    {0x1250, 1, 0}, {0x1257, 0, 0}, {0x1258, 1, 0},
+    {0x1259, 0, 0}, {0x125A, 1, 0}, {0x125E, 0, 0},
+    {0x1260, 1, 0}, {0x1289, 0, 0}, {0x128A, 1, 0},
+    {0x128E, 0, 0}, {0x1290, 1, 0}, {0x12B1, 0, 0},
+    {0x12B2, 1, 0}, {0x12B6, 0, 0}, {0x12B8, 1, 0},
+    {0x12BF, 0, 0}, {0x12C0, 1, 0}, {0x12C1, 0, 0},
+    {0x12C2, 1, 0}, {0x12C6, 0, 0}, {0x12C8, 1, 0},
+    {0x12D7, 0, 0}, {0x12D8, 1, 0}, {0x1311, 0, 0},
+    {0x1312, 1, 0}, {0x1316, 0, 0}, {0x1318, 1, 0},
+    {0x135B, 0, 0}, {0x135D, 32, 0}, {0x1360, 0, 0},
+    {0x1369, 2, 0}, {0x1372, 0, 0}, {0x1380, 1, 0},
+    {0x1390, 0, 0}, {0x13A0, 21, 38864}, {0x13F0, 21, 8},
+    {0x13F6, 0, 0}, {0x13F8, 25, 0}, {0x13FE, 0, 0},
+    {0x1401, 1, 0}, {0x166D, 0, 0}, {0x166F, 1, 0},
+    {0x1680, 0, 0}, {0x1681, 1, 0}, {0x169B, 0, 0},
+    {0x16A0, 1, 0}, {0x16EB, 0, 0}, {0x16F1, 1, 0},
+    {0x16F9, 0, 0}, {0x1700, 1, 0}, {0x1712, 32, 0},
+    {0x1715, 0, 0}, {0x171F, 1, 0}, {0x1732, 32, 0},
+    {0x1734, 0, 0}, {0x1740, 1, 0}, {0x1752, 32, 0},
+    {0x1754, 0, 0}, {0x1760, 1, 0}, {0x176D, 0, 0},
+    {0x176E, 1, 0}, {0x1771, 0, 0}, {0x1772, 32, 0},
+    {0x1774, 0, 0}, {0x1780, 1, 0}, {0x17B4, 32, 0},
+    {0x17B6, 0, 0}, {0x17B7, 32, 0}, {0x17BE, 0, 0},
+    {0x17C6, 32, 0}, {0x17C7, 0, 0}, {0x17C9, 32, 0},
+    {0x17D4, 0, 0}, {0x17D7, 33, 0}, {0x17D8, 0, 0},
+    {0x17DC, 1, 0}, {0x17DD, 32, 0}, {0x17DE, 0, 0},
+    {0x17E0, 2, 0}, {0x17EA, 0, 0}, {0x180B, 32, 0},
+    {0x1810, 2, 0}, {0x181A, 0, 0}, {0x1820, 1, 0},
+    {0x1843, 33, 0}, {0x1844, 1, 0}, {0x1879, 0, 0},
+    {0x1880, 1, 0}, {0x1885, 32, 0}, {0x1887, 1, 0},
+    {0x18A9, 32, 0}, {0x18AA, 1, 0}, {0x18AB, 0, 0},
+    {0x18B0, 1, 0}, {0x18F6, 0, 0}, {0x1900, 1, 0},
+    {0x191F, 0, 0}, {0x1920, 32, 0}, {0x1923, 0, 0},
+    {0x1927, 32, 0}, {0x1929, 0, 0}, {0x1932, 32, 0},
+    {0x1933, 0, 0}, {0x1939, 32, 0}, {0x193C, 0, 0},
+    {0x1946, 2, 0}, {0x1950, 1, 0}, {0x196E, 0, 0},
+    {0x1970, 1, 0}, {0x1975, 0, 0}, {0x1980, 1, 0},
+    {0x19AC, 0, 0}, {0x19B0, 1, 0}, {0x19CA, 0, 0},
+    {0x19D0, 2, 0}, {0x19DB, 0, 0}, {0x1A00, 1, 0},
+    {0x1A17, 32, 0}, {0x1A19, 0, 0}, {0x1A1B, 32, 0},
+    {0x1A1C, 0, 0}, {0x1A20, 1, 0}, {0x1A55, 0, 0},
+    {0x1A56, 32, 0}, {0x1A57, 0, 0}, {0x1A58, 32, 0},
+    {0x1A5F, 0, 0}, {0x1A60, 32, 0}, {0x1A61, 0, 0},
+    {0x1A62, 32, 0}, {0x1A63, 0, 0}, {0x1A65, 32, 0},
+    {0x1A6D, 0, 0}, {0x1A73, 32, 0}, {0x1A7D, 0, 0},
+    {0x1A7F, 32, 0}, {0x1A80, 2, 0}, {0x1A8A, 0, 0},
+    {0x1A90, 2, 0}, {0x1A9A, 0, 0}, {0x1AA7, 33, 0},
+    {0x1AA8, 0, 0}, {0x1AB0, 32, 0}, {0x1ACF, 0, 0},
+    {0x1B00, 32, 0}, {0x1B04, 0, 0}, {0x1B05, 1, 0},
+    {0x1B34, 32, 0}, {0x1B35, 0, 0}, {0x1B36, 32, 0},
+    {0x1B3B, 0, 0}, {0x1B3C, 32, 0}, {0x1B3D, 0, 0},
+    {0x1B42, 32, 0}, {0x1B43, 0, 0}, {0x1B45, 1, 0},
+    {0x1B4D, 0, 0}, {0x1B50, 2, 0}, {0x1B5A, 0, 0},
+    {0x1B6B, 32, 0}, {0x1B74, 0, 0}, {0x1B80, 32, 0},
+    {0x1B82, 0, 0}, {0x1B83, 1, 0}, {0x1BA1, 0, 0},
+    {0x1BA2, 32, 0}, {0x1BA6, 0, 0}, {0x1BA8, 32, 0},
+    {0x1BAA, 0, 0}, {0x1BAB, 32, 0}, {0x1BAE, 1, 0},
+    {0x1BB0, 2, 0}, {0x1BBA, 1, 0}, {0x1BE6, 32, 0},
+    {0x1BE7, 0, 0}, {0x1BE8, 32, 0}, {0x1BEA, 0, 0},
+    {0x1BED, 32, 0}, {0x1BEE, 0, 0}, {0x1BEF, 32, 0},
+    {0x1BF2, 0, 0}, {0x1C00, 1, 0}, {0x1C24, 0, 0},
+    {0x1C2C, 32, 0}, {0x1C34, 0, 0}, {0x1C36, 32, 0},
+    {0x1C38, 0, 0}, {0x1C40, 2, 0}, {0x1C4A, 0, 0},
+    {0x1C4D, 1, 0}, {0x1C50, 2, 0}, {0x1C5A, 1, 0},
+    {0x1C78, 33, 0}, {0x1C7E, 0, 0}, {0x1C80, 25, 0},
+    {0x1C89, 0, 0}, {0x1C90, 21, -3008}, {0x1CBB, 0, 0},
+    {0x1CBD, 21, -3008}, {0x1CC0, 0, 0}, {0x1CD0, 32, 0},
+    {0x1CD3, 0, 0}, {0x1CD4, 32, 0}, {0x1CE1, 0, 0},
+    {0x1CE2, 32, 0}, {0x1CE9, 1, 0}, {0x1CED, 32, 0},
+    {0x1CEE, 1, 0}, {0x1CF4, 32, 0}, {0x1CF5, 1, 0},
+    {0x1CF7, 0, 0}, {0x1CF8, 32, 0}, {0x1CFA, 1, 0},
+    {0x1CFB, 0, 0}, {0x1D00, 25, 0}, {0x1D2C, 41, 0},
+    {0x1D6B, 25, 0}, {0x1D78, 41, 0}, {0x1D79, 25, 0},
+    {0x1D9B, 41, 0}, {0x1DC0, 32, 0}, {0x1E00, 21, 1},
+    {0x1E01, 25, 0}, {0x1E02, 21, 1}, {0x1E03, 25, 0},
+    {0x1E04, 21, 1}, {0x1E05, 25, 0}, {0x1E06, 21, 1},
+    {0x1E07, 25, 0}, {0x1E08, 21, 1}, {0x1E09, 25, 0},
+    {0x1E0A, 21, 1}, {0x1E0B, 25, 0}, {0x1E0C, 21, 1},
+    {0x1E0D, 25, 0}, {0x1E0E, 21, 1}, {0x1E0F, 25, 0},
+    {0x1E10, 21, 1}, {0x1E11, 25, 0}, {0x1E12, 21, 1},
+    {0x1E13, 25, 0}, {0x1E14, 21, 1}, {0x1E15, 25, 0},
+    {0x1E16, 21, 1}, {0x1E17, 25, 0}, {0x1E18, 21, 1},
+    {0x1E19, 25, 0}, {0x1E1A, 21, 1}, {0x1E1B, 25, 0},
+    {0x1E1C, 21, 1}, {0x1E1D, 25, 0}, {0x1E1E, 21, 1},
+    {0x1E1F, 25, 0}, {0x1E20, 21, 1}, {0x1E21, 25, 0},
+    {0x1E22, 21, 1}, {0x1E23, 25, 0}, {0x1E24, 21, 1},
+    {0x1E25, 25, 0}, {0x1E26, 21, 1}, {0x1E27, 25, 0},
+    {0x1E28, 21, 1}, {0x1E29, 25, 0}, {0x1E2A, 21, 1},
+    {0x1E2B, 25, 0}, {0x1E2C, 21, 1}, {0x1E2D, 25, 0},
+    {0x1E2E, 21, 1}, {0x1E2F, 25, 0}, {0x1E30, 21, 1},
+    {0x1E31, 25, 0}, {0x1E32, 21, 1}, {0x1E33, 25, 0},
+    {0x1E34, 21, 1}, {0x1E35, 25, 0}, {0x1E36, 21, 1},
+    {0x1E37, 25, 0}, {0x1E38, 21, 1}, {0x1E39, 25, 0},
+    {0x1E3A, 21, 1}, {0x1E3B, 25, 0}, {0x1E3C, 21, 1},
+    {0x1E3D, 25, 0}, {0x1E3E, 21, 1}, {0x1E3F, 25, 0},
+    {0x1E40, 21, 1}, {0x1E41, 25, 0}, {0x1E42, 21, 1},
+    {0x1E43, 25, 0}, {0x1E44, 21, 1}, {0x1E45, 25, 0},
+    {0x1E46, 21, 1}, {0x1E47, 25, 0}, {0x1E48, 21, 1},
+    {0x1E49, 25, 0}, {0x1E4A, 21, 1}, {0x1E4B, 25, 0},
+    {0x1E4C, 21, 1}, {0x1E4D, 25, 0}, {0x1E4E, 21, 1},
+    {0x1E4F, 25, 0}, {0x1E50, 21, 1}, {0x1E51, 25, 0},
+    {0x1E52, 21, 1}, {0x1E53, 25, 0}, {0x1E54, 21, 1},
+    {0x1E55, 25, 0}, {0x1E56, 21, 1}, {0x1E57, 25, 0},
+    {0x1E58, 21, 1}, {0x1E59, 25, 0}, {0x1E5A, 21, 1},
+    {0x1E5B, 25, 0}, {0x1E5C, 21, 1}, {0x1E5D, 25, 0},
+    {0x1E5E, 21, 1}, {0x1E5F, 25, 0}, {0x1E60, 21, 1},
+    {0x1E61, 25, 0}, {0x1E62, 21, 1}, {0x1E63, 25, 0},
+    {0x1E64, 21, 1}, {0x1E65, 25, 0}, {0x1E66, 21, 1},
+    {0x1E67, 25, 0}, {0x1E68, 21, 1}, {0x1E69, 25, 0},
+    {0x1E6A, 21, 1}, {0x1E6B, 25, 0}, {0x1E6C, 21, 1},
+    {0x1E6D, 25, 0}, {0x1E6E, 21, 1}, {0x1E6F, 25, 0},
+    {0x1E70, 21, 1}, {0x1E71, 25, 0}, {0x1E72, 21, 1},
+    {0x1E73, 25, 0}, {0x1E74, 21, 1}, {0x1E75, 25, 0},
+    {0x1E76, 21, 1}, {0x1E77, 25, 0}, {0x1E78, 21, 1},
+    {0x1E79, 25, 0}, {0x1E7A, 21, 1}, {0x1E7B, 25, 0},
+    {0x1E7C, 21, 1}, {0x1E7D, 25, 0}, {0x1E7E, 21, 1},
+    {0x1E7F, 25, 0}, {0x1E80, 21, 1}, {0x1E81, 25, 0},
+    {0x1E82, 21, 1}, {0x1E83, 25, 0}, {0x1E84, 21, 1},
+    {0x1E85, 25, 0}, {0x1E86, 21, 1}, {0x1E87, 25, 0},
+    {0x1E88, 21, 1}, {0x1E89, 25, 0}, {0x1E8A, 21, 1},
+    {0x1E8B, 25, 0}, {0x1E8C, 21, 1}, {0x1E8D, 25, 0},
+    {0x1E8E, 21, 1}, {0x1E8F, 25, 0}, {0x1E90, 21, 1},
+    {0x1E91, 25, 0}, {0x1E92, 21, 1}, {0x1E93, 25, 0},
+    {0x1E94, 21, 1}, {0x1E95, 25, 0}, {0x1E9E, 21, -7615},
+    {0x1E9F, 25, 0}, {0x1EA0, 21, 1}, {0x1EA1, 25, 0},
+    {0x1EA2, 21, 1}, {0x1EA3, 25, 0}, {0x1EA4, 21, 1},
+    {0x1EA5, 25, 0}, {0x1EA6, 21, 1}, {0x1EA7, 25, 0},
+    {0x1EA8, 21, 1}, {0x1EA9, 25, 0}, {0x1EAA, 21, 1},
+    {0x1EAB, 25, 0}, {0x1EAC, 21, 1}, {0x1EAD, 25, 0},
+    {0x1EAE, 21, 1}, {0x1EAF, 25, 0}, {0x1EB0, 21, 1},
+    {0x1EB1, 25, 0}, {0x1EB2, 21, 1}, {0x1EB3, 25, 0},
+    {0x1EB4, 21, 1}, {0x1EB5, 25, 0}, {0x1EB6, 21, 1},
+    {0x1EB7, 25, 0}, {0x1EB8, 21, 1}, {0x1EB9, 25, 0},
+    {0x1EBA, 21, 1}, {0x1EBB, 25, 0}, {0x1EBC, 21, 1},
+    {0x1EBD, 25, 0}, {0x1EBE, 21, 1}, {0x1EBF, 25, 0},
+    {0x1EC0, 21, 1}, {0x1EC1, 25, 0}, {0x1EC2, 21, 1},
+    {0x1EC3, 25, 0}, {0x1EC4, 21, 1}, {0x1EC5, 25, 0},
+    {0x1EC6, 21, 1}, {0x1EC7, 25, 0}, {0x1EC8, 21, 1},
+    {0x1EC9, 25, 0}, {0x1ECA, 21, 1}, {0x1ECB, 25, 0},
+    {0x1ECC, 21, 1}, {0x1ECD, 25, 0}, {0x1ECE, 21, 1},
+    {0x1ECF, 25, 0}, {0x1ED0, 21, 1}, {0x1ED1, 25, 0},
+    {0x1ED2, 21, 1}, {0x1ED3, 25, 0}, {0x1ED4, 21, 1},
+    {0x1ED5, 25, 0}, {0x1ED6, 21, 1}, {0x1ED7, 25, 0},
+    {0x1ED8, 21, 1}, {0x1ED9, 25, 0}, {0x1EDA, 21, 1},
+    {0x1EDB, 25, 0}, {0x1EDC, 21, 1}, {0x1EDD, 25, 0},
+    {0x1EDE, 21, 1}, {0x1EDF, 25, 0}, {0x1EE0, 21, 1},
+    {0x1EE1, 25, 0}, {0x1EE2, 21, 1}, {0x1EE3, 25, 0},
+    {0x1EE4, 21, 1}, {0x1EE5, 25, 0}, {0x1EE6, 21, 1},
+    {0x1EE7, 25, 0}, {0x1EE8, 21, 1}, {0x1EE9, 25, 0},
+    {0x1EEA, 21, 1}, {0x1EEB, 25, 0}, {0x1EEC, 21, 1},
+    {0x1EED, 25, 0}, {0x1EEE, 21, 1}, {0x1EEF, 25, 0},
+    {0x1EF0, 21, 1}, {0x1EF1, 25, 0}, {0x1EF2, 21, 1},
+    {0x1EF3, 25, 0}, {0x1EF4, 21, 1}, {0x1EF5, 25, 0},
+    {0x1EF6, 21, 1}, {0x1EF7, 25, 0}, {0x1EF8, 21, 1},
+    {0x1EF9, 25, 0}, {0x1EFA, 21, 1}, {0x1EFB, 25, 0},
+    {0x1EFC, 21, 1}, {0x1EFD, 25, 0}, {0x1EFE, 21, 1},
+    {0x1EFF, 25, 0}, {0x1F08, 21, -8}, {0x1F10, 25, 0},
+    {0x1F16, 0, 0}, {0x1F18, 21, -8}, {0x1F1E, 0, 0},
+    {0x1F20, 25, 0}, {0x1F28, 21, -8}, {0x1F30, 25, 0},
+    {0x1F38, 21, -8}, {0x1F40, 25, 0}, {0x1F46, 0, 0},
+    {0x1F48, 21, -8}, {0x1F4E, 0, 0}, {0x1F50, 25, 0},
+    {0x1F58, 0, 0}, {0x1F59, 21, -8}, {0x1F5A, 0, 0},
+    {0x1F5B, 21, -8}, {0x1F5C, 0, 0}, {0x1F5D, 21, -8},
+    {0x1F5E, 0, 0}, {0x1F5F, 21, -8}, {0x1F60, 25, 0},
+    {0x1F68, 21, -8}, {0x1F70, 25, 0}, {0x1F7E, 0, 0},
+    {0x1F80, 25, 0}, {0x1F88, 25, -8}, {0x1F90, 25, 0},
+    {0x1F98, 25, -8}, {0x1FA0, 25, 0}, {0x1FA8, 25, -8},
+    {0x1FB0, 25, 0}, {0x1FB5, 0, 0}, {0x1FB6, 25, 0},
+    {0x1FB8, 21, -8}, {0x1FBA, 21, -74}, {0x1FBC, 25, -9},
+    {0x1FBD, 32, 0}, {0x1FBE, 25, 0}, {0x1FBF, 32, 0},
+    {0x1FC2, 25, 0}, {0x1FC5, 0, 0}, {0x1FC6, 25, 0},
+    {0x1FC8, 21, -86}, {0x1FCC, 25, -9}, {0x1FCD, 32, 0},
+    {0x1FD0, 25, 0}, {0x1FD4, 0, 0}, {0x1FD6, 25, 0},
+    {0x1FD8, 21, -8}, {0x1FDA, 21, -100}, {0x1FDC, 0, 0},
+    {0x1FDD, 32, 0}, {0x1FE0, 25, 0}, {0x1FE8, 21, -8},
+    {0x1FEA, 21, -112}, {0x1FEC, 21, -7}, {0x1FED, 32, 0},
+    {0x1FF0, 0, 0}, {0x1FF2, 25, 0}, {0x1FF5, 0, 0},
+    {0x1FF6, 25, 0}, {0x1FF8, 21, -128}, {0x1FFA, 21, -126},
+    {0x1FFC, 25, -9}, {0x1FFD, 32, 0}, {0x1FFF, 0, 0},
+    {0x200B, 32, 0}, {0x2010, 0, 0}, {0x2018, 32, 0},
+    {0x201A, 0, 0}, {0x2024, 32, 0}, {0x2025, 0, 0},
+    {0x2027, 32, 0}, {0x2028, 0, 0}, {0x202A, 32, 0},
+    {0x202F, 0, 0}, {0x2060, 32, 0}, {0x2065, 0, 0},
+    {0x2066, 32, 0}, {0x2070, 2, 0}, {0x2071, 41, 0},
+    {0x2072, 0, 0}, {0x2074, 2, 0}, {0x207A, 0, 0},
+    {0x207F, 41, 0}, {0x2080, 2, 0}, {0x208A, 0, 0},
+    {0x2090, 41, 0}, {0x209D, 0, 0}, {0x20D0, 32, 0},
+    {0x20F1, 0, 0}, {0x2102, 21, 0}, {0x2103, 0, 0},
+    {0x2107, 21, 0}, {0x2108, 0, 0}, {0x210A, 25, 0},
+    {0x210B, 21, 0}, {0x210E, 25, 0}, {0x2110, 21, 0},
+    {0x2113, 25, 0}, {0x2114, 0, 0}, {0x2115, 21, 0},
+    {0x2116, 0, 0}, {0x2119, 21, 0}, {0x211E, 0, 0},
+    {0x2124, 21, 0}, {0x2125, 0, 0}, {0x2126, 21, -7517},
+    {0x2127, 0, 0}, {0x2128, 21, 0}, {0x2129, 0, 0},
+    {0x212A, 21, -8383}, {0x212B, 21, -8262}, {0x212C, 21, 0},
+    {0x212E, 0, 0}, {0x212F, 25, 0}, {0x2130, 21, 0},
+    {0x2132, 21, 28}, {0x2133, 21, 0}, {0x2134, 25, 0},
+    {0x2135, 1, 0}, {0x2139, 25, 0}, {0x213A, 0, 0},
+    {0x213C, 25, 0}, {0x213E, 21, 0}, {0x2140, 0, 0},
+    {0x2145, 21, 0}, {0x2146, 25, 0}, {0x214A, 0, 0},
+    {0x214E, 25, 0}, {0x214F, 0, 0}, {0x2160, 20, 16},
+    {0x2170, 24, 0}, {0x2180, 0, 0}, {0x2183, 21, 1},
+    {0x2184, 25, 0}, {0x2185, 0, 0}, {0x2460, 2, 0},
+    {0x2469, 0, 0}, {0x2474, 2, 0}, {0x247D, 0, 0},
+    {0x2488, 2, 0}, {0x2491, 0, 0}, {0x24B6, 20, 26},
+    {0x24D0, 24, 0}, {0x24EA, 2, 0}, {0x24EB, 0, 0},
+    {0x24F5, 2, 0}, {0x24FE, 0, 0}, {0x24FF, 2, 0},
+    {0x2500, 0, 0}, {0x2776, 2, 0}, {0x277F, 0, 0},
+    {0x2780, 2, 0}, {0x2789, 0, 0}, {0x278A, 2, 0},
+    {0x2793, 0, 0}, {0x2C00, 21, 48}, {0x2C30, 25, 0},
+    {0x2C60, 21, 1}, {0x2C61, 25, 0}, {0x2C62, 21, -10743},
+    {0x2C63, 21, -3814}, {0x2C64, 21, -10727}, {0x2C65, 25, 0},
+    {0x2C67, 21, 1}, {0x2C68, 25, 0}, {0x2C69, 21, 1},
+    {0x2C6A, 25, 0}, {0x2C6B, 21, 1}, {0x2C6C, 25, 0},
+    {0x2C6D, 21, -10780}, {0x2C6E, 21, -10749}, {0x2C6F, 21, -10783},
+    {0x2C70, 21, -10782}, {0x2C71, 25, 0}, {0x2C72, 21, 1},
+    {0x2C73, 25, 0}, {0x2C75, 21, 1}, {0x2C76, 25, 0},
+    {0x2C7C, 41, 0}, {0x2C7E, 21, -10815}, {0x2C80, 21, 1},
+    {0x2C81, 25, 0}, {0x2C82, 21, 1}, {0x2C83, 25, 0},
+    {0x2C84, 21, 1}, {0x2C85, 25, 0}, {0x2C86, 21, 1},
+    {0x2C87, 25, 0}, {0x2C88, 21, 1}, {0x2C89, 25, 0},
+    {0x2C8A, 21, 1}, {0x2C8B, 25, 0}, {0x2C8C, 21, 1},
+    {0x2C8D, 25, 0}, {0x2C8E, 21, 1}, {0x2C8F, 25, 0},
+    {0x2C90, 21, 1}, {0x2C91, 25, 0}, {0x2C92, 21, 1},
+    {0x2C93, 25, 0}, {0x2C94, 21, 1}, {0x2C95, 25, 0},
+    {0x2C96, 21, 1}, {0x2C97, 25, 0}, {0x2C98, 21, 1},
+    {0x2C99, 25, 0}, {0x2C9A, 21, 1}, {0x2C9B, 25, 0},
+    {0x2C9C, 21, 1}, {0x2C9D, 25, 0}, {0x2C9E, 21, 1},
+    {0x2C9F, 25, 0}, {0x2CA0, 21, 1}, {0x2CA1, 25, 0},
+    {0x2CA2, 21, 1}, {0x2CA3, 25, 0}, {0x2CA4, 21, 1},
+    {0x2CA5, 25, 0}, {0x2CA6, 21, 1}, {0x2CA7, 25, 0},
+    {0x2CA8, 21, 1}, {0x2CA9, 25, 0}, {0x2CAA, 21, 1},
+    {0x2CAB, 25, 0}, {0x2CAC, 21, 1}, {0x2CAD, 25, 0},
+    {0x2CAE, 21, 1}, {0x2CAF, 25, 0}, {0x2CB0, 21, 1},
+    {0x2CB1, 25, 0}, {0x2CB2, 21, 1}, {0x2CB3, 25, 0},
+    {0x2CB4, 21, 1}, {0x2CB5, 25, 0}, {0x2CB6, 21, 1},
+    {0x2CB7, 25, 0}, {0x2CB8, 21, 1}, {0x2CB9, 25, 0},
+    {0x2CBA, 21, 1}, {0x2CBB, 25, 0}, {0x2CBC, 21, 1},
+    {0x2CBD, 25, 0}, {0x2CBE, 21, 1}, {0x2CBF, 25, 0},
+    {0x2CC0, 21, 1}, {0x2CC1, 25, 0}, {0x2CC2, 21, 1},
+    {0x2CC3, 25, 0}, {0x2CC4, 21, 1}, {0x2CC5, 25, 0},
+    {0x2CC6, 21, 1}, {0x2CC7, 25, 0}, {0x2CC8, 21, 1},
+    {0x2CC9, 25, 0}, {0x2CCA, 21, 1}, {0x2CCB, 25, 0},
+    {0x2CCC, 21, 1}, {0x2CCD, 25, 0}, {0x2CCE, 21, 1},
+    {0x2CCF, 25, 0}, {0x2CD0, 21, 1}, {0x2CD1, 25, 0},
+    {0x2CD2, 21, 1}, {0x2CD3, 25, 0}, {0x2CD4, 21, 1},
+    {0x2CD5, 25, 0}, {0x2CD6, 21, 1}, {0x2CD7, 25, 0},
+    {0x2CD8, 21, 1}, {0x2CD9, 25, 0}, {0x2CDA, 21, 1},
+    {0x2CDB, 25, 0}, {0x2CDC, 21, 1}, {0x2CDD, 25, 0},
+    {0x2CDE, 21, 1}, {0x2CDF, 25, 0}, {0x2CE0, 21, 1},
+    {0x2CE1, 25, 0}, {0x2CE2, 21, 1}, {0x2CE3, 25, 0},
+    {0x2CE5, 0, 0}, {0x2CEB, 21, 1}, {0x2CEC, 25, 0},
+    {0x2CED, 21, 1}, {0x2CEE, 25, 0}, {0x2CEF, 32, 0},
+    {0x2CF2, 21, 1}, {0x2CF3, 25, 0}, {0x2CF4, 0, 0},
+    {0x2D00, 25, 0}, {0x2D26, 0, 0}, {0x2D27, 25, 0},
+    {0x2D28, 0, 0}, {0x2D2D, 25, 0}, {0x2D2E, 0, 0},
+    {0x2D30, 1, 0}, {0x2D68, 0, 0}, {0x2D6F, 33, 0},
+    {0x2D70, 0, 0}, {0x2D7F, 32, 0}, {0x2D80, 1, 0},
+    {0x2D97, 0, 0}, {0x2DA0, 1, 0}, {0x2DA7, 0, 0},
+    {0x2DA8, 1, 0}, {0x2DAF, 0, 0}, {0x2DB0, 1, 0},
+    {0x2DB7, 0, 0}, {0x2DB8, 1, 0}, {0x2DBF, 0, 0},
+    {0x2DC0, 1, 0}, {0x2DC7, 0, 0}, {0x2DC8, 1, 0},
+    {0x2DCF, 0, 0}, {0x2DD0, 1, 0}, {0x2DD7, 0, 0},
+    {0x2DD8, 1, 0}, {0x2DDF, 0, 0}, {0x2DE0, 32, 0},
+    {0x2E00, 0, 0}, {0x2E2F, 33, 0}, {0x2E30, 0, 0},
+    {0x3005, 33, 0}, {0x3006, 1, 0}, {0x3007, 0, 0},
+    {0x302A, 32, 0}, {0x302E, 0, 0}, {0x3031, 33, 0},
+    {0x3036, 0, 0}, {0x303B, 33, 0}, {0x303C, 1, 0},
+    {0x303D, 0, 0}, {0x3041, 1, 0}, {0x3097, 0, 0},
+    {0x3099, 32, 0}, {0x309D, 33, 0}, {0x309F, 1, 0},
+    {0x30A0, 0, 0}, {0x30A1, 1, 0}, {0x30FB, 0, 0},
+    {0x30FC, 33, 0}, {0x30FF, 1, 0}, {0x3100, 0, 0},
+    {0x3105, 1, 0}, {0x3130, 0, 0}, {0x3131, 1, 0},
+    {0x318F, 0, 0}, {0x31A0, 1, 0}, {0x31C0, 0, 0},
+    {0x31F0, 1, 0}, {0x3200, 0, 0}, {0x3400, 1, 0},
+    {0x4DC0, 0, 0}, {0x4E00, 1, 0}, {0xA015, 33, 0},
+    {0xA016, 1, 0}, {0xA48D, 0, 0}, {0xA4D0, 1, 0},
+    {0xA4F8, 33, 0}, {0xA4FE, 0, 0}, {0xA500, 1, 0},
+    {0xA60C, 33, 0}, {0xA60D, 0, 0}, {0xA610, 1, 0},
+    {0xA620, 2, 0}, {0xA62A, 1, 0}, {0xA62C, 0, 0},
+    {0xA640, 21, 1}, {0xA641, 25, 0}, {0xA642, 21, 1},
+    {0xA643, 25, 0}, {0xA644, 21, 1}, {0xA645, 25, 0},
+    {0xA646, 21, 1}, {0xA647, 25, 0}, {0xA648, 21, 1},
+    {0xA649, 25, 0}, {0xA64A, 21, 1}, {0xA64B, 25, 0},
+    {0xA64C, 21, 1}, {0xA64D, 25, 0}, {0xA64E, 21, 1},
+    {0xA64F, 25, 0}, {0xA650, 21, 1}, {0xA651, 25, 0},
+    {0xA652, 21, 1}, {0xA653, 25, 0}, {0xA654, 21, 1},
+    {0xA655, 25, 0}, {0xA656, 21, 1}, {0xA657, 25, 0},
+    {0xA658, 21, 1}, {0xA659, 25, 0}, {0xA65A, 21, 1},
+    {0xA65B, 25, 0}, {0xA65C, 21, 1}, {0xA65D, 25, 0},
+    {0xA65E, 21, 1}, {0xA65F, 25, 0}, {0xA660, 21, 1},
+    {0xA661, 25, 0}, {0xA662, 21, 1}, {0xA663, 25, 0},
+    {0xA664, 21, 1}, {0xA665, 25, 0}, {0xA666, 21, 1},
+    {0xA667, 25, 0}, {0xA668, 21, 1}, {0xA669, 25, 0},
+    {0xA66A, 21, 1}, {0xA66B, 25, 0}, {0xA66C, 21, 1},
+    {0xA66D, 25, 0}, {0xA66E, 1, 0}, {0xA66F, 32, 0},
+    {0xA673, 0, 0}, {0xA674, 32, 0}, {0xA67E, 0, 0},
+    {0xA67F, 33, 0}, {0xA680, 21, 1}, {0xA681, 25, 0},
+    {0xA682, 21, 1}, {0xA683, 25, 0}, {0xA684, 21, 1},
+    {0xA685, 25, 0}, {0xA686, 21, 1}, {0xA687, 25, 0},
+    {0xA688, 21, 1}, {0xA689, 25, 0}, {0xA68A, 21, 1},
+    {0xA68B, 25, 0}, {0xA68C, 21, 1}, {0xA68D, 25, 0},
+    {0xA68E, 21, 1}, {0xA68F, 25, 0}, {0xA690, 21, 1},
+    {0xA691, 25, 0}, {0xA692, 21, 1}, {0xA693, 25, 0},
+    {0xA694, 21, 1}, {0xA695, 25, 0}, {0xA696, 21, 1},
+    {0xA697, 25, 0}, {0xA698, 21, 1}, {0xA699, 25, 0},
+    {0xA69A, 21, 1}, {0xA69B, 25, 0}, {0xA69C, 41, 0},
+    {0xA69E, 32, 0}, {0xA6A0, 1, 0}, {0xA6E6, 0, 0},
+    {0xA6F0, 32, 0}, {0xA6F2, 0, 0}, {0xA700, 32, 0},
+    {0xA717, 33, 0}, {0xA720, 32, 0}, {0xA722, 21, 1},
+    {0xA723, 25, 0}, {0xA724, 21, 1}, {0xA725, 25, 0},
+    {0xA726, 21, 1}, {0xA727, 25, 0}, {0xA728, 21, 1},
+    {0xA729, 25, 0}, {0xA72A, 21, 1}, {0xA72B, 25, 0},
+    {0xA72C, 21, 1}, {0xA72D, 25, 0}, {0xA72E, 21, 1},
+    {0xA72F, 25, 0}, {0xA732, 21, 1}, {0xA733, 25, 0},
+    {0xA734, 21, 1}, {0xA735, 25, 0}, {0xA736, 21, 1},
+    {0xA737, 25, 0}, {0xA738, 21, 1}, {0xA739, 25, 0},
+    {0xA73A, 21, 1}, {0xA73B, 25, 0}, {0xA73C, 21, 1},
+    {0xA73D, 25, 0}, {0xA73E, 21, 1}, {0xA73F, 25, 0},
+    {0xA740, 21, 1}, {0xA741, 25, 0}, {0xA742, 21, 1},
+    {0xA743, 25, 0}, {0xA744, 21, 1}, {0xA745, 25, 0},
+    {0xA746, 21, 1}, {0xA747, 25, 0}, {0xA748, 21, 1},
+    {0xA749, 25, 0}, {0xA74A, 21, 1}, {0xA74B, 25, 0},
+    {0xA74C, 21, 1}, {0xA74D, 25, 0}, {0xA74E, 21, 1},
+    {0xA74F, 25, 0}, {0xA750, 21, 1}, {0xA751, 25, 0},
+    {0xA752, 21, 1}, {0xA753, 25, 0}, {0xA754, 21, 1},
+    {0xA755, 25, 0}, {0xA756, 21, 1}, {0xA757, 25, 0},
+    {0xA758, 21, 1}, {0xA759, 25, 0}, {0xA75A, 21, 1},
+    {0xA75B, 25, 0}, {0xA75C, 21, 1}, {0xA75D, 25, 0},
+    {0xA75E, 21, 1}, {0xA75F, 25, 0}, {0xA760, 21, 1},
+    {0xA761, 25, 0}, {0xA762, 21, 1}, {0xA763, 25, 0},
+    {0xA764, 21, 1}, {0xA765, 25, 0}, {0xA766, 21, 1},
+    {0xA767, 25, 0}, {0xA768, 21, 1}, {0xA769, 25, 0},
+    {0xA76A, 21, 1}, {0xA76B, 25, 0}, {0xA76C, 21, 1},
+    {0xA76D, 25, 0}, {0xA76E, 21, 1}, {0xA76F, 25, 0},
+    {0xA770, 41, 0}, {0xA771, 25, 0}, {0xA779, 21, 1},
+    {0xA77A, 25, 0}, {0xA77B, 21, 1}, {0xA77C, 25, 0},
+    {0xA77D, 21, -35332}, {0xA77E, 21, 1}, {0xA77F, 25, 0},
+    {0xA780, 21, 1}, {0xA781, 25, 0}, {0xA782, 21, 1},
+    {0xA783, 25, 0}, {0xA784, 21, 1}, {0xA785, 25, 0},
+    {0xA786, 21, 1}, {0xA787, 25, 0}, {0xA788, 33, 0},
+    {0xA789, 32, 0}, {0xA78B, 21, 1}, {0xA78C, 25, 0},
+    {0xA78D, 21, -42280}, {0xA78E, 25, 0}, {0xA78F, 1, 0},
+    {0xA790, 21, 1}, {0xA791, 25, 0}, {0xA792, 21, 1},
+    {0xA793, 25, 0}, {0xA796, 21, 1}, {0xA797, 25, 0},
+    {0xA798, 21, 1}, {0xA799, 25, 0}, {0xA79A, 21, 1},
+    {0xA79B, 25, 0}, {0xA79C, 21, 1}, {0xA79D, 25, 0},
+    {0xA79E, 21, 1}, {0xA79F, 25, 0}, {0xA7A0, 21, 1},
+    {0xA7A1, 25, 0}, {0xA7A2, 21, 1}, {0xA7A3, 25, 0},
+    {0xA7A4, 21, 1}, {0xA7A5, 25, 0}, {0xA7A6, 21, 1},
+    {0xA7A7, 25, 0}, {0xA7A8, 21, 1}, {0xA7A9, 25, 0},
+    {0xA7AA, 21, -42308}, {0xA7AB, 21, -42319}, {0xA7AC, 21, -42315},
+    {0xA7AD, 21, -42305}, {0xA7AE, 21, -42308}, {0xA7AF, 25, 0},
+    {0xA7B0, 21, -42258}, {0xA7B1, 21, -42282}, {0xA7B2, 21, -42261},
+    {0xA7B3, 21, 928}, {0xA7B4, 21, 1}, {0xA7B5, 25, 0},
+    {0xA7B6, 21, 1}, {0xA7B7, 25, 0}, {0xA7B8, 21, 1},
+    {0xA7B9, 25, 0}, {0xA7BA, 21, 1}, {0xA7BB, 25, 0},
+    {0xA7BC, 21, 1}, {0xA7BD, 25, 0}, {0xA7BE, 21, 1},
+    {0xA7BF, 25, 0}, {0xA7C0, 21, 1}, {0xA7C1, 25, 0},
+    {0xA7C2, 21, 1}, {0xA7C3, 25, 0}, {0xA7C4, 21, -48},
+    {0xA7C5, 21, -42307}, {0xA7C6, 21, -35384}, {0xA7C7, 21, 1},
+    {0xA7C8, 25, 0}, {0xA7C9, 21, 1}, {0xA7CA, 25, 0},
+    {0xA7CB, 0, 0}, {0xA7D0, 21, 1}, {0xA7D1, 25, 0},
+    {0xA7D2, 0, 0}, {0xA7D3, 25, 0}, {0xA7D4, 0, 0},
+    {0xA7D5, 25, 0}, {0xA7D6, 21, 1}, {0xA7D7, 25, 0},
+    {0xA7D8, 21, 1}, {0xA7D9, 25, 0}, {0xA7DA, 0, 0},
+    {0xA7F2, 41, 0}, {0xA7F5, 21, 1}, {0xA7F6, 25, 0},
+    {0xA7F7, 1, 0}, {0xA7F8, 41, 0}, {0xA7FA, 25, 0},
+    {0xA7FB, 1, 0}, {0xA802, 32, 0}, {0xA803, 1, 0},
+    {0xA806, 32, 0}, {0xA807, 1, 0}, {0xA80B, 32, 0},
+    {0xA80C, 1, 0}, {0xA823, 0, 0}, {0xA825, 32, 0},
+    {0xA827, 0, 0}, {0xA82C, 32, 0}, {0xA82D, 0, 0},
+    {0xA840, 1, 0}, {0xA874, 0, 0}, {0xA882, 1, 0},
+    {0xA8B4, 0, 0}, {0xA8C4, 32, 0}, {0xA8C6, 0, 0},
+    {0xA8D0, 2, 0}, {0xA8DA, 0, 0}, {0xA8E0, 32, 0},
+    {0xA8F2, 1, 0}, {0xA8F8, 0, 0}, {0xA8FB, 1, 0},
+    {0xA8FC, 0, 0}, {0xA8FD, 1, 0}, {0xA8FF, 32, 0},
+    {0xA900, 2, 0}, {0xA90A, 1, 0}, {0xA926, 32, 0},
+    {0xA92E, 0, 0}, {0xA930, 1, 0}, {0xA947, 32, 0},
+    {0xA952, 0, 0}, {0xA960, 1, 0}, {0xA97D, 0, 0},
+    {0xA980, 32, 0}, {0xA983, 0, 0}, {0xA984, 1, 0},
+    {0xA9B3, 32, 0}, {0xA9B4, 0, 0}, {0xA9B6, 32, 0},
+    {0xA9BA, 0, 0}, {0xA9BC, 32, 0}, {0xA9BE, 0, 0},
+    {0xA9CF, 33, 0}, {0xA9D0, 2, 0}, {0xA9DA, 0, 0},
+    {0xA9E0, 1, 0}, {0xA9E5, 32, 0}, {0xA9E6, 33, 0},
+    {0xA9E7, 1, 0}, {0xA9F0, 2, 0}, {0xA9FA, 1, 0},
+    {0xA9FF, 0, 0}, {0xAA00, 1, 0}, {0xAA29, 32, 0},
+    {0xAA2F, 0, 0}, {0xAA31, 32, 0}, {0xAA33, 0, 0},
+    {0xAA35, 32, 0}, {0xAA37, 0, 0}, {0xAA40, 1, 0},
+    {0xAA43, 32, 0}, {0xAA44, 1, 0}, {0xAA4C, 32, 0},
+    {0xAA4D, 0, 0}, {0xAA50, 2, 0}, {0xAA5A, 0, 0},
+    {0xAA60, 1, 0}, {0xAA70, 33, 0}, {0xAA71, 1, 0},
+    {0xAA77, 0, 0}, {0xAA7A, 1, 0}, {0xAA7B, 0, 0},
+    {0xAA7C, 32, 0}, {0xAA7D, 0, 0}, {0xAA7E, 1, 0},
+    {0xAAB0, 32, 0}, {0xAAB1, 1, 0}, {0xAAB2, 32, 0},
+    {0xAAB5, 1, 0}, {0xAAB7, 32, 0}, {0xAAB9, 1, 0},
+    {0xAABE, 32, 0}, {0xAAC0, 1, 0}, {0xAAC1, 32, 0},
+    {0xAAC2, 1, 0}, {0xAAC3, 0, 0}, {0xAADB, 1, 0},
+    {0xAADD, 33, 0}, {0xAADE, 0, 0}, {0xAAE0, 1, 0},
+    {0xAAEB, 0, 0}, {0xAAEC, 32, 0}, {0xAAEE, 0, 0},
+    {0xAAF2, 1, 0}, {0xAAF3, 33, 0}, {0xAAF5, 0, 0},
+    {0xAAF6, 32, 0}, {0xAAF7, 0, 0}, {0xAB01, 1, 0},
+    {0xAB07, 0, 0}, {0xAB09, 1, 0}, {0xAB0F, 0, 0},
+    {0xAB11, 1, 0}, {0xAB17, 0, 0}, {0xAB20, 1, 0},
+    {0xAB27, 0, 0}, {0xAB28, 1, 0}, {0xAB2F, 0, 0},
+    {0xAB30, 25, 0}, {0xAB5B, 32, 0}, {0xAB5C, 41, 0},
+    {0xAB60, 25, 0}, {0xAB69, 41, 0}, {0xAB6A, 32, 0},
+    {0xAB6C, 0, 0}, {0xAB70, 25, 0}, {0xABC0, 1, 0},
+    {0xABE3, 0, 0}, {0xABE5, 32, 0}, {0xABE6, 0, 0},
+    {0xABE8, 32, 0}, {0xABE9, 0, 0}, {0xABED, 32, 0},
+    {0xABEE, 0, 0}, {0xABF0, 2, 0}, {0xABFA, 0, 0},
+    {0xAC00, 1, 0}, {0xD7A4, 0, 0}, {0xD7B0, 1, 0},
+    {0xD7C7, 0, 0}, {0xD7CB, 1, 0}, {0xD7FC, 0, 0},
+    {0xF900, 1, 0}, {0xFA6E, 0, 0}, {0xFA70, 1, 0},
+    {0xFADA, 0, 0}, {0xFB00, 25, 0}, {0xFB07, 0, 0},
+    {0xFB13, 25, 0}, {0xFB18, 0, 0}, {0xFB1D, 1, 0},
+    {0xFB1E, 32, 0}, {0xFB1F, 1, 0}, {0xFB29, 0, 0},
+    {0xFB2A, 1, 0}, {0xFB37, 0, 0}, {0xFB38, 1, 0},
+    {0xFB3D, 0, 0}, {0xFB3E, 1, 0}, {0xFB3F, 0, 0},
+    {0xFB40, 1, 0}, {0xFB42, 0, 0}, {0xFB43, 1, 0},
+    {0xFB45, 0, 0}, {0xFB46, 1, 0}, {0xFBB2, 32, 0},
+    {0xFBC3, 0, 0}, {0xFBD3, 1, 0}, {0xFD3E, 0, 0},
+    {0xFD50, 1, 0}, {0xFD90, 0, 0}, {0xFD92, 1, 0},
+    {0xFDC8, 0, 0}, {0xFDF0, 1, 0}, {0xFDFC, 0, 0},
+    {0xFE00, 32, 0}, {0xFE10, 0, 0}, {0xFE13, 32, 0},
+    {0xFE14, 0, 0}, {0xFE20, 32, 0}, {0xFE30, 0, 0},
+    {0xFE52, 32, 0}, {0xFE53, 0, 0}, {0xFE55, 32, 0},
+    {0xFE56, 0, 0}, {0xFE70, 1, 0}, {0xFE75, 0, 0},
+    {0xFE76, 1, 0}, {0xFEFD, 0, 0}, {0xFEFF, 32, 0},
+    {0xFF00, 0, 0}, {0xFF07, 32, 0}, {0xFF08, 0, 0},
+    {0xFF0E, 32, 0}, {0xFF0F, 0, 0}, {0xFF10, 2, 0},
+    {0xFF1A, 32, 0}, {0xFF1B, 0, 0}, {0xFF21, 21, 32},
+    {0xFF3B, 0, 0}, {0xFF3E, 32, 0}, {0xFF3F, 0, 0},
+    {0xFF40, 32, 0}, {0xFF41, 25, 0}, {0xFF5B, 0, 0},
+    {0xFF66, 1, 0}, {0xFF70, 33, 0}, {0xFF71, 1, 0},
+    {0xFF9E, 33, 0}, {0xFFA0, 1, 0}, {0xFFBF, 0, 0},
+    {0xFFC2, 1, 0}, {0xFFC8, 0, 0}, {0xFFCA, 1, 0},
+    {0xFFD0, 0, 0}, {0xFFD2, 1, 0}, {0xFFD8, 0, 0},
+    {0xFFDA, 1, 0}, {0xFFDD, 0, 0}, {0xFFE3, 32, 0},
+    {0xFFE4, 0, 0}, {0xFFF9, 32, 0}, {0xFFFC, 0, 0},
+    {0x10000, 1, 0}, {0x1000C, 0, 0}, {0x1000D, 1, 0},
+    {0x10027, 0, 0}, {0x10028, 1, 0}, {0x1003B, 0, 0},
+    {0x1003C, 1, 0}, {0x1003E, 0, 0}, {0x1003F, 1, 0},
+    {0x1004E, 0, 0}, {0x10050, 1, 0}, {0x1005E, 0, 0},
+    {0x10080, 1, 0}, {0x100FB, 0, 0}, {0x101FD, 32, 0},
+    {0x101FE, 0, 0}, {0x10280, 1, 0}, {0x1029D, 0, 0},
+    {0x102A0, 1, 0}, {0x102D1, 0, 0}, {0x102E0, 32, 0},
+    {0x102E1, 0, 0}, {0x10300, 1, 0}, {0x10320, 0, 0},
+    {0x1032D, 1, 0}, {0x10341, 0, 0}, {0x10342, 1, 0},
+    {0x1034A, 0, 0}, {0x10350, 1, 0}, {0x10376, 32, 0},
+    {0x1037B, 0, 0}, {0x10380, 1, 0}, {0x1039E, 0, 0},
+    {0x103A0, 1, 0}, {0x103C4, 0, 0}, {0x103C8, 1, 0},
+    {0x103D0, 0, 0}, {0x10400, 21, 40}, {0x10428, 25, 0},
+    {0x10450, 1, 0}, {0x1049E, 0, 0}, {0x104A0, 2, 0},
+    {0x104AA, 0, 0}, {0x104B0, 21, 40}, {0x104D4, 0, 0},
+    {0x104D8, 25, 0}, {0x104FC, 0, 0}, {0x10500, 1, 0},
+    {0x10528, 0, 0}, {0x10530, 1, 0}, {0x10564, 0, 0},
+    {0x10570, 21, 39}, {0x1057B, 0, 0}, {0x1057C, 21, 39},
+    {0x1058B, 0, 0}, {0x1058C, 21, 39}, {0x10593, 0, 0},
+    {0x10594, 21, 39}, {0x10596, 0, 0}, {0x10597, 25, 0},
+    {0x105A2, 0, 0}, {0x105A3, 25, 0}, {0x105B2, 0, 0},
+    {0x105B3, 25, 0}, {0x105BA, 0, 0}, {0x105BB, 25, 0},
+    {0x105BD, 0, 0}, {0x10600, 1, 0}, {0x10737, 0, 0},
+    {0x10740, 1, 0}, {0x10756, 0, 0}, {0x10760, 1, 0},
+    {0x10768, 0, 0}, {0x10780, 41, 0}, {0x10781, 33, 0},
+    {0x10783, 41, 0}, {0x10786, 0, 0}, {0x10787, 41, 0},
+    {0x107B1, 0, 0}, {0x107B2, 41, 0}, {0x107BB, 0, 0},
+    {0x10800, 1, 0}, {0x10806, 0, 0}, {0x10808, 1, 0},
+    {0x10809, 0, 0}, {0x1080A, 1, 0}, {0x10836, 0, 0},
+    {0x10837, 1, 0}, {0x10839, 0, 0}, {0x1083C, 1, 0},
+    {0x1083D, 0, 0}, {0x1083F, 1, 0}, {0x10856, 0, 0},
+    {0x10860, 1, 0}, {0x10877, 0, 0}, {0x10880, 1, 0},
+    {0x1089F, 0, 0}, {0x108E0, 1, 0}, {0x108F3, 0, 0},
+    {0x108F4, 1, 0}, {0x108F6, 0, 0}, {0x10900, 1, 0},
+    {0x10916, 0, 0}, {0x10920, 1, 0}, {0x1093A, 0, 0},
+    {0x10980, 1, 0}, {0x109B8, 0, 0}, {0x109BE, 1, 0},
+    {0x109C0, 0, 0}, {0x10A00, 1, 0}, {0x10A01, 32, 0},
+    {0x10A04, 0, 0}, {0x10A05, 32, 0}, {0x10A07, 0, 0},
+    {0x10A0C, 32, 0}, {0x10A10, 1, 0}, {0x10A14, 0, 0},
+    {0x10A15, 1, 0}, {0x10A18, 0, 0}, {0x10A19, 1, 0},
+    {0x10A36, 0, 0}, {0x10A38, 32, 0}, {0x10A3B, 0, 0},
+    {0x10A3F, 32, 0}, {0x10A40, 2, 0}, {0x10A44, 0, 0},
+    {0x10A60, 1, 0}, {0x10A7D, 0, 0}, {0x10A80, 1, 0},
+    {0x10A9D, 0, 0}, {0x10AC0, 1, 0}, {0x10AC8, 0, 0},
+    {0x10AC9, 1, 0}, {0x10AE5, 32, 0}, {0x10AE7, 0, 0},
+    {0x10B00, 1, 0}, {0x10B36, 0, 0}, {0x10B40, 1, 0},
+    {0x10B56, 0, 0}, {0x10B60, 1, 0}, {0x10B73, 0, 0},
+    {0x10B80, 1, 0}, {0x10B92, 0, 0}, {0x10C00, 1, 0},
+    {0x10C49, 0, 0}, {0x10C80, 21, 64}, {0x10CB3, 0, 0},
+    {0x10CC0, 25, 0}, {0x10CF3, 0, 0}, {0x10D00, 1, 0},
+    {0x10D24, 32, 0}, {0x10D28, 0, 0}, {0x10D30, 2, 0},
+    {0x10D3A, 0, 0}, {0x10E60, 2, 0}, {0x10E69, 0, 0},
+    {0x10E80, 1, 0}, {0x10EAA, 0, 0}, {0x10EAB, 32, 0},
+    {0x10EAD, 0, 0}, {0x10EB0, 1, 0}, {0x10EB2, 0, 0},
+    {0x10EFD, 32, 0}, {0x10F00, 1, 0}, {0x10F1D, 0, 0},
+    {0x10F27, 1, 0}, {0x10F28, 0, 0}, {0x10F30, 1, 0},
+    {0x10F46, 32, 0}, {0x10F51, 0, 0}, {0x10F70, 1, 0},
+    {0x10F82, 32, 0}, {0x10F86, 0, 0}, {0x10FB0, 1, 0},
+    {0x10FC5, 0, 0}, {0x10FE0, 1, 0}, {0x10FF7, 0, 0},
+    {0x11001, 32, 0}, {0x11002, 0, 0}, {0x11003, 1, 0},
+    {0x11038, 32, 0}, {0x11047, 0, 0}, {0x11052, 2, 0},
+    {0x1105B, 0, 0}, {0x11066, 2, 0}, {0x11070, 32, 0},
+    {0x11071, 1, 0}, {0x11073, 32, 0}, {0x11075, 1, 0},
+    {0x11076, 0, 0}, {0x1107F, 32, 0}, {0x11082, 0, 0},
+    {0x11083, 1, 0}, {0x110B0, 0, 0}, {0x110B3, 32, 0},
+    {0x110B7, 0, 0}, {0x110B9, 32, 0}, {0x110BB, 0, 0},
+    {0x110BD, 32, 0}, {0x110BE, 0, 0}, {0x110C2, 32, 0},
+    {0x110C3, 0, 0}, {0x110CD, 32, 0}, {0x110CE, 0, 0},
+    {0x110D0, 1, 0}, {0x110E9, 0, 0}, {0x110F0, 2, 0},
+    {0x110FA, 0, 0}, {0x11100, 32, 0}, {0x11103, 1, 0},
+    {0x11127, 32, 0}, {0x1112C, 0, 0}, {0x1112D, 32, 0},
+    {0x11135, 0, 0}, {0x11136, 2, 0}, {0x11140, 0, 0},
+    {0x11144, 1, 0}, {0x11145, 0, 0}, {0x11147, 1, 0},
+    {0x11148, 0, 0}, {0x11150, 1, 0}, {0x11173, 32, 0},
+    {0x11174, 0, 0}, {0x11176, 1, 0}, {0x11177, 0, 0},
+    {0x11180, 32, 0}, {0x11182, 0, 0}, {0x11183, 1, 0},
+    {0x111B3, 0, 0}, {0x111B6, 32, 0}, {0x111BF, 0, 0},
+    {0x111C1, 1, 0}, {0x111C5, 0, 0}, {0x111C9, 32, 0},
+    {0x111CD, 0, 0}, {0x111CF, 32, 0}, {0x111D0, 2, 0},
+    {0x111DA, 1, 0}, {0x111DB, 0, 0}, {0x111DC, 1, 0},
+    {0x111DD, 0, 0}, {0x11200, 1, 0}, {0x11212, 0, 0},
+    {0x11213, 1, 0}, {0x1122C, 0, 0}, {0x1122F, 32, 0},
+    {0x11232, 0, 0}, {0x11234, 32, 0}, {0x11235, 0, 0},
+    {0x11236, 32, 0}, {0x11238, 0, 0}, {0x1123E, 32, 0},
+    {0x1123F, 1, 0}, {0x11241, 32, 0}, {0x11242, 0, 0},
+    {0x11280, 1, 0}, {0x11287, 0, 0}, {0x11288, 1, 0},
+    {0x11289, 0, 0}, {0x1128A, 1, 0}, {0x1128E, 0, 0},
+    {0x1128F, 1, 0}, {0x1129E, 0, 0}, {0x1129F, 1, 0},
+    {0x112A9, 0, 0}, {0x112B0, 1, 0}, {0x112DF, 32, 0},
+    {0x112E0, 0, 0}, {0x112E3, 32, 0}, {0x112EB, 0, 0},
+    {0x112F0, 2, 0}, {0x112FA, 0, 0}, {0x11300, 32, 0},
+    {0x11302, 0, 0}, {0x11305, 1, 0}, {0x1130D, 0, 0},
+    {0x1130F, 1, 0}, {0x11311, 0, 0}, {0x11313, 1, 0},
+    {0x11329, 0, 0}, {0x1132A, 1, 0}, {0x11331, 0, 0},
+    {0x11332, 1, 0}, {0x11334, 0, 0}, {0x11335, 1, 0},
+    {0x1133A, 0, 0}, {0x1133B, 32, 0}, {0x1133D, 1, 0},
+    {0x1133E, 0, 0}, {0x11340, 32, 0}, {0x11341, 0, 0},
+    {0x11350, 1, 0}, {0x11351, 0, 0}, {0x1135D, 1, 0},
+    {0x11362, 0, 0}, {0x11366, 32, 0}, {0x1136D, 0, 0},
+    {0x11370, 32, 0}, {0x11375, 0, 0}, {0x11400, 1, 0},
+    {0x11435, 0, 0}, {0x11438, 32, 0}, {0x11440, 0, 0},
+    {0x11442, 32, 0}, {0x11445, 0, 0}, {0x11446, 32, 0},
+    {0x11447, 1, 0}, {0x1144B, 0, 0}, {0x11450, 2, 0},
+    {0x1145A, 0, 0}, {0x1145E, 32, 0}, {0x1145F, 1, 0},
+    {0x11462, 0, 0}, {0x11480, 1, 0}, {0x114B0, 0, 0},
+    {0x114B3, 32, 0}, {0x114B9, 0, 0}, {0x114BA, 32, 0},
+    {0x114BB, 0, 0}, {0x114BF, 32, 0}, {0x114C1, 0, 0},
+    {0x114C2, 32, 0}, {0x114C4, 1, 0}, {0x114C6, 0, 0},
+    {0x114C7, 1, 0}, {0x114C8, 0, 0}, {0x114D0, 2, 0},
+    {0x114DA, 0, 0}, {0x11580, 1, 0}, {0x115AF, 0, 0},
+    {0x115B2, 32, 0}, {0x115B6, 0, 0}, {0x115BC, 32, 0},
+    {0x115BE, 0, 0}, {0x115BF, 32, 0}, {0x115C1, 0, 0},
+    {0x115D8, 1, 0}, {0x115DC, 32, 0}, {0x115DE, 0, 0},
+    {0x11600, 1, 0}, {0x11630, 0, 0}, {0x11633, 32, 0},
+    {0x1163B, 0, 0}, {0x1163D, 32, 0}, {0x1163E, 0, 0},
+    {0x1163F, 32, 0}, {0x11641, 0, 0}, {0x11644, 1, 0},
+    {0x11645, 0, 0}, {0x11650, 2, 0}, {0x1165A, 0, 0},
+    {0x11680, 1, 0}, {0x116AB, 32, 0}, {0x116AC, 0, 0},
+    {0x116AD, 32, 0}, {0x116AE, 0, 0}, {0x116B0, 32, 0},
+    {0x116B6, 0, 0}, {0x116B7, 32, 0}, {0x116B8, 1, 0},
+    {0x116B9, 0, 0}, {0x116C0, 2, 0}, {0x116CA, 0, 0},
+    {0x11700, 1, 0}, {0x1171B, 0, 0}, {0x1171D, 32, 0},
+    {0x11720, 0, 0}, {0x11722, 32, 0}, {0x11726, 0, 0},
+    {0x11727, 32, 0}, {0x1172C, 0, 0}, {0x11730, 2, 0},
+    {0x1173A, 0, 0}, {0x11740, 1, 0}, {0x11747, 0, 0},
+    {0x11800, 1, 0}, {0x1182C, 0, 0}, {0x1182F, 32, 0},
+    {0x11838, 0, 0}, {0x11839, 32, 0}, {0x1183B, 0, 0},
+    {0x118A0, 21, 32}, {0x118C0, 25, 0}, {0x118E0, 2, 0},
+    {0x118EA, 0, 0}, {0x118FF, 1, 0}, {0x11907, 0, 0},
+    {0x11909, 1, 0}, {0x1190A, 0, 0}, {0x1190C, 1, 0},
+    {0x11914, 0, 0}, {0x11915, 1, 0}, {0x11917, 0, 0},
+    {0x11918, 1, 0}, {0x11930, 0, 0}, {0x1193B, 32, 0},
+    {0x1193D, 0, 0}, {0x1193E, 32, 0}, {0x1193F, 1, 0},
+    {0x11940, 0, 0}, {0x11941, 1, 0}, {0x11942, 0, 0},
+    {0x11943, 32, 0}, {0x11944, 0, 0}, {0x11950, 2, 0},
+    {0x1195A, 0, 0}, {0x119A0, 1, 0}, {0x119A8, 0, 0},
+    {0x119AA, 1, 0}, {0x119D1, 0, 0}, {0x119D4, 32, 0},
+    {0x119D8, 0, 0}, {0x119DA, 32, 0}, {0x119DC, 0, 0},
+    {0x119E0, 32, 0}, {0x119E1, 1, 0}, {0x119E2, 0, 0},
+    {0x119E3, 1, 0}, {0x119E4, 0, 0}, {0x11A00, 1, 0},
+    {0x11A01, 32, 0}, {0x11A0B, 1, 0}, {0x11A33, 32, 0},
+    {0x11A39, 0, 0}, {0x11A3A, 1, 0}, {0x11A3B, 32, 0},
+    {0x11A3F, 0, 0}, {0x11A47, 32, 0}, {0x11A48, 0, 0},
+    {0x11A50, 1, 0}, {0x11A51, 32, 0}, {0x11A57, 0, 0},
+    {0x11A59, 32, 0}, {0x11A5C, 1, 0}, {0x11A8A, 32, 0},
+    {0x11A97, 0, 0}, {0x11A98, 32, 0}, {0x11A9A, 0, 0},
+    {0x11A9D, 1, 0}, {0x11A9E, 0, 0}, {0x11AB0, 1, 0},
+    {0x11AF9, 0, 0}, {0x11C00, 1, 0}, {0x11C09, 0, 0},
+    {0x11C0A, 1, 0}, {0x11C2F, 0, 0}, {0x11C30, 32, 0},
+    {0x11C37, 0, 0}, {0x11C38, 32, 0}, {0x11C3E, 0, 0},
+    {0x11C3F, 32, 0}, {0x11C40, 1, 0}, {0x11C41, 0, 0},
+    {0x11C50, 2, 0}, {0x11C5A, 0, 0}, {0x11C72, 1, 0},
+    {0x11C90, 0, 0}, {0x11C92, 32, 0}, {0x11CA8, 0, 0},
+    {0x11CAA, 32, 0}, {0x11CB1, 0, 0}, {0x11CB2, 32, 0},
+    {0x11CB4, 0, 0}, {0x11CB5, 32, 0}, {0x11CB7, 0, 0},
+    {0x11D00, 1, 0}, {0x11D07, 0, 0}, {0x11D08, 1, 0},
+    {0x11D0A, 0, 0}, {0x11D0B, 1, 0}, {0x11D31, 32, 0},
+    {0x11D37, 0, 0}, {0x11D3A, 32, 0}, {0x11D3B, 0, 0},
+    {0x11D3C, 32, 0}, {0x11D3E, 0, 0}, {0x11D3F, 32, 0},
+    {0x11D46, 1, 0}, {0x11D47, 32, 0}, {0x11D48, 0, 0},
+    {0x11D50, 2, 0}, {0x11D5A, 0, 0}, {0x11D60, 1, 0},
+    {0x11D66, 0, 0}, {0x11D67, 1, 0}, {0x11D69, 0, 0},
+    {0x11D6A, 1, 0}, {0x11D8A, 0, 0}, {0x11D90, 32, 0},
+    {0x11D92, 0, 0}, {0x11D95, 32, 0}, {0x11D96, 0, 0},
+    {0x11D97, 32, 0}, {0x11D98, 1, 0}, {0x11D99, 0, 0},
+    {0x11DA0, 2, 0}, {0x11DAA, 0, 0}, {0x11EE0, 1, 0},
+    {0x11EF3, 32, 0}, {0x11EF5, 0, 0}, {0x11F00, 32, 0},
+    {0x11F02, 1, 0}, {0x11F03, 0, 0}, {0x11F04, 1, 0},
+    {0x11F11, 0, 0}, {0x11F12, 1, 0}, {0x11F34, 0, 0},
+    {0x11F36, 32, 0}, {0x11F3B, 0, 0}, {0x11F40, 32, 0},
+    {0x11F41, 0, 0}, {0x11F42, 32, 0}, {0x11F43, 0, 0},
+    {0x11F50, 2, 0}, {0x11F5A, 0, 0}, {0x11FB0, 1, 0},
+    {0x11FB1, 0, 0}, {0x12000, 1, 0}, {0x1239A, 0, 0},
+    {0x12480, 1, 0}, {0x12544, 0, 0}, {0x12F90, 1, 0},
+    {0x12FF1, 0, 0}, {0x13000, 1, 0}, {0x13430, 32, 0},
+    {0x13441, 1, 0}, {0x13447, 32, 0}, {0x13456, 0, 0},
+    {0x14400, 1, 0}, {0x14647, 0, 0}, {0x16800, 1, 0},
+    {0x16A39, 0, 0}, {0x16A40, 1, 0}, {0x16A5F, 0, 0},
+    {0x16A60, 2, 0}, {0x16A6A, 0, 0}, {0x16A70, 1, 0},
+    {0x16ABF, 0, 0}, {0x16AC0, 2, 0}, {0x16ACA, 0, 0},
+    {0x16AD0, 1, 0}, {0x16AEE, 0, 0}, {0x16AF0, 32, 0},
+    {0x16AF5, 0, 0}, {0x16B00, 1, 0}, {0x16B30, 32, 0},
+    {0x16B37, 0, 0}, {0x16B40, 33, 0}, {0x16B44, 0, 0},
+    {0x16B50, 2, 0}, {0x16B5A, 0, 0}, {0x16B63, 1, 0},
+    {0x16B78, 0, 0}, {0x16B7D, 1, 0}, {0x16B90, 0, 0},
+    {0x16E40, 21, 32}, {0x16E60, 25, 0}, {0x16E80, 0, 0},
+    {0x16F00, 1, 0}, {0x16F4B, 0, 0}, {0x16F4F, 32, 0},
+    {0x16F50, 1, 0}, {0x16F51, 0, 0}, {0x16F8F, 32, 0},
+    {0x16F93, 33, 0}, {0x16FA0, 0, 0}, {0x16FE0, 33, 0},
+    {0x16FE2, 0, 0}, {0x16FE3, 33, 0}, {0x16FE4, 32, 0},
+    {0x16FE5, 0, 0}, {0x17000, 1, 0}, {0x187F8, 0, 0},
+    {0x18800, 1, 0}, {0x18CD6, 0, 0}, {0x18D00, 1, 0},
+    {0x18D09, 0, 0}, {0x1AFF0, 33, 0}, {0x1AFF4, 0, 0},
+    {0x1AFF5, 33, 0}, {0x1AFFC, 0, 0}, {0x1AFFD, 33, 0},
+    {0x1AFFF, 0, 0}, {0x1B000, 1, 0}, {0x1B123, 0, 0},
+    {0x1B132, 1, 0}, {0x1B133, 0, 0}, {0x1B150, 1, 0},
+    {0x1B153, 0, 0}, {0x1B155, 1, 0}, {0x1B156, 0, 0},
+    {0x1B164, 1, 0}, {0x1B168, 0, 0}, {0x1B170, 1, 0},
+    {0x1B2FC, 0, 0}, {0x1BC00, 1, 0}, {0x1BC6B, 0, 0},
+    {0x1BC70, 1, 0}, {0x1BC7D, 0, 0}, {0x1BC80, 1, 0},
+    {0x1BC89, 0, 0}, {0x1BC90, 1, 0}, {0x1BC9A, 0, 0},
+    {0x1BC9D, 32, 0}, {0x1BC9F, 0, 0}, {0x1BCA0, 32, 0},
+    {0x1BCA4, 0, 0}, {0x1CF00, 32, 0}, {0x1CF2E, 0, 0},
+    {0x1CF30, 32, 0}, {0x1CF47, 0, 0}, {0x1D167, 32, 0},
+    {0x1D16A, 0, 0}, {0x1D173, 32, 0}, {0x1D183, 0, 0},
+    {0x1D185, 32, 0}, {0x1D18C, 0, 0}, {0x1D1AA, 32, 0},
+    {0x1D1AE, 0, 0}, {0x1D242, 32, 0}, {0x1D245, 0, 0},
+    {0x1D400, 21, 0}, {0x1D41A, 25, 0}, {0x1D434, 21, 0},
+    {0x1D44E, 25, 0}, {0x1D455, 0, 0}, {0x1D456, 25, 0},
+    {0x1D468, 21, 0}, {0x1D482, 25, 0}, {0x1D49C, 21, 0},
+    {0x1D49D, 0, 0}, {0x1D49E, 21, 0}, {0x1D4A0, 0, 0},
+    {0x1D4A2, 21, 0}, {0x1D4A3, 0, 0}, {0x1D4A5, 21, 0},
+    {0x1D4A7, 0, 0}, {0x1D4A9, 21, 0}, {0x1D4AD, 0, 0},
+    {0x1D4AE, 21, 0}, {0x1D4B6, 25, 0}, {0x1D4BA, 0, 0},
+    {0x1D4BB, 25, 0}, {0x1D4BC, 0, 0}, {0x1D4BD, 25, 0},
+    {0x1D4C4, 0, 0}, {0x1D4C5, 25, 0}, {0x1D4D0, 21, 0},
+    {0x1D4EA, 25, 0}, {0x1D504, 21, 0}, {0x1D506, 0, 0},
+    {0x1D507, 21, 0}, {0x1D50B, 0, 0}, {0x1D50D, 21, 0},
+    {0x1D515, 0, 0}, {0x1D516, 21, 0}, {0x1D51D, 0, 0},
+    {0x1D51E, 25, 0}, {0x1D538, 21, 0}, {0x1D53A, 0, 0},
+    {0x1D53B, 21, 0}, {0x1D53F, 0, 0}, {0x1D540, 21, 0},
+    {0x1D545, 0, 0}, {0x1D546, 21, 0}, {0x1D547, 0, 0},
+    {0x1D54A, 21, 0}, {0x1D551, 0, 0}, {0x1D552, 25, 0},
+    {0x1D56C, 21, 0}, {0x1D586, 25, 0}, {0x1D5A0, 21, 0},
+    {0x1D5BA, 25, 0}, {0x1D5D4, 21, 0}, {0x1D5EE, 25, 0},
+    {0x1D608, 21, 0}, {0x1D622, 25, 0}, {0x1D63C, 21, 0},
+    {0x1D656, 25, 0}, {0x1D670, 21, 0}, {0x1D68A, 25, 0},
+    {0x1D6A6, 0, 0}, {0x1D6A8, 21, 0}, {0x1D6C1, 0, 0},
+    {0x1D6C2, 25, 0}, {0x1D6DB, 0, 0}, {0x1D6DC, 25, 0},
+    {0x1D6E2, 21, 0}, {0x1D6FB, 0, 0}, {0x1D6FC, 25, 0},
+    {0x1D715, 0, 0}, {0x1D716, 25, 0}, {0x1D71C, 21, 0},
+    {0x1D735, 0, 0}, {0x1D736, 25, 0}, {0x1D74F, 0, 0},
+    {0x1D750, 25, 0}, {0x1D756, 21, 0}, {0x1D76F, 0, 0},
+    {0x1D770, 25, 0}, {0x1D789, 0, 0}, {0x1D78A, 25, 0},
+    {0x1D790, 21, 0}, {0x1D7A9, 0, 0}, {0x1D7AA, 25, 0},
+    {0x1D7C3, 0, 0}, {0x1D7C4, 25, 0}, {0x1D7CA, 21, 0},
+    {0x1D7CB, 25, 0}, {0x1D7CC, 0, 0}, {0x1D7CE, 2, 0},
+    {0x1D800, 0, 0}, {0x1DA00, 32, 0}, {0x1DA37, 0, 0},
+    {0x1DA3B, 32, 0}, {0x1DA6D, 0, 0}, {0x1DA75, 32, 0},
+    {0x1DA76, 0, 0}, {0x1DA84, 32, 0}, {0x1DA85, 0, 0},
+    {0x1DA9B, 32, 0}, {0x1DAA0, 0, 0}, {0x1DAA1, 32, 0},
+    {0x1DAB0, 0, 0}, {0x1DF00, 25, 0}, {0x1DF0A, 1, 0},
+    {0x1DF0B, 25, 0}, {0x1DF1F, 0, 0}, {0x1DF25, 25, 0},
+    {0x1DF2B, 0, 0}, {0x1E000, 32, 0}, {0x1E007, 0, 0},
+    {0x1E008, 32, 0}, {0x1E019, 0, 0}, {0x1E01B, 32, 0},
+    {0x1E022, 0, 0}, {0x1E023, 32, 0}, {0x1E025, 0, 0},
+    {0x1E026, 32, 0}, {0x1E02B, 0, 0}, {0x1E030, 41, 0},
+    {0x1E06E, 0, 0}, {0x1E08F, 32, 0}, {0x1E090, 0, 0},
+    {0x1E100, 1, 0}, {0x1E12D, 0, 0}, {0x1E130, 32, 0},
+    {0x1E137, 33, 0}, {0x1E13E, 0, 0}, {0x1E140, 2, 0},
+    {0x1E14A, 0, 0}, {0x1E14E, 1, 0}, {0x1E14F, 0, 0},
+    {0x1E290, 1, 0}, {0x1E2AE, 32, 0}, {0x1E2AF, 0, 0},
+    {0x1E2C0, 1, 0}, {0x1E2EC, 32, 0}, {0x1E2F0, 2, 0},
+    {0x1E2FA, 0, 0}, {0x1E4D0, 1, 0}, {0x1E4EB, 33, 0},
+    {0x1E4EC, 32, 0}, {0x1E4F0, 2, 0}, {0x1E4FA, 0, 0},
+    {0x1E7E0, 1, 0}, {0x1E7E7, 0, 0}, {0x1E7E8, 1, 0},
+    {0x1E7EC, 0, 0}, {0x1E7ED, 1, 0}, {0x1E7EF, 0, 0},
+    {0x1E7F0, 1, 0}, {0x1E7FF, 0, 0}, {0x1E800, 1, 0},
+    {0x1E8C5, 0, 0}, {0x1E8D0, 32, 0}, {0x1E8D7, 0, 0},
+    {0x1E900, 21, 34}, {0x1E922, 25, 0}, {0x1E944, 32, 0},
+    {0x1E94B, 33, 0}, {0x1E94C, 0, 0}, {0x1E950, 2, 0},
+    {0x1E95A, 0, 0}, {0x1EE00, 1, 0}, {0x1EE04, 0, 0},
+    {0x1EE05, 1, 0}, {0x1EE20, 0, 0}, {0x1EE21, 1, 0},
+    {0x1EE23, 0, 0}, {0x1EE24, 1, 0}, {0x1EE25, 0, 0},
+    {0x1EE27, 1, 0}, {0x1EE28, 0, 0}, {0x1EE29, 1, 0},
+    {0x1EE33, 0, 0}, {0x1EE34, 1, 0}, {0x1EE38, 0, 0},
+    {0x1EE39, 1, 0}, {0x1EE3A, 0, 0}, {0x1EE3B, 1, 0},
+    {0x1EE3C, 0, 0}, {0x1EE42, 1, 0}, {0x1EE43, 0, 0},
+    {0x1EE47, 1, 0}, {0x1EE48, 0, 0}, {0x1EE49, 1, 0},
+    {0x1EE4A, 0, 0}, {0x1EE4B, 1, 0}, {0x1EE4C, 0, 0},
+    {0x1EE4D, 1, 0}, {0x1EE50, 0, 0}, {0x1EE51, 1, 0},
+    {0x1EE53, 0, 0}, {0x1EE54, 1, 0}, {0x1EE55, 0, 0},
+    {0x1EE57, 1, 0}, {0x1EE58, 0, 0}, {0x1EE59, 1, 0},
+    {0x1EE5A, 0, 0}, {0x1EE5B, 1, 0}, {0x1EE5C, 0, 0},
+    {0x1EE5D, 1, 0}, {0x1EE5E, 0, 0}, {0x1EE5F, 1, 0},
+    {0x1EE60, 0, 0}, {0x1EE61, 1, 0}, {0x1EE63, 0, 0},
+    {0x1EE64, 1, 0}, {0x1EE65, 0, 0}, {0x1EE67, 1, 0},
+    {0x1EE6B, 0, 0}, {0x1EE6C, 1, 0}, {0x1EE73, 0, 0},
+    {0x1EE74, 1, 0}, {0x1EE78, 0, 0}, {0x1EE79, 1, 0},
+    {0x1EE7D, 0, 0}, {0x1EE7E, 1, 0}, {0x1EE7F, 0, 0},
+    {0x1EE80, 1, 0}, {0x1EE8A, 0, 0}, {0x1EE8B, 1, 0},
+    {0x1EE9C, 0, 0}, {0x1EEA1, 1, 0}, {0x1EEA4, 0, 0},
+    {0x1EEA5, 1, 0}, {0x1EEAA, 0, 0}, {0x1EEAB, 1, 0},
+    {0x1EEBC, 0, 0}, {0x1F100, 2, 0}, {0x1F10B, 0, 0},
+    {0x1F130, 20, 0}, {0x1F14A, 0, 0}, {0x1F150, 20, 0},
+    {0x1F16A, 0, 0}, {0x1F170, 20, 0}, {0x1F18A, 0, 0},
+    {0x1F3FB, 32, 0}, {0x1F400, 0, 0}, {0x1FBF0, 2, 0},
+    {0x1FBFA, 0, 0}, {0x20000, 1, 0}, {0x2A6E0, 0, 0},
+    {0x2A700, 1, 0}, {0x2B73A, 0, 0}, {0x2B740, 1, 0},
+    {0x2B81E, 0, 0}, {0x2B820, 1, 0}, {0x2CEA2, 0, 0},
+    {0x2CEB0, 1, 0}, {0x2EBE1, 0, 0}, {0x2F800, 1, 0},
+    {0x2FA1E, 0, 0}, {0x30000, 1, 0}, {0x3134B, 0, 0},
+    {0x31350, 1, 0}, {0x323B0, 0, 0}, {0xE0001, 32, 0},
+    {0xE0002, 0, 0}, {0xE0020, 32, 0}, {0xE0080, 0, 0},
+    {0xE0100, 32, 0}, {0xE01F0, 0, 0},
+};
+
+/* Code points whose lowercase form is more than one code point, in UTF-8 */
+static const struct {
+  uint32_t cp;
+  const char *lower;
+} unicode_long_lowercase[1] = {
+    {0x0130, "\x69\xcc\x87"},
+};
+
+#endif
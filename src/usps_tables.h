@@ -0,0 +1,2208 @@
+/*
+ * USPS abbreviation tables, as perfect hashes for perfect_hash_lookup().
+ *
+ * Generated by tools/gen_usps_tables.py from tools/usps/; do not edit.
+ */
+#ifndef USPS_TABLES_H
+#define USPS_TABLES_H
+
+#include "perfect_hash.h"
+
+/* direction_words.csv: 12 entries */
+static const PerfectHashEntry direction_words_slots[32] = {
+    {NULL, 0, NULL},
+    {"NE", 2, "NE"},
+    {"EAST", 4, "E"},
+    {"N", 1, "N"},
+    {"NW", 2, "NW"},
+    {"SW", 2, "SW"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"E", 1, "E"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"S", 1, "S"},
+    {"W", 1, "W"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"WEST", 4, "W"},
+    {"SOUTH", 5, "S"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SE", 2, "SE"},
+    {NULL, 0, NULL},
+    {"NORTH", 5, "N"},
+    {NULL, 0, NULL},
+};
+
+static const uint16_t direction_words_displacements[4] = {
+    1, 0, 0, 0,
+};
+
+static const PerfectHashTable direction_words = {
+    .slots = direction_words_slots,
+    .displacements = direction_words_displacements,
+    .slot_mask = 31,
+    .bucket_mask = 3,
+    .max_key_len = 5,
+};
+
+/* directionals.csv: 28 entries */
+static const PerfectHashEntry usps_directionals_slots[64] = {
+    {"NORTH-EAST", 10, "NE"},
+    {"N", 1, "N"},
+    {NULL, 0, NULL},
+    {"NORTH WEST", 10, "NW"},
+    {NULL, 0, NULL},
+    {"SW", 2, "SW"},
+    {"WEST", 4, "W"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SE", 2, "SE"},
+    {NULL, 0, NULL},
+    {"SOUTH EAST", 10, "SE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NORTH", 5, "N"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SOUTH-WEST", 10, "SW"},
+    {NULL, 0, NULL},
+    {"NORTHEAST", 9, "NE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NORTH EAST", 10, "NE"},
+    {"E", 1, "E"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EAST", 4, "E"},
+    {"S W", 3, "SW"},
+    {NULL, 0, NULL},
+    {"NORTH-WEST", 10, "NW"},
+    {"W", 1, "W"},
+    {NULL, 0, NULL},
+    {"NW", 2, "NW"},
+    {"S E", 3, "SE"},
+    {NULL, 0, NULL},
+    {"N E", 3, "NE"},
+    {"SOUTH-EAST", 10, "SE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NORTHWEST", 9, "NW"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"S", 1, "S"},
+    {"N W", 3, "NW"},
+    {NULL, 0, NULL},
+    {"SOUTH WEST", 10, "SW"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SOUTH", 5, "S"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NE", 2, "NE"},
+    {NULL, 0, NULL},
+    {"SOUTHEAST", 9, "SE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SOUTHWEST", 9, "SW"},
+};
+
+static const uint16_t usps_directionals_displacements[8] = {
+    3, 1, 0, 4, 0, 4, 2, 0,
+};
+
+static const PerfectHashTable usps_directionals = {
+    .slots = usps_directionals_slots,
+    .displacements = usps_directionals_displacements,
+    .slot_mask = 63,
+    .bucket_mask = 7,
+    .max_key_len = 10,
+};
+
+/* street_suffixes.csv: 507 entries */
+static const PerfectHashEntry usps_street_suffixes_slots[1024] = {
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"DR", 2, "DR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"MISSN", 5, "MSN"},
+    {NULL, 0, NULL},
+    {"PRT", 3, "PRT"},
+    {"ISLND", 5, "IS"},
+    {"POINT", 5, "PT"},
+    {"HOLWS", 5, "HOLW"},
+    {NULL, 0, NULL},
+    {"TUNNEL", 6, "TUNL"},
+    {NULL, 0, NULL},
+    {"HOLW", 4, "HOLW"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EXTNSN", 6, "EXT"},
+    {NULL, 0, NULL},
+    {"CAUSEWAY", 8, "CSWY"},
+    {"FALL", 4, "FALL"},
+    {NULL, 0, NULL},
+    {"MNTAIN", 6, "MTN"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"RANCHES", 7, "RNCH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ISLANDS", 7, "ISS"},
+    {"RADL", 4, "RADL"},
+    {"KNOLL", 5, "KNL"},
+    {"AV", 2, "AVE"},
+    {NULL, 0, NULL},
+    {"TRAILS", 6, "TRL"},
+    {"ROAD", 4, "RD"},
+    {"MT", 2, "MT"},
+    {NULL, 0, NULL},
+    {"VALLEYS", 7, "VLYS"},
+    {"LANE", 4, "LN"},
+    {"CP", 2, "CP"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"DIV", 3, "DV"},
+    {"TUNNL", 5, "TUNL"},
+    {NULL, 0, NULL},
+    {"TRLRS", 5, "TRLR"},
+    {"LOAF", 4, "LF"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BYPS", 4, "BYP"},
+    {NULL, 0, NULL},
+    {"RDGS", 4, "RDGS"},
+    {"SHOALS", 6, "SHLS"},
+    {"HILL", 4, "HL"},
+    {"MNRS", 4, "MNRS"},
+    {"KEYS", 4, "KYS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BLF", 3, "BLF"},
+    {NULL, 0, NULL},
+    {"KYS", 3, "KYS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"STN", 3, "STA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"MOUNTAIN", 8, "MTN"},
+    {"ALLEY", 5, "ALY"},
+    {"TRACES", 6, "TRCE"},
+    {NULL, 0, NULL},
+    {"MEADOW", 6, "MDW"},
+    {"PARKWAY", 7, "PKWY"},
+    {NULL, 0, NULL},
+    {"SPNG", 4, "SPG"},
+    {NULL, 0, NULL},
+    {"FRK", 3, "FRK"},
+    {NULL, 0, NULL},
+    {"WALKS", 5, "WALK"},
+    {"CAPE", 4, "CPE"},
+    {"HIGHWY", 6, "HWY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"CLFS", 4, "CLFS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"VSTA", 4, "VIS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PNES", 4, "PNES"},
+    {"PLN", 3, "PLN"},
+    {"SHRS", 4, "SHRS"},
+    {"BTM", 3, "BTM"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TERRACE", 7, "TER"},
+    {"FLT", 3, "FLT"},
+    {NULL, 0, NULL},
+    {"MEADOWS", 7, "MDWS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"VILLAGE", 7, "VLG"},
+    {NULL, 0, NULL},
+    {"STR", 3, "ST"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EXTENSIONS", 10, "EXTS"},
+    {"SPNGS", 5, "SPGS"},
+    {"PORT", 4, "PRT"},
+    {NULL, 0, NULL},
+    {"TUNEL", 5, "TUNL"},
+    {"VW", 2, "VW"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ALY", 3, "ALY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TRCE", 4, "TRCE"},
+    {"SHL", 3, "SHL"},
+    {"CREEK", 5, "CRK"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PATH", 4, "PATH"},
+    {"WAYS", 4, "WAYS"},
+    {NULL, 0, NULL},
+    {"STATION", 7, "STA"},
+    {"DAM", 3, "DM"},
+    {"RIDGE", 5, "RDG"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"MNTNS", 5, "MTNS"},
+    {NULL, 0, NULL},
+    {"KEY", 3, "KY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BYPASS", 6, "BYP"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"LK", 2, "LK"},
+    {"LN", 2, "LN"},
+    {"PINE", 4, "PNE"},
+    {NULL, 0, NULL},
+    {"CAMP", 4, "CP"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TURNPK", 6, "TPKE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"UNIONS", 6, "UNS"},
+    {NULL, 0, NULL},
+    {"RIVR", 4, "RIV"},
+    {"CIRCLES", 7, "CIRS"},
+    {NULL, 0, NULL},
+    {"RD", 2, "RD"},
+    {"CRESCENT", 8, "CRES"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FIELD", 5, "FLD"},
+    {"FLATS", 5, "FLTS"},
+    {"DALE", 4, "DL"},
+    {"GATEWY", 6, "GTWY"},
+    {"CMP", 3, "CP"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"RAD", 3, "RADL"},
+    {"MISSION", 7, "MSN"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"KNOLLS", 6, "KNLS"},
+    {NULL, 0, NULL},
+    {"DVD", 3, "DV"},
+    {"BRANCH", 6, "BR"},
+    {"BOUL", 4, "BLVD"},
+    {NULL, 0, NULL},
+    {"FREEWY", 6, "FWY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FRWAY", 5, "FWY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ORCH", 4, "ORCH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PINES", 5, "PNES"},
+    {"VIEW", 4, "VW"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FRT", 3, "FT"},
+    {"SPGS", 4, "SPGS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SPRNGS", 6, "SPGS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"UN", 2, "UN"},
+    {"SHORES", 6, "SHRS"},
+    {"STREET", 6, "ST"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"MOUNTIN", 7, "MTN"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"GARDN", 5, "GDN"},
+    {NULL, 0, NULL},
+    {"CENTR", 5, "CTR"},
+    {NULL, 0, NULL},
+    {"DV", 2, "DV"},
+    {"CV", 2, "CV"},
+    {"AVNUE", 5, "AVE"},
+    {"SUMITT", 6, "SMT"},
+    {"FORGE", 5, "FRG"},
+    {"VLYS", 4, "VLYS"},
+    {"LCK", 3, "LCK"},
+    {"FORDS", 5, "FRDS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EXPRESSWAY", 10, "EXPY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"DRIVE", 5, "DR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NCK", 3, "NCK"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BAYOO", 5, "BYU"},
+    {"CROSSROAD", 9, "XRD"},
+    {NULL, 0, NULL},
+    {"LODGE", 5, "LDG"},
+    {"PKWYS", 5, "PKWY"},
+    {"GROVES", 6, "GRVS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BOTTM", 5, "BTM"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EXPW", 4, "EXPY"},
+    {"MANOR", 5, "MNR"},
+    {NULL, 0, NULL},
+    {"INLET", 5, "INLT"},
+    {"TUNL", 4, "TUNL"},
+    {"CRK", 3, "CRK"},
+    {"VLG", 3, "VLG"},
+    {"RST", 3, "RST"},
+    {NULL, 0, NULL},
+    {"RDGE", 4, "RDG"},
+    {"MALL", 4, "MALL"},
+    {"BLUFF", 5, "BLF"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HARBORS", 7, "HBRS"},
+    {NULL, 0, NULL},
+    {"CORS", 4, "CORS"},
+    {NULL, 0, NULL},
+    {"STRAVEN", 7, "STRA"},
+    {NULL, 0, NULL},
+    {"CLIFFS", 6, "CLFS"},
+    {"VST", 3, "VIS"},
+    {NULL, 0, NULL},
+    {"GTWY", 4, "GTWY"},
+    {"MANORS", 6, "MNRS"},
+    {"ANX", 3, "ANX"},
+    {"HT", 2, "HTS"},
+    {"MNTN", 4, "MTN"},
+    {"SQRS", 4, "SQS"},
+    {"CRSNT", 5, "CRES"},
+    {"CLUB", 4, "CLB"},
+    {"CREST", 5, "CRST"},
+    {NULL, 0, NULL},
+    {"RPDS", 4, "RPDS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BR", 2, "BR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TRK", 3, "TRAK"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"LANDING", 7, "LNDG"},
+    {NULL, 0, NULL},
+    {"VILLIAGE", 8, "VLG"},
+    {"CIRCL", 5, "CIR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BOULV", 5, "BLVD"},
+    {"RIDGES", 6, "RDGS"},
+    {"LOCKS", 5, "LCKS"},
+    {"CENT", 4, "CTR"},
+    {NULL, 0, NULL},
+    {"STRT", 4, "ST"},
+    {"RDS", 3, "RDS"},
+    {"PLAINS", 6, "PLNS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HARB", 4, "HBR"},
+    {"COURT", 5, "CT"},
+    {"PLZ", 3, "PLZ"},
+    {"RAPIDS", 6, "RPDS"},
+    {"CRES", 4, "CRES"},
+    {"SQU", 3, "SQ"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SHOAR", 5, "SHR"},
+    {"RVR", 3, "RIV"},
+    {"CRCL", 4, "CIR"},
+    {"FORGES", 6, "FRGS"},
+    {NULL, 0, NULL},
+    {"JCTION", 6, "JCT"},
+    {"RANCH", 5, "RNCH"},
+    {"RAMP", 4, "RAMP"},
+    {"DM", 2, "DM"},
+    {"CANYON", 6, "CYN"},
+    {"CEN", 3, "CTR"},
+    {NULL, 0, NULL},
+    {"BROOKS", 6, "BRKS"},
+    {"BOT", 3, "BTM"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"VILLE", 5, "VL"},
+    {"TRAK", 4, "TRAK"},
+    {"PLAZA", 5, "PLZ"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HTS", 3, "HTS"},
+    {NULL, 0, NULL},
+    {"CENTRE", 6, "CTR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"CNYN", 4, "CYN"},
+    {"PASSAGE", 7, "PSGE"},
+    {NULL, 0, NULL},
+    {"GRDEN", 5, "GDN"},
+    {"GARDENS", 7, "GDNS"},
+    {NULL, 0, NULL},
+    {"REST", 4, "RST"},
+    {"FRWY", 4, "FWY"},
+    {"WALL", 4, "WALL"},
+    {NULL, 0, NULL},
+    {"DL", 2, "DL"},
+    {NULL, 0, NULL},
+    {"SQ", 2, "SQ"},
+    {"FWY", 3, "FWY"},
+    {NULL, 0, NULL},
+    {"JUNCTIONS", 9, "JCTS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"AVN", 3, "AVE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"RDG", 3, "RDG"},
+    {"RUE", 3, "RUE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TRACK", 5, "TRAK"},
+    {"VALLY", 5, "VLY"},
+    {"LNDG", 4, "LNDG"},
+    {"GREEN", 5, "GRN"},
+    {NULL, 0, NULL},
+    {"BLUFFS", 6, "BLFS"},
+    {NULL, 0, NULL},
+    {"LF", 2, "LF"},
+    {"CT", 2, "CT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SHLS", 4, "SHLS"},
+    {"RPD", 3, "RPD"},
+    {"TRKS", 4, "TRAK"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ANNEX", 5, "ANX"},
+    {"COMMONS", 7, "CMNS"},
+    {"BRK", 3, "BRK"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"STA", 3, "STA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ROW", 3, "ROW"},
+    {"FRG", 3, "FRG"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"WELLS", 5, "WLS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"CPE", 3, "CPE"},
+    {NULL, 0, NULL},
+    {"CSWY", 4, "CSWY"},
+    {NULL, 0, NULL},
+    {"PRTS", 4, "PRTS"},
+    {NULL, 0, NULL},
+    {"MDWS", 4, "MDWS"},
+    {NULL, 0, NULL},
+    {"FRKS", 4, "FRKS"},
+    {NULL, 0, NULL},
+    {"BROOK", 5, "BRK"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ISLE", 4, "ISLE"},
+    {"RIV", 3, "RIV"},
+    {NULL, 0, NULL},
+    {"PARKS", 5, "PARK"},
+    {NULL, 0, NULL},
+    {"PLACE", 5, "PL"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HVN", 3, "HVN"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TUNLS", 5, "TUNL"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ISS", 3, "ISS"},
+    {NULL, 0, NULL},
+    {"BLUF", 4, "BLF"},
+    {"THROUGHWAY", 10, "TRWY"},
+    {NULL, 0, NULL},
+    {"FREEWAY", 7, "FWY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"LGT", 3, "LGT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"DRIVES", 6, "DRS"},
+    {"PASS", 4, "PASS"},
+    {NULL, 0, NULL},
+    {"PRAIRIE", 7, "PR"},
+    {NULL, 0, NULL},
+    {"DRV", 3, "DR"},
+    {"PLZA", 4, "PLZ"},
+    {"VIA", 3, "VIA"},
+    {"JUNCTON", 7, "JCT"},
+    {NULL, 0, NULL},
+    {"TRL", 3, "TRL"},
+    {"FLDS", 4, "FLDS"},
+    {NULL, 0, NULL},
+    {"POINTS", 6, "PTS"},
+    {NULL, 0, NULL},
+    {"TERR", 4, "TER"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SQUARE", 6, "SQ"},
+    {"CNTR", 4, "CTR"},
+    {"TRAIL", 5, "TRL"},
+    {"HIWY", 4, "HWY"},
+    {NULL, 0, NULL},
+    {"CRSE", 4, "CRSE"},
+    {"RADIEL", 6, "RADL"},
+    {NULL, 0, NULL},
+    {"KNLS", 4, "KNLS"},
+    {"FORESTS", 7, "FRST"},
+    {"SKYWAY", 6, "SKWY"},
+    {"ALLEE", 5, "ALY"},
+    {"STREME", 6, "STRM"},
+    {"CTR", 3, "CTR"},
+    {"ARCADE", 6, "ARC"},
+    {NULL, 0, NULL},
+    {"BAYOU", 5, "BYU"},
+    {"SQRE", 4, "SQ"},
+    {"DIVIDE", 6, "DV"},
+    {NULL, 0, NULL},
+    {"VIADCT", 6, "VIA"},
+    {NULL, 0, NULL},
+    {"COMMON", 6, "CMN"},
+    {"XING", 4, "XING"},
+    {"AVE", 3, "AVE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PLNS", 4, "PLNS"},
+    {NULL, 0, NULL},
+    {"CANYN", 5, "CYN"},
+    {NULL, 0, NULL},
+    {"PKWAY", 5, "PKWY"},
+    {"MTN", 3, "MTN"},
+    {"VWS", 3, "VWS"},
+    {"BEACH", 5, "BCH"},
+    {"KNL", 3, "KNL"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"STREETS", 7, "STS"},
+    {"FLD", 3, "FLD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"COURSE", 6, "CRSE"},
+    {NULL, 0, NULL},
+    {"EXTS", 4, "EXTS"},
+    {"VLGS", 4, "VLGS"},
+    {NULL, 0, NULL},
+    {"AVENUE", 6, "AVE"},
+    {"PRK", 3, "PARK"},
+    {"SHR", 3, "SHR"},
+    {"PR", 2, "PR"},
+    {"FORT", 4, "FT"},
+    {NULL, 0, NULL},
+    {"STRVNUE", 7, "STRA"},
+    {"LAKES", 5, "LKS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"MOUNTAINS", 9, "MTNS"},
+    {"OVL", 3, "OVAL"},
+    {NULL, 0, NULL},
+    {"LIGHTS", 6, "LGTS"},
+    {"EST", 3, "EST"},
+    {"BOULEVARD", 9, "BLVD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"WY", 2, "WAY"},
+    {"EXPY", 4, "EXPY"},
+    {"FLS", 3, "FLS"},
+    {NULL, 0, NULL},
+    {"GATWAY", 6, "GTWY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PT", 2, "PT"},
+    {"STRAVN", 6, "STRA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"VIST", 4, "VIS"},
+    {NULL, 0, NULL},
+    {"FERRY", 5, "FRY"},
+    {NULL, 0, NULL},
+    {"EXP", 3, "EXPY"},
+    {"VIS", 3, "VIS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"LDGE", 4, "LDG"},
+    {"ROUTE", 5, "RTE"},
+    {"KNOL", 4, "KNL"},
+    {"GRN", 3, "GRN"},
+    {"HWY", 3, "HWY"},
+    {"ALLY", 4, "ALY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"CENTER", 6, "CTR"},
+    {"CRCLE", 5, "CIR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"CORNER", 6, "COR"},
+    {"CAUSWA", 6, "CSWY"},
+    {NULL, 0, NULL},
+    {"GROV", 4, "GRV"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"LIGHT", 5, "LGT"},
+    {NULL, 0, NULL},
+    {"BYPAS", 5, "BYP"},
+    {"HRBOR", 5, "HBR"},
+    {"JCTNS", 5, "JCTS"},
+    {"CURVE", 5, "CURV"},
+    {"MEWS", 4, "MEWS"},
+    {"ORCHARD", 7, "ORCH"},
+    {NULL, 0, NULL},
+    {"RUN", 3, "RUN"},
+    {NULL, 0, NULL},
+    {"EXTN", 4, "EXT"},
+    {"GLEN", 4, "GLN"},
+    {"MILL", 4, "ML"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HL", 2, "HL"},
+    {"BLVD", 4, "BLVD"},
+    {"HEIGHTS", 7, "HTS"},
+    {NULL, 0, NULL},
+    {"SUMMIT", 6, "SMT"},
+    {NULL, 0, NULL},
+    {"RIVER", 5, "RIV"},
+    {"STREAM", 6, "STRM"},
+    {NULL, 0, NULL},
+    {"VILLAGES", 8, "VLGS"},
+    {"RNCH", 4, "RNCH"},
+    {"BURGS", 5, "BGS"},
+    {NULL, 0, NULL},
+    {"WELL", 4, "WL"},
+    {NULL, 0, NULL},
+    {"HAVEN", 5, "HVN"},
+    {"COVES", 5, "CVS"},
+    {"TRACKS", 6, "TRAK"},
+    {"MOTORWAY", 8, "MTWY"},
+    {"PKWY", 4, "PKWY"},
+    {"CROSSING", 8, "XING"},
+    {NULL, 0, NULL},
+    {"DRIV", 4, "DR"},
+    {"GRDNS", 5, "GDNS"},
+    {"FLAT", 4, "FLT"},
+    {NULL, 0, NULL},
+    {"EXPRESS", 7, "EXPY"},
+    {"CRSSNG", 6, "XING"},
+    {NULL, 0, NULL},
+    {"FORD", 4, "FRD"},
+    {NULL, 0, NULL},
+    {"CIR", 3, "CIR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HBR", 3, "HBR"},
+    {"ORCHRD", 6, "ORCH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PORTS", 5, "PRTS"},
+    {"ESTATE", 6, "EST"},
+    {"COR", 3, "COR"},
+    {"PRR", 3, "PR"},
+    {"HIWAY", 5, "HWY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FIELDS", 6, "FLDS"},
+    {"FRY", 3, "FRY"},
+    {"GARDEN", 6, "GDN"},
+    {"STRA", 4, "STRA"},
+    {NULL, 0, NULL},
+    {"FRST", 4, "FRST"},
+    {NULL, 0, NULL},
+    {"GRV", 3, "GRV"},
+    {"LKS", 3, "LKS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PIKES", 5, "PIKE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"GLENS", 5, "GLNS"},
+    {"CIRCLE", 6, "CIR"},
+    {NULL, 0, NULL},
+    {"CORNERS", 7, "CORS"},
+    {"MEDOWS", 6, "MDWS"},
+    {"TRAFFICWAY", 10, "TRFY"},
+    {"JCTN", 4, "JCT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SMT", 3, "SMT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ESTS", 4, "ESTS"},
+    {"VLLY", 4, "VLY"},
+    {"LAKE", 4, "LK"},
+    {"ISLAND", 6, "IS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"CLIFF", 5, "CLF"},
+    {"MOUNT", 5, "MT"},
+    {"FLTS", 4, "FLTS"},
+    {"GREENS", 6, "GRNS"},
+    {"WLS", 3, "WLS"},
+    {"TUNNELS", 7, "TUNL"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"JCTS", 4, "JCTS"},
+    {"FT", 2, "FT"},
+    {"LOCK", 4, "LCK"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"COURTS", 6, "CTS"},
+    {NULL, 0, NULL},
+    {"SPRING", 6, "SPG"},
+    {NULL, 0, NULL},
+    {"STRM", 4, "STRM"},
+    {NULL, 0, NULL},
+    {"RADIAL", 6, "RADL"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"JCT", 3, "JCT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"STRAV", 5, "STRA"},
+    {"IS", 2, "IS"},
+    {NULL, 0, NULL},
+    {"HIGHWAY", 7, "HWY"},
+    {"SPURS", 5, "SPUR"},
+    {"HARBR", 5, "HBR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SPRINGS", 7, "SPGS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"INLT", 4, "INLT"},
+    {NULL, 0, NULL},
+    {"ANEX", 4, "ANX"},
+    {"RAPID", 5, "RPD"},
+    {NULL, 0, NULL},
+    {"TRAILER", 7, "TRLR"},
+    {"CROSSROADS", 10, "XRDS"},
+    {"MTIN", 4, "MTN"},
+    {"JUNCTION", 8, "JCT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"GATEWAY", 7, "GTWY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HWAY", 4, "HWY"},
+    {"TRNPK", 5, "TPKE"},
+    {NULL, 0, NULL},
+    {"MILLS", 5, "MLS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"MDW", 3, "MDWS"},
+    {"SHOAL", 5, "SHL"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"STATN", 5, "STA"},
+    {"BRDGE", 5, "BRG"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HOLLOWS", 7, "HOLW"},
+    {NULL, 0, NULL},
+    {"OVAL", 4, "OVAL"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"VIADUCT", 7, "VIA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"VISTA", 5, "VIS"},
+    {"SHORE", 5, "SHR"},
+    {"FALLS", 5, "FLS"},
+    {NULL, 0, NULL},
+    {"FRRY", 4, "FRY"},
+    {"BYPA", 4, "BYP"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"CLF", 3, "CLF"},
+    {"PARKWY", 6, "PKWY"},
+    {NULL, 0, NULL},
+    {"SUMIT", 5, "SMT"},
+    {NULL, 0, NULL},
+    {"HLLW", 4, "HOLW"},
+    {"BEND", 4, "BND"},
+    {"FOREST", 6, "FRST"},
+    {"UNDERPASS", 9, "UPAS"},
+    {"BRG", 3, "BRG"},
+    {"VALLEY", 6, "VLY"},
+    {"VILL", 4, "VLG"},
+    {"ANNX", 4, "ANX"},
+    {"LNDNG", 5, "LNDG"},
+    {NULL, 0, NULL},
+    {"SPRNG", 5, "SPG"},
+    {NULL, 0, NULL},
+    {"ISLES", 5, "ISLE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"VLY", 3, "VLY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"GDNS", 4, "GDNS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SQR", 3, "SQ"},
+    {NULL, 0, NULL},
+    {"BCH", 3, "BCH"},
+    {"GRDN", 4, "GDN"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"STRVN", 5, "STRA"},
+    {"BRNCH", 5, "BR"},
+    {"LOOP", 4, "LOOP"},
+    {"ISLNDS", 6, "ISS"},
+    {"EXTENSION", 9, "EXT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"LOOPS", 5, "LOOP"},
+    {"CENTERS", 7, "CTRS"},
+    {"ROADS", 5, "RDS"},
+    {"PIKE", 4, "PIKE"},
+    {"VIEWS", 5, "VWS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FRD", 3, "FRD"},
+    {"TRACE", 5, "TRCE"},
+    {"TURNPIKE", 8, "TPKE"},
+    {"KY", 2, "KY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ARC", 3, "ARC"},
+    {"LDG", 3, "LDG"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EXT", 3, "EXT"},
+    {"BOTTOM", 6, "BTM"},
+    {NULL, 0, NULL},
+    {"CNTER", 5, "CTR"},
+    {"FORG", 4, "FRG"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PKY", 3, "PKWY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HOLLOW", 6, "HOLW"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"AVEN", 4, "AVE"},
+    {"CRSENT", 6, "CRES"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"LODG", 4, "LDG"},
+    {NULL, 0, NULL},
+    {"SPG", 3, "SPG"},
+    {"VILLG", 5, "VLG"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"LAND", 4, "LAND"},
+    {NULL, 0, NULL},
+    {"MNR", 3, "MNR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"CTS", 3, "CTS"},
+    {"WALK", 4, "WALK"},
+    {"VILLAG", 6, "VLG"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BURG", 4, "BG"},
+    {"PTS", 3, "PTS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BYP", 3, "BYP"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SQUARES", 7, "SQS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HARBOR", 6, "HBR"},
+    {"PLAIN", 5, "PLN"},
+    {"ESTATES", 7, "ESTS"},
+    {NULL, 0, NULL},
+    {"BRIDGE", 6, "BRG"},
+    {"FORKS", 5, "FRKS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TRLS", 4, "TRL"},
+    {NULL, 0, NULL},
+    {"AVENU", 5, "AVE"},
+    {"LCKS", 4, "LCKS"},
+    {"HLS", 3, "HLS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"STRAVENUE", 9, "STRA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"COVE", 4, "CV"},
+    {"VDCT", 4, "VIA"},
+    {"HILLS", 5, "HLS"},
+    {NULL, 0, NULL},
+    {"EXPR", 4, "EXPY"},
+    {"NECK", 4, "NCK"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FORK", 4, "FRK"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"GTWAY", 5, "GTWY"},
+    {NULL, 0, NULL},
+    {"MNT", 3, "MT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PL", 2, "PL"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"WAY", 3, "WAY"},
+    {"JUNCTN", 6, "JCT"},
+    {"SHOARS", 6, "SHRS"},
+    {NULL, 0, NULL},
+    {"ST", 2, "ST"},
+    {"VL", 2, "VL"},
+    {NULL, 0, NULL},
+    {"PARKWAYS", 8, "PKWY"},
+    {NULL, 0, NULL},
+    {"BND", 3, "BND"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PATHS", 5, "PATH"},
+    {"PARK", 4, "PARK"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"GROVE", 5, "GRV"},
+    {"SPUR", 4, "SPUR"},
+    {NULL, 0, NULL},
+    {"OVERPASS", 8, "OPAS"},
+    {NULL, 0, NULL},
+    {"GLN", 3, "GLN"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TER", 3, "TER"},
+    {NULL, 0, NULL},
+    {"MSSN", 4, "MSN"},
+    {NULL, 0, NULL},
+    {"TRLR", 4, "TRLR"},
+    {"UNION", 5, "UN"},
+    {"RNCHS", 5, "RNCH"},
+    {"CIRC", 4, "CIR"},
+    {"CLB", 3, "CLB"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+};
+
+static const uint16_t usps_street_suffixes_displacements[128] = {
+    1, 3, 0, 0, 2, 3, 6, 0, 0, 0,
+    2, 1, 0, 1, 1, 5, 0, 0, 0, 3,
+    1, 0, 7, 0, 0, 2, 1, 2, 1, 1,
+    1, 0, 5, 2, 0, 1, 3, 2, 0, 5,
+    6, 8, 1, 0, 3, 5, 0, 1, 5, 2,
+    2, 1, 0, 0, 1, 0, 5, 2, 0, 0,
+    2, 0, 0, 1, 1, 0, 2, 0, 7, 0,
+    8, 0, 2, 0, 0, 1, 0, 0, 8, 0,
+    1, 20, 0, 2, 0, 2, 3, 0, 5, 3,
+    10, 2, 0, 0, 0, 2, 4, 15, 1, 5,
+    1, 0, 1, 1, 2, 10, 14, 3, 0, 4,
+    0, 0, 10, 7, 2, 7, 1, 9, 2, 4,
+    4, 0, 1, 3, 2, 0, 2, 1,
+};
+
+static const PerfectHashTable usps_street_suffixes = {
+    .slots = usps_street_suffixes_slots,
+    .displacements = usps_street_suffixes_displacements,
+    .slot_mask = 1023,
+    .bucket_mask = 127,
+    .max_key_len = 10,
+};
+
+/* secondary_units.csv: 40 entries */
+static const PerfectHashEntry usps_secondary_units_slots[128] = {
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"REAR", 4, "REAR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"APARTMENT", 9, "APT"},
+    {"BUILDING", 8, "BLDG"},
+    {NULL, 0, NULL},
+    {"PIER", 4, "PIER"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PH", 2, "PH"},
+    {"TRAILER", 7, "TRLR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"KEY", 3, "KEY"},
+    {"FL", 2, "FL"},
+    {"LOBBY", 5, "LBBY"},
+    {NULL, 0, NULL},
+    {"FRONT", 5, "FRNT"},
+    {"SUITE", 5, "STE"},
+    {"LBBY", 4, "LBBY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BASEMENT", 8, "BSMT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SIDE", 4, "SIDE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"LOWER", 5, "LOWR"},
+    {"LOT", 3, "LOT"},
+    {NULL, 0, NULL},
+    {"PENTHOUSE", 9, "PH"},
+    {NULL, 0, NULL},
+    {"UNIT", 4, "UNIT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HNGR", 4, "HNGR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"RM", 2, "RM"},
+    {NULL, 0, NULL},
+    {"UPPR", 4, "UPPR"},
+    {"SPACE", 5, "SPC"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"STOP", 4, "STOP"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"OFFICE", 6, "OFC"},
+    {"FRNT", 4, "FRNT"},
+    {"FLOOR", 5, "FL"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"UPPER", 5, "UPPR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"APT", 3, "APT"},
+    {NULL, 0, NULL},
+    {"SPC", 3, "SPC"},
+    {NULL, 0, NULL},
+    {"OFC", 3, "OFC"},
+    {NULL, 0, NULL},
+    {"LOWR", 4, "LOWR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BLDG", 4, "BLDG"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"DEPARTMENT", 10, "DEPT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"HANGER", 6, "HNGR"},
+    {NULL, 0, NULL},
+    {"DEPT", 4, "DEPT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ROOM", 4, "RM"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"STE", 3, "STE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TRLR", 4, "TRLR"},
+    {"BSMT", 4, "BSMT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SLIP", 4, "SLIP"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+};
+
+static const uint16_t usps_secondary_units_displacements[16] = {
+    0, 1, 0, 0, 0, 0, 0, 1, 2, 0,
+    0, 1, 1, 0, 0, 0,
+};
+
+static const PerfectHashTable usps_secondary_units = {
+    .slots = usps_secondary_units_slots,
+    .displacements = usps_secondary_units_displacements,
+    .slot_mask = 127,
+    .bucket_mask = 15,
+    .max_key_len = 10,
+};
+
+/* states.csv: 62 entries */
+static const PerfectHashEntry usps_states_slots[128] = {
+    {"PALAU", 5, "PW"},
+    {"DELAWARE", 8, "DE"},
+    {"NEVADA", 6, "NV"},
+    {"OREGON", 6, "OR"},
+    {"NORTH CAROLINA", 14, "NC"},
+    {NULL, 0, NULL},
+    {"MICHIGAN", 8, "MI"},
+    {NULL, 0, NULL},
+    {"ALABAMA", 7, "AL"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"COLORADO", 8, "CO"},
+    {"GUAM", 4, "GU"},
+    {"OHIO", 4, "OH"},
+    {"UTAH", 4, "UT"},
+    {"FLORIDA", 7, "FL"},
+    {"TENNESSEE", 9, "TN"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NEW MEXICO", 10, "NM"},
+    {"VERMONT", 7, "VT"},
+    {"NORTH DAKOTA", 12, "ND"},
+    {"CALIFORNIA", 10, "CA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ILLINOIS", 8, "IL"},
+    {"GEORGIA", 7, "GA"},
+    {NULL, 0, NULL},
+    {"ARMED FORCES EUROPE", 19, "AE"},
+    {"SOUTH DAKOTA", 12, "SD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ARIZONA", 7, "AZ"},
+    {"MAINE", 5, "ME"},
+    {"ARMED FORCES AMERICAS", 21, "AA"},
+    {NULL, 0, NULL},
+    {"NEW YORK", 8, "NY"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"WYOMING", 7, "WY"},
+    {"NORTHERN MARIANA ISLANDS", 24, "MP"},
+    {"CONNECTICUT", 11, "CT"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TEXAS", 5, "TX"},
+    {"NEW HAMPSHIRE", 13, "NH"},
+    {NULL, 0, NULL},
+    {"MINNESOTA", 9, "MN"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"MARYLAND", 8, "MD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"MISSOURI", 8, "MO"},
+    {"WASHINGTON", 10, "WA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ALASKA", 6, "AK"},
+    {NULL, 0, NULL},
+    {"MONTANA", 7, "MT"},
+    {NULL, 0, NULL},
+    {"MISSISSIPPI", 11, "MS"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"DISTRICT OF COLUMBIA", 20, "DC"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"KANSAS", 6, "KS"},
+    {NULL, 0, NULL},
+    {"NEBRASKA", 8, "NE"},
+    {"ARMED FORCES PACIFIC", 20, "AP"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SOUTH CAROLINA", 14, "SC"},
+    {"VIRGIN ISLANDS", 14, "VI"},
+    {"OKLAHOMA", 8, "OK"},
+    {"VIRGINIA", 8, "VA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"KENTUCKY", 8, "KY"},
+    {"IOWA", 4, "IA"},
+    {NULL, 0, NULL},
+    {"LOUISIANA", 9, "LA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PUERTO RICO", 11, "PR"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FEDERATED STATES OF MICRONESIA", 30, "FM"},
+    {"MARSHALL ISLANDS", 16, "MH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"WISCONSIN", 9, "WI"},
+    {NULL, 0, NULL},
+    {"WEST VIRGINIA", 13, "WV"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"RHODE ISLAND", 12, "RI"},
+    {"IDAHO", 5, "ID"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ARKANSAS", 8, "AR"},
+    {"MASSACHUSETTS", 13, "MA"},
+    {NULL, 0, NULL},
+    {"HAWAII", 6, "HI"},
+    {"PENNSYLVANIA", 12, "PA"},
+    {NULL, 0, NULL},
+    {"AMERICAN SAMOA", 14, "AS"},
+    {"NEW JERSEY", 10, "NJ"},
+    {NULL, 0, NULL},
+    {"INDIANA", 7, "IN"},
+};
+
+static const uint16_t usps_states_displacements[16] = {
+    1, 0, 0, 0, 0, 10, 10, 1, 0, 4,
+    4, 0, 4, 2, 23, 0,
+};
+
+static const PerfectHashTable usps_states = {
+    .slots = usps_states_slots,
+    .displacements = usps_states_displacements,
+    .slot_mask = 127,
+    .bucket_mask = 15,
+    .max_key_len = 30,
+};
+
+/* outputs of states.csv: 62 entries */
+static const PerfectHashEntry usps_state_codes_slots[128] = {
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"WI", 2, "WI"},
+    {"GA", 2, "GA"},
+    {NULL, 0, NULL},
+    {"DE", 2, "DE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FM", 2, "FM"},
+    {NULL, 0, NULL},
+    {"KY", 2, "KY"},
+    {"NE", 2, "NE"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NV", 2, "NV"},
+    {"NH", 2, "NH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"AR", 2, "AR"},
+    {"CT", 2, "CT"},
+    {NULL, 0, NULL},
+    {"MN", 2, "MN"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FL", 2, "FL"},
+    {"AE", 2, "AE"},
+    {"LA", 2, "LA"},
+    {"WA", 2, "WA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NM", 2, "NM"},
+    {NULL, 0, NULL},
+    {"HI", 2, "HI"},
+    {"IL", 2, "IL"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"OH", 2, "OH"},
+    {"PW", 2, "PW"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"ND", 2, "ND"},
+    {"VI", 2, "VI"},
+    {"NJ", 2, "NJ"},
+    {"IA", 2, "IA"},
+    {NULL, 0, NULL},
+    {"MA", 2, "MA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"AK", 2, "AK"},
+    {"IN", 2, "IN"},
+    {"ME", 2, "ME"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"GU", 2, "GU"},
+    {"WV", 2, "WV"},
+    {"OR", 2, "OR"},
+    {"MP", 2, "MP"},
+    {"MH", 2, "MH"},
+    {NULL, 0, NULL},
+    {"AZ", 2, "AZ"},
+    {"MO", 2, "MO"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"CA", 2, "CA"},
+    {"MD", 2, "MD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"WY", 2, "WY"},
+    {NULL, 0, NULL},
+    {"OK", 2, "OK"},
+    {NULL, 0, NULL},
+    {"TN", 2, "TN"},
+    {"MI", 2, "MI"},
+    {"NY", 2, "NY"},
+    {"TX", 2, "TX"},
+    {NULL, 0, NULL},
+    {"VT", 2, "VT"},
+    {NULL, 0, NULL},
+    {"MS", 2, "MS"},
+    {NULL, 0, NULL},
+    {"UT", 2, "UT"},
+    {NULL, 0, NULL},
+    {"ID", 2, "ID"},
+    {NULL, 0, NULL},
+    {"CO", 2, "CO"},
+    {"RI", 2, "RI"},
+    {"DC", 2, "DC"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NC", 2, "NC"},
+    {"PA", 2, "PA"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"AA", 2, "AA"},
+    {NULL, 0, NULL},
+    {"AP", 2, "AP"},
+    {NULL, 0, NULL},
+    {"VA", 2, "VA"},
+    {NULL, 0, NULL},
+    {"SD", 2, "SD"},
+    {NULL, 0, NULL},
+    {"AL", 2, "AL"},
+    {NULL, 0, NULL},
+    {"PR", 2, "PR"},
+    {"AS", 2, "AS"},
+    {NULL, 0, NULL},
+    {"MT", 2, "MT"},
+    {NULL, 0, NULL},
+    {"SC", 2, "SC"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"KS", 2, "KS"},
+};
+
+static const uint16_t usps_state_codes_displacements[16] = {
+    0, 0, 0, 4, 1, 0, 1, 0, 0, 6,
+    1, 0, 4, 0, 1, 0,
+};
+
+static const PerfectHashTable usps_state_codes = {
+    .slots = usps_state_codes_slots,
+    .displacements = usps_state_codes_displacements,
+    .slot_mask = 127,
+    .bucket_mask = 15,
+    .max_key_len = 2,
+};
+
+/* box_types.csv: 12 entries */
+static const PerfectHashEntry usps_box_types_slots[32] = {
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"POBOX", 5, "PO BOX"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"BOX", 3, "PO BOX"},
+    {NULL, 0, NULL},
+    {"POST OFFICE DRAWER", 18, "PO BOX"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"P O BOX", 7, "PO BOX"},
+    {"POST BOX", 8, "PO BOX"},
+    {NULL, 0, NULL},
+    {"PO BOX", 6, "PO BOX"},
+    {"POST OFFICE BOX", 15, "PO BOX"},
+    {NULL, 0, NULL},
+    {"POB", 3, "PO BOX"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PO DRAWER", 9, "PO BOX"},
+    {NULL, 0, NULL},
+    {"P O", 3, "PO BOX"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"PO", 2, "PO BOX"},
+    {NULL, 0, NULL},
+    {"POST OFFICE", 11, "PO BOX"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+};
+
+static const uint16_t usps_box_types_displacements[4] = {
+    0, 2, 1, 1,
+};
+
+static const PerfectHashTable usps_box_types = {
+    .slots = usps_box_types_slots,
+    .displacements = usps_box_types_displacements,
+    .slot_mask = 31,
+    .bucket_mask = 3,
+    .max_key_len = 18,
+};
+
+/* ordinals.csv: 243 entries */
+static const PerfectHashEntry usps_ordinals_slots[512] = {
+    {"SEVENTY SECOND", 14, "72ND"},
+    {NULL, 0, NULL},
+    {"NINETYFIFTH", 11, "95TH"},
+    {"NINETY-SIXTH", 12, "96TH"},
+    {"FIFTYSECOND", 11, "52ND"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FIFTY-THIRD", 11, "53RD"},
+    {"TWENTYFIRST", 11, "21ST"},
+    {"FIFTY-SIXTH", 11, "56TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FORTIETH", 8, "40TH"},
+    {"NINETY NINTH", 12, "99TH"},
+    {NULL, 0, NULL},
+    {"NINETY SEVENTH", 14, "97TH"},
+    {"NINETIETH", 9, "90TH"},
+    {"FIFTY FIFTH", 11, "55TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SIXTY-NINTH", 11, "69TH"},
+    {"FORTY-NINTH", 11, "49TH"},
+    {NULL, 0, NULL},
+    {"TWENTY-SEVENTH", 14, "27TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TWENTY SECOND", 13, "22ND"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"THIRTY-SECOND", 13, "32ND"},
+    {NULL, 0, NULL},
+    {"FIFTY-FIRST", 11, "51ST"},
+    {"THIRTY FIRST", 12, "31ST"},
+    {NULL, 0, NULL},
+    {"SEVENTY EIGHTH", 14, "78TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SIXTYFOURTH", 11, "64TH"},
+    {"FORTY-FIFTH", 11, "45TH"},
+    {NULL, 0, NULL},
+    {"SEVENTY-SIXTH", 13, "76TH"},
+    {"THIRTYEIGHTH", 12, "38TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TWENTY-EIGHTH", 13, "28TH"},
+    {"SEVENTYSEVENTH", 14, "77TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EIGHTY FOURTH", 13, "84TH"},
+    {"SIXTY SIXTH", 11, "66TH"},
+    {NULL, 0, NULL},
+    {"SIXTY-SIXTH", 11, "66TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"THIRTY-FIRST", 12, "31ST"},
+    {NULL, 0, NULL},
+    {"SEVENTYNINTH", 12, "79TH"},
+    {NULL, 0, NULL},
+    {"EIGHTYEIGHTH", 12, "88TH"},
+    {"FORTY-EIGHTH", 12, "48TH"},
+    {"FIFTY SECOND", 12, "52ND"},
+    {"FORTY FIRST", 11, "41ST"},
+    {NULL, 0, NULL},
+    {"TWENTYEIGHTH", 12, "28TH"},
+    {NULL, 0, NULL},
+    {"FIFTY-SECOND", 12, "52ND"},
+    {NULL, 0, NULL},
+    {"SIXTY THIRD", 11, "63RD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FORTY-THIRD", 11, "43RD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FORTYFIRST", 10, "41ST"},
+    {"EIGHTY-SEVENTH", 14, "87TH"},
+    {NULL, 0, NULL},
+    {"FORTYSECOND", 11, "42ND"},
+    {NULL, 0, NULL},
+    {"NINETY-FIFTH", 12, "95TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TWENTIETH", 9, "20TH"},
+    {NULL, 0, NULL},
+    {"THIRTY-EIGHTH", 13, "38TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NINETYFIRST", 11, "91ST"},
+    {"FORTY SIXTH", 11, "46TH"},
+    {NULL, 0, NULL},
+    {"THIRTY-FIFTH", 12, "35TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EIGHTY SEVENTH", 14, "87TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TWENTY FIFTH", 12, "25TH"},
+    {NULL, 0, NULL},
+    {"NINETYSECOND", 12, "92ND"},
+    {"EIGHTY-SECOND", 13, "82ND"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SEVENTYSIXTH", 12, "76TH"},
+    {NULL, 0, NULL},
+    {"SIXTY-FIRST", 11, "61ST"},
+    {"TWENTY NINTH", 12, "29TH"},
+    {"NINETY-SECOND", 13, "92ND"},
+    {"NINETY FOURTH", 13, "94TH"},
+    {"SIXTY-SECOND", 12, "62ND"},
+    {"SIXTYTHIRD", 10, "63RD"},
+    {NULL, 0, NULL},
+    {"SECOND", 6, "2ND"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TWENTY-FIFTH", 12, "25TH"},
+    {"SIXTY-EIGHTH", 12, "68TH"},
+    {NULL, 0, NULL},
+    {"NINETY-THIRD", 12, "93RD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SIXTEENTH", 9, "16TH"},
+    {"FIFTY FOURTH", 12, "54TH"},
+    {NULL, 0, NULL},
+    {"NINETYNINTH", 11, "99TH"},
+    {"FIRST", 5, "1ST"},
+    {"TWENTYFOURTH", 12, "24TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NINETY-EIGHTH", 13, "98TH"},
+    {NULL, 0, NULL},
+    {"FORTY THIRD", 11, "43RD"},
+    {"NINETY THIRD", 12, "93RD"},
+    {"THIRTY EIGHTH", 13, "38TH"},
+    {"SIXTH", 5, "6TH"},
+    {NULL, 0, NULL},
+    {"EIGHTY-SIXTH", 12, "86TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EIGHTYSIXTH", 11, "86TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FORTY FOURTH", 12, "44TH"},
+    {"SIXTYNINTH", 10, "69TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TWENTYSECOND", 12, "22ND"},
+    {"SEVENTYFOURTH", 13, "74TH"},
+    {"EIGHTY EIGHTH", 13, "88TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EIGHTY-FIRST", 12, "81ST"},
+    {"EIGHTYSECOND", 12, "82ND"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SEVENTYTHIRD", 12, "73RD"},
+    {"TWENTY SEVENTH", 14, "27TH"},
+    {"EIGHTY SECOND", 13, "82ND"},
+    {"THIRTY NINTH", 12, "39TH"},
+    {"SIXTY FIFTH", 11, "65TH"},
+    {"THIRTY FIFTH", 12, "35TH"},
+    {"EIGHTIETH", 9, "80TH"},
+    {"EIGHTY THIRD", 12, "83RD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SEVENTYSECOND", 13, "72ND"},
+    {NULL, 0, NULL},
+    {"EIGHTY-FOURTH", 13, "84TH"},
+    {"FORTY FIFTH", 11, "45TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NINETY-FOURTH", 13, "94TH"},
+    {"TWENTYSEVENTH", 13, "27TH"},
+    {"SEVENTY SEVENTH", 15, "77TH"},
+    {"TWENTY FOURTH", 13, "24TH"},
+    {NULL, 0, NULL},
+    {"EIGHTYFIRST", 11, "81ST"},
+    {"EIGHTY-THIRD", 12, "83RD"},
+    {"THIRD", 5, "3RD"},
+    {"SEVENTY-NINTH", 13, "79TH"},
+    {NULL, 0, NULL},
+    {"FIFTYFIRST", 10, "51ST"},
+    {NULL, 0, NULL},
+    {"THIRTY THIRD", 12, "33RD"},
+    {"NINETY SIXTH", 12, "96TH"},
+    {"FORTY SECOND", 12, "42ND"},
+    {"NINETY-NINTH", 12, "99TH"},
+    {"SIXTY-THIRD", 11, "63RD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FORTY NINTH", 11, "49TH"},
+    {NULL, 0, NULL},
+    {"NINETYSEVENTH", 13, "97TH"},
+    {"SEVENTY SIXTH", 13, "76TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FIFTY-FOURTH", 12, "54TH"},
+    {"EIGHTY SIXTH", 12, "86TH"},
+    {"NINETY-SEVENTH", 14, "97TH"},
+    {"THIRTY-NINTH", 12, "39TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"THIRTY-SEVENTH", 14, "37TH"},
+    {"FORTYSIXTH", 10, "46TH"},
+    {"TWENTYFIFTH", 11, "25TH"},
+    {NULL, 0, NULL},
+    {"TWENTY FIRST", 12, "21ST"},
+    {"SIXTY SEVENTH", 13, "67TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FIFTY FIRST", 11, "51ST"},
+    {"FIFTY NINTH", 11, "59TH"},
+    {"SIXTY-SEVENTH", 13, "67TH"},
+    {"EIGHTY-NINTH", 12, "89TH"},
+    {"THIRTYFIFTH", 11, "35TH"},
+    {"FIFTYFOURTH", 11, "54TH"},
+    {"EIGHTYTHIRD", 11, "83RD"},
+    {NULL, 0, NULL},
+    {"FIFTIETH", 8, "50TH"},
+    {NULL, 0, NULL},
+    {"THIRTYNINTH", 11, "39TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"THIRTY-FOURTH", 13, "34TH"},
+    {NULL, 0, NULL},
+    {"FIFTYTHIRD", 10, "53RD"},
+    {"SEVENTYFIFTH", 12, "75TH"},
+    {"FIFTYSEVENTH", 12, "57TH"},
+    {NULL, 0, NULL},
+    {"TWENTY-FIRST", 12, "21ST"},
+    {NULL, 0, NULL},
+    {"TWENTY SIXTH", 12, "26TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TWENTY-SIXTH", 12, "26TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SEVENTYEIGHTH", 13, "78TH"},
+    {"THIRTYTHIRD", 11, "33RD"},
+    {"TWENTY-NINTH", 12, "29TH"},
+    {NULL, 0, NULL},
+    {"SIXTYFIFTH", 10, "65TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FORTY-SEVENTH", 13, "47TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FORTYNINTH", 10, "49TH"},
+    {"FIFTH", 5, "5TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EIGHTY NINTH", 12, "89TH"},
+    {NULL, 0, NULL},
+    {"TWENTY-SECOND", 13, "22ND"},
+    {NULL, 0, NULL},
+    {"FORTY EIGHTH", 12, "48TH"},
+    {NULL, 0, NULL},
+    {"EIGHTYSEVENTH", 13, "87TH"},
+    {NULL, 0, NULL},
+    {"TWENTYNINTH", 11, "29TH"},
+    {NULL, 0, NULL},
+    {"NINETY-FIRST", 12, "91ST"},
+    {NULL, 0, NULL},
+    {"FIFTY-EIGHTH", 12, "58TH"},
+    {"FIFTY-NINTH", 11, "59TH"},
+    {NULL, 0, NULL},
+    {"EIGHTH", 6, "8TH"},
+    {"TWENTYSIXTH", 11, "26TH"},
+    {NULL, 0, NULL},
+    {"FORTY-FIRST", 11, "41ST"},
+    {NULL, 0, NULL},
+    {"SEVENTYFIRST", 12, "71ST"},
+    {NULL, 0, NULL},
+    {"FORTYFIFTH", 10, "45TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SEVENTY-THIRD", 13, "73RD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SIXTYSIXTH", 10, "66TH"},
+    {NULL, 0, NULL},
+    {"SEVENTY NINTH", 13, "79TH"},
+    {"TENTH", 5, "10TH"},
+    {"FIFTY EIGHTH", 12, "58TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TWENTY-THIRD", 12, "23RD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FORTYEIGHTH", 11, "48TH"},
+    {"NINTH", 5, "9TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FOURTH", 6, "4TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SIXTY NINTH", 11, "69TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FORTYFOURTH", 11, "44TH"},
+    {NULL, 0, NULL},
+    {"SIXTYEIGHTH", 11, "68TH"},
+    {NULL, 0, NULL},
+    {"TWENTY THIRD", 12, "23RD"},
+    {NULL, 0, NULL},
+    {"SEVENTEENTH", 11, "17TH"},
+    {"THIRTY-SIXTH", 12, "36TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EIGHTY FIFTH", 12, "85TH"},
+    {"TWENTY EIGHTH", 13, "28TH"},
+    {"FORTYSEVENTH", 12, "47TH"},
+    {NULL, 0, NULL},
+    {"SIXTYSECOND", 11, "62ND"},
+    {NULL, 0, NULL},
+    {"NINETYTHIRD", 11, "93RD"},
+    {NULL, 0, NULL},
+    {"SEVENTY-SECOND", 14, "72ND"},
+    {"FIFTYSIXTH", 10, "56TH"},
+    {"ELEVENTH", 8, "11TH"},
+    {"THIRTYSEVENTH", 13, "37TH"},
+    {NULL, 0, NULL},
+    {"TWENTYTHIRD", 11, "23RD"},
+    {NULL, 0, NULL},
+    {"SEVENTY-SEVENTH", 15, "77TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SIXTY FOURTH", 12, "64TH"},
+    {NULL, 0, NULL},
+    {"SIXTYSEVENTH", 12, "67TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SEVENTY-EIGHTH", 14, "78TH"},
+    {"SIXTY EIGHTH", 12, "68TH"},
+    {"FIFTYNINTH", 10, "59TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NINETY FIRST", 12, "91ST"},
+    {"FORTY-SIXTH", 11, "46TH"},
+    {"FORTY-FOURTH", 12, "44TH"},
+    {"THIRTYFIRST", 11, "31ST"},
+    {"SIXTIETH", 8, "60TH"},
+    {"SEVENTY-FIFTH", 13, "75TH"},
+    {"FIFTYFIFTH", 10, "55TH"},
+    {"NINETY EIGHTH", 13, "98TH"},
+    {"THIRTY-THIRD", 12, "33RD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SIXTYFIRST", 10, "61ST"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SIXTY-FIFTH", 11, "65TH"},
+    {NULL, 0, NULL},
+    {"SEVENTH", 7, "7TH"},
+    {NULL, 0, NULL},
+    {"EIGHTEENTH", 10, "18TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FIFTEENTH", 9, "15TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SEVENTY FOURTH", 14, "74TH"},
+    {"THIRTYSECOND", 12, "32ND"},
+    {"SEVENTY-FIRST", 13, "71ST"},
+    {"THIRTEENTH", 10, "13TH"},
+    {"THIRTY SIXTH", 12, "36TH"},
+    {NULL, 0, NULL},
+    {"SEVENTIETH", 10, "70TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EIGHTYNINTH", 11, "89TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SIXTY SECOND", 12, "62ND"},
+    {"THIRTY SECOND", 13, "32ND"},
+    {NULL, 0, NULL},
+    {"FORTY SEVENTH", 13, "47TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"NINETY FIFTH", 12, "95TH"},
+    {"FIFTY-FIFTH", 11, "55TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SIXTY FIRST", 11, "61ST"},
+    {NULL, 0, NULL},
+    {"EIGHTYFIFTH", 11, "85TH"},
+    {"NINETY SECOND", 13, "92ND"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EIGHTYFOURTH", 12, "84TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"THIRTIETH", 9, "30TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"SEVENTY FIRST", 13, "71ST"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"TWELFTH", 7, "12TH"},
+    {"NINETYEIGHTH", 12, "98TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FOURTEENTH", 10, "14TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FIFTY THIRD", 11, "53RD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"THIRTY FOURTH", 13, "34TH"},
+    {"THIRTYSIXTH", 11, "36TH"},
+    {NULL, 0, NULL},
+    {"NINETEENTH", 10, "19TH"},
+    {"FIFTY-SEVENTH", 13, "57TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FIFTY SIXTH", 11, "56TH"},
+    {"SIXTY-FOURTH", 12, "64TH"},
+    {NULL, 0, NULL},
+    {"THIRTY SEVENTH", 14, "37TH"},
+    {"SEVENTY FIFTH", 13, "75TH"},
+    {NULL, 0, NULL},
+    {"SEVENTY THIRD", 13, "73RD"},
+    {"NINETYFOURTH", 12, "94TH"},
+    {NULL, 0, NULL},
+    {"EIGHTY-FIFTH", 12, "85TH"},
+    {"SEVENTY-FOURTH", 14, "74TH"},
+    {"FIFTY SEVENTH", 13, "57TH"},
+    {"FORTYTHIRD", 10, "43RD"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"EIGHTY FIRST", 12, "81ST"},
+    {"TWENTY-FOURTH", 13, "24TH"},
+    {NULL, 0, NULL},
+    {"THIRTYFOURTH", 12, "34TH"},
+    {"EIGHTY-EIGHTH", 13, "88TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FIFTYEIGHTH", 11, "58TH"},
+    {"NINETYSIXTH", 11, "96TH"},
+    {NULL, 0, NULL},
+    {NULL, 0, NULL},
+    {"FORTY-SECOND", 12, "42ND"},
+};
+
+static const uint16_t usps_ordinals_displacements[64] = {
+    0, 0, 0, 4, 1, 1, 2, 0, 0, 1,
+    0, 0, 1, 8, 8, 1, 0, 2, 0, 0,
+    2, 0, 0, 4, 1, 0, 0, 9, 0, 1,
+    4, 1, 4, 0, 2, 2, 0, 0, 2, 2,
+    1, 0, 1, 9, 1, 2, 7, 0, 1, 1,
+    3, 0, 0, 1, 0, 6, 2, 5, 4, 1,
+    1, 1, 8, 0,
+};
+
+static const PerfectHashTable usps_ordinals = {
+    .slots = usps_ordinals_slots,
+    .displacements = usps_ordinals_displacements,
+    .slot_mask = 511,
+    .bucket_mask = 63,
+    .max_key_len = 15,
+};
+
+#endif
@@ -121,5 +121,243 @@ SELECT crf_full_address_normalized('123 Main Street, Chicago, IL 60601');
 -- Test 30: Full normalized with suite
 SELECT crf_full_address_normalized('100 North Michigan Avenue, Suite 200, Chicago, IL 60611');
 
+-- =====================================================
+-- Section 8: Set-Returning Call Contexts
+-- =====================================================
+
+-- Test 31: Lateral join over several rows
+SELECT a.id, p.token, p.label
+FROM (VALUES (1, '123 Main Street'),
+             (2, 'PO Box 1234, Los Angeles, CA 90001')) AS a(id, address),
+     LATERAL parse_address_crf(a.address) p;
+
+-- Test 32: Called in the select list
+SELECT parse_address_crf('123 Main Street');
+
+-- =====================================================
+-- Section 9: Full Address Normalization Edge Cases
+-- =====================================================
+
+-- Test 33: No comma after the city when there is no state
+SELECT crf_full_address_normalized('456 Oak Avenue, Chicago');
+
+-- =====================================================
+-- Section 10: Column Parsing Memoization
+-- =====================================================
+
+-- The parse cache would also absorb repeated tagging here; disable it
+-- so the counts reflect the memo alone.
+SET pg_usaddress.cache_size = 0;
+-- Test 34: Field access tags each row once
+SELECT pg_usaddress_tag_calls() AS calls_before \gset
+SELECT (parse_address_crf_cols(a)).address_number,
+       (parse_address_crf_cols(a)).street_name,
+       (parse_address_crf_cols(a)).zip_code
+FROM (VALUES ('456 Oak Avenue, Chicago, IL 60601'),
+             ('100 North Michigan Avenue, Suite 200, Chicago, IL 60611')) AS v(a);
+SELECT pg_usaddress_tag_calls() - :calls_before AS tag_calls;
+
+-- Test 35: Star expansion over all 21 columns tags each row once
+SELECT pg_usaddress_tag_calls() AS calls_before \gset
+WITH parsed AS MATERIALIZED (
+  SELECT (parse_address_crf_cols(a)).*
+  FROM (VALUES ('456 Oak Avenue, Chicago, IL 60601'),
+               ('100 North Michigan Avenue, Suite 200, Chicago, IL 60611')) AS v(a)
+)
+SELECT count(*) FROM parsed;
+SELECT pg_usaddress_tag_calls() - :calls_before AS tag_calls;
+
+RESET pg_usaddress.cache_size;
+
+-- =====================================================
+-- Section 11: Parse Cache
+-- =====================================================
+
+-- Test 36: Repeated input is tagged once across entry points
+SELECT hits AS hits_before, misses AS misses_before FROM pg_usaddress_cache_stats() \gset
+SELECT pg_usaddress_tag_calls() AS calls_before \gset
+SELECT count(*) FROM parse_address_crf('742 Evergreen Terrace, Springfield, IL 62704');
+SELECT count(*) FROM parse_address_crf_normalized('742 Evergreen Terrace, Springfield, IL 62704');
+SELECT (parse_address_crf_cols('742 Evergreen Terrace, Springfield, IL 62704')).zip_code;
+SELECT hits - :hits_before AS hits, misses - :misses_before AS misses,
+       pg_usaddress_tag_calls() - :calls_before AS tag_calls
+FROM pg_usaddress_cache_stats();
+
+-- Test 37: Cached results match a fresh tagging
+SELECT tag_address_crf('742 Evergreen Terrace, Springfield, IL 62704') AS cached \gset
+SET pg_usaddress.cache_size = 0;
+SELECT tag_address_crf('742 Evergreen Terrace, Springfield, IL 62704') = :'cached'::jsonb AS same;
+RESET pg_usaddress.cache_size;
+
+-- Test 38: The cache holds at most pg_usaddress.cache_size entries
+SET pg_usaddress.cache_size = 2;
+SELECT evictions AS evictions_before FROM pg_usaddress_cache_stats() \gset
+SELECT count(*)
+FROM (VALUES ('1 Main St'), ('2 Main St'), ('3 Main St')) AS v(a),
+     LATERAL parse_address_crf(v.a);
+SELECT entries, evictions > :evictions_before AS evicted FROM pg_usaddress_cache_stats();
+RESET pg_usaddress.cache_size;
+
+-- Test 39: The shared cache needs shared_preload_libraries; it is off here
+SELECT slots, hits FROM pg_usaddress_shared_cache_stats();
+
+-- =====================================================
+-- Section 12: Statistics
+-- =====================================================
+
+-- Test 40: Calls, tagged tokens, cache hits and phase timings are counted
+SELECT pg_usaddress_stats_reset() IS NOT NULL AS reset;
+SELECT count(*) FROM parse_address_crf('9 Elm Street, Dayton, OH 45402');
+SELECT crf_full_address_normalized('9 Elm Street, Dayton, OH 45402');
+SELECT parse_address_crf_calls, crf_full_address_normalized_calls,
+       tokens_tagged, cache_hits,
+       viterbi_ns > 0 AS viterbi_timed, output_ns > 0 AS output_timed
+FROM pg_usaddress_stats;
+
+-- Test 41: Latency histograms are kept per function and token count class
+SELECT pg_usaddress_stats_reset() IS NOT NULL AS reset;
+SELECT count(*) FROM parse_address_crf('9 Elm Street, Dayton, OH 45402');
+SELECT count(*) FROM parse_address_crf('100 North Michigan Avenue, Suite 200, Chicago, IL 60611');
+SELECT count(*) FROM parse_address_crf_batch(ARRAY[NULL]::text[]);
+SELECT function_name, min_tokens, max_tokens, sum(count) AS calls,
+       bool_and(lower_ns < upper_ns) AS ordered
+FROM pg_usaddress_latency_histogram()
+GROUP BY 1, 2, 3 ORDER BY 1, 2;
+
+-- Test 42: Slow parse logging settings; a zero sample rate logs nothing
+SET pg_usaddress.log_min_duration = '2s';
+SHOW pg_usaddress.log_min_duration;
+SET pg_usaddress.log_min_duration = 0;
+SET pg_usaddress.log_sample_rate = 0;
+SET client_min_messages = log;
+SELECT count(*) FROM parse_address_crf('9 Elm Street, Dayton, OH 45402');
+RESET client_min_messages;
+RESET pg_usaddress.log_sample_rate;
+RESET pg_usaddress.log_min_duration;
+SHOW pg_usaddress.log_min_duration;
+
+-- Test 43: pg_usaddress_explain reports features, scores and timings
+SELECT jsonb_array_length(e->'tokens') AS tokens,
+       (e->>'resolved_features')::int AS resolved,
+       (e->>'dropped_features')::int AS dropped,
+       (e->>'viterbi_score')::float8 > 0 AS scored
+FROM pg_usaddress_explain('9 Elm Street, Dayton, OH 45402') AS e;
+SELECT e->'tokens'->0->>'label' AS label,
+       e->'tokens'->0->'features' AS features,
+       (SELECT count(*) FROM jsonb_object_keys(e->'tokens'->0->'state_scores')) AS labels,
+       (SELECT string_agg(k, ',' ORDER BY k) FROM jsonb_object_keys(e->'timing_ns') AS k) AS phases
+FROM pg_usaddress_explain('9 Elm Street, Dayton, OH 45402') AS e;
+
+-- Test 44: Inputs over the size limits are rejected, truncated or split
+SET pg_usaddress.max_input_bytes = 20;
+SELECT * FROM parse_address_crf('9 Elm Street, Dayton, OH 45402');
+SELECT pg_usaddress_explain('9 Elm Street, Dayton, OH 45402');
+SET pg_usaddress.overflow_action = 'truncate';
+SELECT * FROM parse_address_crf('9 Elm Street, Dayton, OH 45402');
+SELECT string_agg(t->>'label', ' ') AS labels
+FROM jsonb_array_elements(pg_usaddress_explain('9 Elm Street, Dayton, OH 45402')->'tokens') AS t
+WHERE t->>'token' <> ',';
+RESET pg_usaddress.max_input_bytes;
+SET pg_usaddress.max_tokens = 4;
+SET pg_usaddress.overflow_action = 'split';
+SELECT * FROM parse_address_crf('9 Elm Street, Dayton, OH 45402');
+SELECT string_agg(t->>'label', ' ') AS labels
+FROM jsonb_array_elements(pg_usaddress_explain('9 Elm Street, Dayton, OH 45402')->'tokens') AS t
+WHERE t->>'token' <> ',';
+RESET pg_usaddress.max_tokens;
+RESET pg_usaddress.overflow_action;
+CREATE ROLE regress_pg_usaddress_user;
+SET ROLE regress_pg_usaddress_user;
+SET pg_usaddress.max_tokens = 4;
+SET pg_usaddress.overflow_action = 'split';
+RESET ROLE;
+DROP ROLE regress_pg_usaddress_user;
+
+-- Test 45: Tokens follow the usaddress regex, including non-ASCII letters
+SELECT string_agg(token, '|') = '12|Peñasco|Rd|,|Côte|Blanche|LA' AS utf8_tokens
+FROM parse_address_crf('12 Peñasco Rd, Côte Blanche LA');
+SELECT string_agg(token, '|') AS tokens
+FROM parse_address_crf('12 Oak_Hill Rd.,Apt#4');
+
+-- Test 46: State names, directionals, ordinals and PO boxes are normalized
+SELECT crf_full_address_normalized(a)
+FROM (VALUES ('1200 West Fifth Street Apt 4, Austin, Texas 78703'),
+             ('350 Twenty-First Ave SW, Miami, Florida 33135')) AS v(a);
+SELECT * FROM parse_address_crf_normalized('P.O. Box 1234, Springfield, IL 62704');
+
+-- Test 47: Token words resolve through the per-backend token cache
+SET pg_usaddress.cache_size = 0;
+SET pg_usaddress.token_cache_size = 0;
+SELECT string_agg(label, ' ') AS uncached_labels
+FROM parse_address_crf('9 Elm Street, Dayton, OH 45402') \gset
+SET pg_usaddress.token_cache_size = 16;
+SELECT pg_usaddress_stats_reset() IS NOT NULL AS reset;
+SELECT count(*) FROM parse_address_crf('9 Elm Street, Dayton, OH 45402');
+SELECT string_agg(label, ' ') = :'uncached_labels' AS same_labels
+FROM parse_address_crf('9 Elm Street, Dayton, OH 45402');
+SELECT token_cache_hits, token_cache_misses FROM pg_usaddress_stats;
+RESET pg_usaddress.token_cache_size;
+RESET pg_usaddress.cache_size;
+
+-- Test 48: Repeated tokens take their state scores from the state cache
+SET pg_usaddress.cache_size = 0;
+SET pg_usaddress.state_cache_size = '64kB';
+SELECT pg_usaddress_stats_reset() IS NOT NULL AS reset;
+SELECT count(*) FROM parse_address_crf('9 Elm Street, Dayton, OH 45402');
+SELECT count(*) FROM parse_address_crf('9 Elm Street, Dayton, OH 45402');
+SELECT state_cache_hits, state_cache_misses FROM pg_usaddress_stats;
+RESET pg_usaddress.state_cache_size;
+RESET pg_usaddress.cache_size;
+
+-- Test 49: Batch parsing gives each address the labels it gets alone
+SET pg_usaddress.cache_size = 0;
+SELECT pg_usaddress_stats_reset() IS NOT NULL AS reset;
+SELECT address_index, string_agg(token, ' ') AS tokens
+FROM parse_address_crf_batch(ARRAY['9 Elm Street, Dayton, OH 45402', NULL,
+                                   '12 Oak Avenue, Dayton, OH 45402'])
+GROUP BY address_index ORDER BY address_index;
+SELECT parse_address_crf_batch_calls, tokens_tagged FROM pg_usaddress_stats;
+WITH input(addrs) AS (
+  SELECT ARRAY['9 Elm Street, Dayton, OH 45402',
+               '12 Oak Avenue, Dayton, OH 45402',
+               '100 North Michigan Avenue, Suite 200, Chicago, IL 60611',
+               'PO Box 123, Chicago, IL 60611']
+)
+SELECT b.address_index,
+       b.labels = (SELECT string_agg(label, ' ')
+                   FROM parse_address_crf(addrs[b.address_index])) AS same_labels
+FROM input,
+     LATERAL (SELECT address_index, string_agg(label, ' ') AS labels
+              FROM parse_address_crf_batch(addrs) GROUP BY address_index) b
+ORDER BY b.address_index;
+SELECT count(*) FROM parse_address_crf_batch('{}');
+RESET pg_usaddress.cache_size;
+SELECT count(*) FROM parse_address_crf_batch(ARRAY['9 Elm Street, Dayton, OH 45402', '']);
+SELECT count(*) FROM parse_address_crf_batch(ARRAY['   ']);
+SELECT count(*) FROM parse_address_crf('');
+
+-- Test 50: Superusers can check the model against the fast path
+SET pg_usaddress.cache_size = 0;
+SET pg_usaddress.fast_path = on;
+SET pg_usaddress.fast_path = verify;
+SELECT pg_usaddress_stats_reset() IS NOT NULL AS reset;
+SELECT string_agg(label, ' ') AS labels
+FROM parse_address_crf('9 Elm Street, Dayton, OH 45402');
+SELECT count(*) FROM parse_address_crf('9 Elm Street, Apt 4, Dayton, OH 45402');
+SELECT tokens_tagged, fast_path_matches, fast_path_mismatches
+FROM pg_usaddress_stats;
+RESET pg_usaddress.fast_path;
+RESET pg_usaddress.cache_size;
+CREATE ROLE regress_pg_usaddress_user;
+SET ROLE regress_pg_usaddress_user;
+SET pg_usaddress.fast_path = verify;
+RESET ROLE;
+DROP ROLE regress_pg_usaddress_user;
+
+-- Test 51: Non-ASCII words get the same features as in the training script
+SELECT t->>'token' AS token, t->'features' AS features
+FROM jsonb_array_elements(pg_usaddress_explain('12 PEÑASCO Rd, Côte Blanche LA')->'tokens') AS t
+WHERE t->>'token' IN ('PEÑASCO', 'Côte');
+
 -- Clean up
 DROP EXTENSION pg_usaddress;
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""
+Generate src/unicode_classes.h, the character classes used by the C
+tokenizer and feature extractor.
+
+The tokenizer splits input the way the usaddress regex \\w+|[^\\w\\s]+ does,
+so each code point is classified with Python's own re module: whitespace
+(\\s), word (\\w) or punctuation (anything else). The output holds a table for
+ASCII and a sorted list of the ranges above it.
+
+The word features of the training script use str.lower(), str.isalpha(),
+str.isdigit() and str.isupper(), so the code points above ASCII also get a
+sorted list of ranges with those properties and the offset to their
+lowercase form, plus the few whose lowercase form is longer. str.lower() turns
+a capital sigma that ends a word into a final sigma, and whether it does
+depends on which characters are cased or case-ignorable; Python does not
+expose those two properties, so they are read off that same behaviour.
+
+Usage:
+    python3 tools/gen_unicode_classes.py > src/unicode_classes.h
+
+The tables follow the Unicode version of the Python that runs this script.
+"""
+
+import re
+import sys
+import unicodedata
+
+SPACE = re.compile(r'\s')
+WORD = re.compile(r'\w')
+
+CLASS_NAMES = ('CHAR_SPACE', 'CHAR_WORD', 'CHAR_PUNCT')
+
+PROP_NAMES = ('CHAR_IS_ALPHA', 'CHAR_IS_DIGIT', 'CHAR_IS_UPPER',
+              'CHAR_IS_LOWER_OR_TITLE', 'CHAR_IS_CASED',
+              'CHAR_IS_CASE_IGNORABLE')
+
+FINAL_SIGMA = '\u03c2'
+
+
+def char_class(cp):
+    # Surrogates never appear in valid UTF-8
+    if 0xD800 <= cp <= 0xDFFF:
+        return 2
+    ch = chr(cp)
+    if SPACE.match(ch):
+        return 0
+    if WORD.match(ch):
+        return 1
+    return 2
+
+
+def char_props(cp):
+    """The properties of a code point and the offset to its lowercase form."""
+    if 0xD800 <= cp <= 0xDFFF:
+        return 0, 0
+    ch = chr(cp)
+    lower = ch.lower()
+    # A sigma after ch is final if ch is cased and not case-ignorable; one
+    # after 'A' and ch, or before ch, is final if ch is case-ignorable
+    cased = ('%s\u03a3' % ch).lower().endswith(FINAL_SIGMA)
+    ignorable = (not cased and
+                 ('A%s\u03a3' % ch).lower().endswith(FINAL_SIGMA) and
+                 ('A\u03a3%s' % ch).lower()[1] == FINAL_SIGMA)
+    # str.istitle() is also true of a lone uppercase letter
+    flags = (ch.isalpha(), ch.isdigit(), ch.isupper(),
+             ch.islower() or unicodedata.category(ch) == 'Lt', cased,
+             ignorable)
+    props = sum(1 << i for i, flag in enumerate(flags) if flag)
+    return props, ord(lower) - cp if len(lower) == 1 else 0
+
+
+def c_string(s):
+    return '"%s"' % ''.join('\\x%02x' % b for b in s.encode('utf-8'))
+
+
+def main():
+    out = sys.stdout
+    out.write('/*\n')
+    out.write(' * Character classes of the tokenizer, as the Python re module '
+              'sees them\n')
+    out.write(' * (Unicode %s).\n' % unicodedata.unidata_version)
+    out.write(' *\n')
+    out.write(' * Generated by tools/gen_unicode_classes.py; do not edit.\n')
+    out.write(' */\n')
+    out.write('#ifndef UNICODE_CLASSES_H\n#define UNICODE_CLASSES_H\n\n')
+    out.write('#include <stdint.h>\n\n')
+    out.write('typedef enum { CHAR_SPACE, CHAR_WORD, CHAR_PUNCT } CharClass;\n\n')
+
+    out.write('static const uint8_t ascii_char_class[128] = {\n')
+    for row in range(0, 128, 4):
+        cells = ', '.join(CLASS_NAMES[char_class(cp)]
+                          for cp in range(row, row + 4))
+        out.write('    %s,\n' % cells)
+    out.write('};\n\n')
+
+    ranges = []
+    prev = None
+    for cp in range(0x80, 0x110000):
+        c = char_class(cp)
+        if c != prev:
+            ranges.append((cp, c))
+            prev = c
+
+    out.write('/* Code points from first up to the next entry have class cls */\n')
+    out.write('static const struct {\n  uint32_t first;\n  uint8_t cls;\n}'
+              ' unicode_char_ranges[%d] = {\n' % len(ranges))
+    for row in range(0, len(ranges), 3):
+        cells = ' '.join('{0x%04X, %s},' % (first, CLASS_NAMES[c])
+                         for first, c in ranges[row:row + 3])
+        out.write('    %s\n' % cells)
+    out.write('};\n\n')
+
+    out.write('/* Properties of a character, as Python\'s str methods see them '
+              '*/\n')
+    out.write('#define CHAR_IS_ALPHA 1 /* isalpha() */\n')
+    out.write('#define CHAR_IS_DIGIT 2 /* isdigit() */\n')
+    out.write('#define CHAR_IS_UPPER 4 /* isupper() */\n')
+    out.write('/* islower() or titlecase (Lt), which keep a string from being '
+              'isupper() */\n')
+    out.write('#define CHAR_IS_LOWER_OR_TITLE 8\n')
+    out.write('/* For the final sigma of str.lower() */\n')
+    out.write('#define CHAR_IS_CASED 16\n')
+    out.write('#define CHAR_IS_CASE_IGNORABLE 32\n\n')
+
+    out.write('static const uint8_t ascii_char_props[128] = {\n')
+    for row in range(0, 128, 8):
+        cells = ', '.join('%d' % char_props(cp)[0]
+                          for cp in range(row, row + 8))
+        out.write('    %s,\n' % cells)
+    out.write('};\n\n')
+
+    ranges = []
+    prev = None
+    for cp in range(0x80, 0x110000):
+        props = char_props(cp)
+        if props != prev:
+            ranges.append((cp,) + props)
+            prev = props
+
+    out.write('/*\n * Code points from first up to the next entry have the '
+              'properties props, and\n * lowercase to the code point '
+              'lower_delta away, unless listed in\n * unicode_long_lowercase.'
+              '\n */\n')
+    out.write('static const struct {\n  uint32_t first;\n  uint8_t props;\n'
+              '  int32_t lower_delta;\n} unicode_case_ranges[%d] = {\n'
+              % len(ranges))
+    for row in range(0, len(ranges), 3):
+        cells = ' '.join('{0x%04X, %d, %d},' % r for r in ranges[row:row + 3])
+        out.write('    %s\n' % cells)
+    out.write('};\n\n')
+
+    longer = [(cp, chr(cp).lower()) for cp in range(0x80, 0x110000)
+              if not 0xD800 <= cp <= 0xDFFF and len(chr(cp).lower()) > 1]
+    out.write('/* Code points whose lowercase form is more than one code '
+              'point, in UTF-8 */\n')
+    out.write('static const struct {\n  uint32_t cp;\n  const char *lower;\n}'
+              ' unicode_long_lowercase[%d] = {\n' % len(longer))
+    for cp, lower in longer:
+        out.write('    {0x%04X, %s},\n' % (cp, c_string(lower)))
+    out.write('};\n\n#endif\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""
+Generate src/usps_tables.h, the USPS abbreviation lookup tables.
+
+Each table file in tools/usps/ lists one INPUT,OUTPUT pair per line, mostly
+taken from USPS Publication 28. An input may be several words, separated by
+single spaces, as the normalizer joins the tokens of a component. Every
+table is emitted as a perfect hash, so that perfect_hash_lookup() in
+src/perfect_hash.h finds a word with one hash and one key comparison. Keys
+are stored uppercase, which is how the lookup folds the word.
+
+Usage:
+    python3 tools/gen_usps_tables.py > src/usps_tables.h
+
+Rerun it (or "make update-tables") after editing the table files.
+"""
+
+import os
+import sys
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+
+
+def outputs(pairs):
+    """The distinct OUTPUTs of a table, each mapped to itself."""
+    values = dict.fromkeys(value for _, value in pairs)
+    return [(value.upper(), value) for value in values]
+
+
+# (C name, table file, function of its pairs or None)
+TABLES = [
+    ('direction_words', 'direction_words.csv', None),
+    ('usps_directionals', 'directionals.csv', None),
+    ('usps_street_suffixes', 'street_suffixes.csv', None),
+    ('usps_secondary_units', 'secondary_units.csv', None),
+    ('usps_states', 'states.csv', None),
+    ('usps_state_codes', 'states.csv', outputs),
+    ('usps_box_types', 'box_types.csv', None),
+    ('usps_ordinals', 'ordinals.csv', None),
+]
+
+MAX_KEY_LEN = 32  # PERFECT_HASH_MAX_KEY_LEN
+
+
+def fnv1a(key):
+    h = 2166136261
+    for c in key.encode('ascii'):
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def mix(h):
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xc2b2ae35) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h
+
+
+def next_pow2(n):
+    p = 1
+    while p < n:
+        p *= 2
+    return p
+
+
+def read_table(filename):
+    pairs = []
+    seen = set()
+    with open(os.path.join(TOOLS_DIR, 'usps', filename)) as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            fields = [' '.join(field.split()) for field in line.split(',')]
+            if len(fields) != 2 or not fields[0] or not fields[1]:
+                sys.exit('%s:%d: expected INPUT,OUTPUT' % (filename, lineno))
+            key, value = fields[0].upper(), fields[1]
+            if key in seen:
+                sys.exit('%s:%d: duplicate input %s' % (filename, lineno, key))
+            if len(key) > MAX_KEY_LEN:
+                sys.exit('%s:%d: input longer than %d bytes'
+                         % (filename, lineno, MAX_KEY_LEN))
+            seen.add(key)
+            pairs.append((key, value))
+    return pairs
+
+
+def build(pairs):
+    """Returns (slots, displacements) of a hash-and-displace table."""
+    num_slots = next_pow2(2 * len(pairs))
+    num_buckets = next_pow2(max(1, len(pairs) // 4))
+    hashes = [fnv1a(key) for key, _ in pairs]
+    if len(set(hashes)) != len(hashes):
+        sys.exit('FNV-1a collision between two keys; change the hash')
+
+    buckets = [[] for _ in range(num_buckets)]
+    for i, h in enumerate(hashes):
+        buckets[h & (num_buckets - 1)].append(i)
+
+    slots = [None] * num_slots
+    displacements = [0] * num_buckets
+    # Place the fullest buckets first, while there is most room
+    for b in sorted(range(num_buckets), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        for d in range(1 << 16):
+            wanted = [mix(hashes[i] ^ d) & (num_slots - 1) for i in buckets[b]]
+            if (len(set(wanted)) == len(wanted)
+                    and all(slots[s] is None for s in wanted)):
+                break
+        else:
+            sys.exit('no displacement fits bucket %d' % b)
+        displacements[b] = d
+        for i, s in zip(buckets[b], wanted):
+            slots[s] = pairs[i]
+    return slots, displacements
+
+
+def c_string(s):
+    return '"%s"' % s.replace('\\', '\\\\').replace('"', '\\"')
+
+
+def main():
+    out = sys.stdout
+    out.write('/*\n')
+    out.write(' * USPS abbreviation tables, as perfect hashes for '
+              'perfect_hash_lookup().\n')
+    out.write(' *\n')
+    out.write(' * Generated by tools/gen_usps_tables.py from tools/usps/; '
+              'do not edit.\n')
+    out.write(' */\n')
+    out.write('#ifndef USPS_TABLES_H\n#define USPS_TABLES_H\n\n')
+    out.write('#include "perfect_hash.h"\n')
+
+    for name, filename, derive in TABLES:
+        pairs = read_table(filename)
+        source = filename
+        if derive:
+            pairs = derive(pairs)
+            source = '%s of %s' % (derive.__name__, filename)
+        slots, displacements = build(pairs)
+
+        out.write('\n/* %s: %d entries */\n' % (source, len(pairs)))
+        out.write('static const PerfectHashEntry %s_slots[%d] = {\n'
+                  % (name, len(slots)))
+        for slot in slots:
+            if slot is None:
+                out.write('    {NULL, 0, NULL},\n')
+            else:
+                key, value = slot
+                out.write('    {%s, %d, %s},\n'
+                          % (c_string(key), len(key), c_string(value)))
+        out.write('};\n\n')
+
+        out.write('static const uint16_t %s_displacements[%d] = {\n'
+                  % (name, len(displacements)))
+        for row in range(0, len(displacements), 10):
+            out.write('    %s,\n' % ', '.join(
+                str(d) for d in displacements[row:row + 10]))
+        out.write('};\n\n')
+
+        out.write('static const PerfectHashTable %s = {\n' % name)
+        out.write('    .slots = %s_slots,\n' % name)
+        out.write('    .displacements = %s_displacements,\n' % name)
+        out.write('    .slot_mask = %d,\n' % (len(slots) - 1))
+        out.write('    .bucket_mask = %d,\n' % (len(displacements) - 1))
+        out.write('    .max_key_len = %d,\n'
+                  % max(len(key) for key, _ in pairs))
+        out.write('};\n')
+
+    out.write('\n#endif\n')
+
+
+if __name__ == '__main__':
+    main()